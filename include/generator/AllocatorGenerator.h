@@ -0,0 +1,105 @@
+/**
+ * @file AllocatorGenerator.h
+ * @brief Functions to generate allocator-aware classes using polymorphic memory resources.
+ */
+
+#pragma once
+
+#include "ClassModels.h"
+#include "PropertiesModels.h"
+
+#include <set>
+#include <string>
+
+/**
+ * @namespace AllocatorGenerator
+ * @brief Makes classes with `allocator = pmr` usable with std::pmr memory resources.
+ *
+ * Such a class declares `allocator_type` as std::pmr::polymorphic_allocator<>, which makes
+ * std::uses_allocator true for it, and allocator-extended constructors taking the allocator
+ * last. Containers such as std::pmr::vector then construct their elements in the container's
+ * memory resource, e.g. a std::pmr::monotonic_buffer_resource arena.
+ *
+ * Members of custom type are constructed with std::make_obj_using_allocator, which passes the
+ * allocator on when the type is allocator-aware and drops it otherwise.
+ */
+namespace AllocatorGenerator
+{
+    /**
+     * @brief Returns a type with std::string and the standard containers replaced by their std::pmr aliases.
+     *
+     * Template arguments are rewritten too, so `std::vector<std::string>` becomes
+     * `std::pmr::vector<std::pmr::string>`. Qualifiers and declarators are kept.
+     *
+     * @param type The type as declared in the DSL.
+     * @return The type using polymorphic allocators.
+     */
+    PropertiesModels::DataType pmrType(const PropertiesModels::DataType &type);
+
+    /**
+     * @brief Rewrites a class with `allocator = pmr` to use std::pmr members.
+     *
+     * Data members and the custom constructor parameters initialising them are passed through
+     * pmrType(). Classes without the option are returned unchanged.
+     *
+     * @param cl The class model.
+     * @return A copy of the class with rewritten member types.
+     */
+    ClassModels::ClassModel applyAllocator(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Reports whether a member is constructed with the class's allocator.
+     *
+     * True for std::pmr types and for custom types held by value, whose allocator-awareness is
+     * only known to the compiler.
+     *
+     * @param member The data member, after applyAllocator().
+     */
+    bool isAllocatorAware(const PropertiesModels::Parameter &member);
+
+    /**
+     * @brief Generates a member initialiser that passes on the allocator `alloc`.
+     *
+     * @param member The data member, after applyAllocator().
+     * @param argument The expression the member is initialised from, or empty to value-initialise it.
+     * @return The initialiser, e.g. `name(std::move(other.name), alloc)`.
+     */
+    std::string memberInitialiser(const PropertiesModels::Parameter &member, const std::string &argument);
+
+    /**
+     * @brief Generates the `allocator_type` alias and allocator-extended constructor declarations.
+     *
+     * Unless the class declares a default constructor, the allocator of the allocator-extended
+     * default constructor defaults to the default memory resource, so the class stays default
+     * constructible.
+     *
+     * @param cl The class model, after applyAllocator().
+     * @return The declarations, or an empty string if the class is not allocator-aware.
+     */
+    std::string generateAllocatorDeclarations(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Generates the allocator-extended default, copy and move constructor definitions.
+     *
+     * Each member is initialised from the other object's member, or value-initialised for the
+     * default constructor, with the allocator passed on to allocator-aware members. The bodies
+     * are complete and need no implementation.
+     *
+     * @param cl The class model, after applyAllocator().
+     * @param className The class name, with its template arguments for class templates (e.g. "Buffer<T>").
+     * @param inlineDef True to prefix the definitions with `inline` for header-only output.
+     * @param prefix Text emitted before each definition, e.g. the class's template head.
+     * @return The definitions, or an empty string if the class is not allocator-aware.
+     */
+    std::string generateAllocatorDefinitions(const ClassModels::ClassModel &cl, const std::string &className,
+                                             const bool inlineDef = false, const std::string &prefix = "");
+
+    /**
+     * @brief Collects the standard headers an allocator-aware class needs.
+     *
+     * @param cl The class model, after applyAllocator().
+     * @return The headers, or an empty set if the class is not allocator-aware.
+     */
+    std::set<std::string> requiredHeaders(const ClassModels::ClassModel &cl);
+
+} // namespace AllocatorGenerator
@@ -13,6 +13,8 @@
 #include "ProjectMetadata.h"
 
 #include <string>
+#include <utility>
+#include <vector>
 
 /**
  * @namespace BuildToolGenerator
@@ -33,24 +35,95 @@ namespace BuildToolGenerator
      * libraries, dependencies, and directory structure, and produces a complete
      * CMakeLists.txt configuration as a string. The generated content defines the
      * project settings, build targets for libraries and the main executable, and the
-     * linking of dependencies.
+     * linking of dependencies. When the project uses the subprojects CMake layout, libraries are
+     * pulled in through add_subdirectory() instead of being declared inline.
      *
      * @param projMetaData The project metadata containing library and dependency information.
      * @return A string containing the generated CMakeLists.txt content.
      */
     std::string generateCmakeLists(const ProjectMetadata::ProjMetadata &projMetaData);
 
+    /**
+     * @brief Generates the directory-level CMakeLists.txt of every library subproject.
+     *
+     * Only produces output when the project uses the subprojects CMake layout. Each library's
+     * CMakeLists.txt lives in its source folder, can be configured on its own, and exports its
+     * target under the <ProjectName>:: namespace.
+     *
+     * @param projMetaData The project metadata containing library and dependency information.
+     * @return Pairs of library folder (relative to src/) and the CMakeLists.txt content for it.
+     * @throws std::runtime_error if project level metadata isn't provided.
+     */
+    std::vector<std::pair<std::string, std::string>> generateLibraryCmakeLists(const ProjectMetadata::ProjMetadata &projMetaData);
+
+    /**
+     * @brief Generates Bazel BUILD.bazel and MODULE.bazel files for the generated project.
+     *
+     * Every library becomes a cc_library listing exactly its generated sources and headers, with
+     * its folders as include directories. Project-level files form a "<ProjectName>_lib" library
+     * depending on every library, and main.cpp is built by a cc_binary named after the project.
+     * Folders of a library are not split into rules of their own: CMake lets every file of a
+     * library include any of its headers, and the DSL does not record which folder depends on
+     * which, so per-folder rules could not declare their deps without guessing (or cycling).
+     * DSL dependencies are CMake packages without a mechanical Bazel equivalent, so MODULE.bazel
+     * lists them as comments to be mapped onto bazel_dep entries.
+     *
+     * @param projMetaData The project metadata containing library files and dependencies.
+     * @param version The project version recorded in MODULE.bazel; omitted when empty.
+     * @return A pair where the first element is BUILD.bazel and the second is MODULE.bazel.
+     * @throws std::runtime_error if project level metadata isn't provided.
+     */
+    std::pair<std::string, std::string> generateBazelFiles(const ProjectMetadata::ProjMetadata &projMetaData, const std::string &version);
+
+    /**
+     * @brief Generates the content of a CMakePresets.json file.
+     *
+     * The presets cover a debug build, a fast-relink developer build, a release build with
+     * IPO/LTO enabled, a RelWithDebInfo profiling build that keeps frame pointers for
+     * call-graph sampling, and the two stages of profile guided optimisation: an instrumented
+     * training build and a build that consumes the collected profiles from the project's
+     * pgo-profiles directory.
+     * Presets build into build/<presetName>; both PGO stages share build/pgo so that the
+     * profile data matches the object files being rebuilt.
+     *
+     * @param projectName The name of the project, used for preset display names.
+     * @return A string containing the generated CMakePresets.json content.
+     */
+    std::string generateCmakePresets(const std::string &projectName);
+
+    /**
+     * @brief Generates a compile_commands.json compilation database for the generated project.
+     *
+     * Each translation unit recorded in the metadata (plus main.cpp), and each generated test and
+     * benchmark, gets an entry compiled as C++23 with the same include directories the generated
+     * CMakeLists.txt gives its target and the same project-wide flags (e.g. -fno-exceptions), so
+     * clangd and static analysis can index the project before it has ever been configured.
+     * Include paths of external dependencies are only known after find_package() and are not listed.
+     *
+     * @param projMetaData The project metadata containing libraries and their translation units.
+     * @param projectRoot Absolute path of the generated project root.
+     * @return A string containing the generated compile_commands.json content.
+     */
+    std::string generateCompileCommands(const ProjectMetadata::ProjMetadata &projMetaData, const std::string &projectRoot);
+
     /**
      * @brief Generates VS Code JSON configuration files for launch and tasks.
      *
      * This function creates two JSON strings: one for a launch configuration (launch.json)
      * and one for build tasks (tasks.json). The generated JSON uses the provided projectName
-     * to customize target names, build directories, and prelaunch tasks.
+     * to customize target names, build directories, and prelaunch tasks. The tasks also include
+     * a developer build with its own debug configuration and a PGO train-then-rebuild loop,
+     * both driven by the presets from generateCmakePresets().
+     *
+     * With profiling tools enabled, a RelWithDebInfo profile build gets its own launch config and
+     * tasks for `perf record`/`perf report`, a heap profile (heaptrack, falling back to valgrind
+     * massif) and a run of every test labelled `benchmark`.
      *
      * @param projectName The name of the project. It is assumed that the first of the pair is the launch content
      * whereas the second is assumed to be the tasks.
+     * @param profilingTools Whether to add the profiling launch config and tasks.
      * @return A pair of strings, where the first is the launch.json content and the second is the tasks.json content.
      */
-    std::pair<std::string, std::string> generateVscodeJSONs(const std::string &projectName);
+    std::pair<std::string, std::string> generateVscodeJSONs(const std::string &projectName, const bool profilingTools = false);
 
 } // namespace BuildToolGenerator
@@ -20,6 +20,7 @@
 
 #include "CallableModels.h"
 
+#include <set>
 #include <string>
 
 /**
@@ -52,25 +53,29 @@ namespace CallableGenerator
      * A Doxygen comment block is prepended to the declaration.
      *
      * @param callable The callable's properties (from the common base model).
+     * @param scope Optional qualification of the trace scope name of an inline body, e.g. "Order::". Defaults to none.
      * @return A std::string representing the complete callable declaration.
      *
      * @throws std::runtime_error If any property of the callable is invalid.
      */
-    std::string generateCallableDeclaration(const CallableModels::CallableModel &callable);
+    std::string generateCallableDeclaration(const CallableModels::CallableModel &callable, const std::string &scope = "");
 
     /**
      * @brief Generates a callable definition string.
      *
      * This function creates a complete definition string for a callable (function or method)
      * that includes the function signature and a default body that throws a std::runtime_error,
-     * indicating that the callable is not yet implemented.
+     * indicating that the callable is not yet implemented. Instrumented callables open their body
+     * with a TRACE_SCOPE statement. In exception-free projects the callable returns std::expected
+     * and the body returns errors::Error::NOT_IMPLEMENTED instead (see ErrorGenerator).
      *
      * @param callable The callable's properties (from the common base model).
+     * @param scope Optional qualification of the trace scope name, e.g. "Geo::". Defaults to none.
      * @return A std::string representing the complete callable definition.
      *
      * @throws std::runtime_error If any property of the callable is invalid.
      */
-    std::string generateCallableDefinition(const CallableModels::CallableModel &callable);
+    std::string generateCallableDefinition(const CallableModels::CallableModel &callable, const std::string &scope = "");
 
     //--------------------------------------------------------------------------
     // Free Function Generators (aliasing the base generators)
@@ -82,13 +87,14 @@ namespace CallableGenerator
      * This inline function calls generateCallableDeclaration using a FunctionModel.
      *
      * @param func The FunctionModel containing the free function's properties.
+     * @param scope Optional qualification of the trace scope name of an inline body, e.g. "Geo::". Defaults to none.
      * @return A std::string representing the free function declaration.
      *
      * @throws std::runtime_error If any property of the function is invalid.
      */
-    inline std::string generateFunctionDeclaration(const CallableModels::FunctionModel &func)
+    inline std::string generateFunctionDeclaration(const CallableModels::FunctionModel &func, const std::string &scope = "")
     {
-        return generateCallableDeclaration(func);
+        return generateCallableDeclaration(func, scope);
     }
 
     /**
@@ -97,15 +103,30 @@ namespace CallableGenerator
      * This inline function calls generateCallableDefinition using a FunctionModel.
      *
      * @param func The FunctionModel containing the free function's properties.
+     * @param scope Optional qualification of the trace scope name, e.g. "Geo::". Defaults to none.
      * @return A std::string representing the free function definition.
      *
      * @throws std::runtime_error If any property of the function is invalid.
      */
-    inline std::string generateFunctionDefinition(const CallableModels::FunctionModel &func)
+    inline std::string generateFunctionDefinition(const CallableModels::FunctionModel &func, const std::string &scope = "")
     {
-        return generateCallableDefinition(func);
+        return generateCallableDefinition(func, scope);
     }
 
+    /**
+     * @brief Generates a free function as an inline definition for header-only output.
+     *
+     * The function is emitted as if it had been declared `inline` in the DSL, so the body is
+     * placed directly in the header and no out-of-line definition is required.
+     *
+     * @param func The FunctionModel containing the free function's properties.
+     * @param scope Optional qualification of the trace scope name, e.g. "Geo::". Defaults to none.
+     * @return A std::string representing the inline free function definition.
+     *
+     * @throws std::runtime_error If any property of the function is invalid.
+     */
+    std::string generateInlineFunctionDeclaration(const CallableModels::FunctionModel &func, const std::string &scope = "");
+
     //--------------------------------------------------------------------------
     // Method Generators (wrap the base generators)
     //--------------------------------------------------------------------------
@@ -118,11 +139,26 @@ namespace CallableGenerator
      * appears correctly when placed inside a class definition.
      *
      * @param method The MethodModel containing the method's properties.
+     * @param scope Optional qualification of the trace scope name of an inline body, e.g. "Order::". Defaults to none.
      * @return A std::string representing the indented method declaration.
      *
      * @throws std::runtime_error If any property of the method is invalid.
      */
-    std::string generateMethodDeclaration(const CallableModels::MethodModel &method);
+    std::string generateMethodDeclaration(const CallableModels::MethodModel &method, const std::string &scope = "");
+
+    /**
+     * @brief Generates a method defined in-class for header-only output.
+     *
+     * The method is emitted as if it had been declared `inline` in the DSL, so its body is
+     * placed inside the class definition and no out-of-line definition is required.
+     *
+     * @param method The MethodModel containing the method's properties.
+     * @param scope Optional qualification of the trace scope name, e.g. "Order::". Defaults to none.
+     * @return A std::string representing the indented in-class method definition.
+     *
+     * @throws std::runtime_error If any property of the method is invalid.
+     */
+    std::string generateInlineMethodDeclaration(const CallableModels::MethodModel &method, const std::string &scope = "");
 
     /**
      * @brief Generates a method definition string with class qualification.
@@ -139,4 +175,34 @@ namespace CallableGenerator
      */
     std::string generateMethodDefinition(const std::string &className, const CallableModels::MethodModel &method);
 
+    /**
+     * @brief Generates the explicit instantiations of a callable template.
+     *
+     * One line is emitted per instantiation listed in the DSL, with the template parameters in
+     * the return type and parameter list replaced by its arguments, e.g.
+     * `template int clamp<int>(int value);`. Explicit instantiation declarations
+     * (`extern template`) go in the header so that including translation units do not
+     * instantiate the template themselves; definitions go in one source file.
+     *
+     * @param callable The callable model.
+     * @param externDecl True for `extern template` declarations, false for instantiation definitions.
+     * @param scope Optional qualification of the callable's name, e.g. "Outer::Widget::". Defaults to none.
+     * @return The instantiations, one per line, or an empty string if there are none.
+     */
+    std::string generateExplicitInstantiations(const CallableModels::CallableModel &callable, const bool externDecl,
+                                               const std::string &scope = "");
+
+    /**
+     * @brief Collects the standard headers a callable's generated code depends on.
+     *
+     * Stubs of noexcept callables call std::terminate() instead of throwing, which needs <exception>,
+     * std::expected return types need <expected> and the quoted error code header, instrumented
+     * bodies need the quoted tracing support header, and non-type template parameters need the
+     * headers declaring their types.
+     *
+     * @param callable The callable model.
+     * @return The headers to include, in angle-bracket form.
+     */
+    std::set<std::string> requiredHeaders(const CallableModels::CallableModel &callable);
+
 } // namespace CallableGenerator
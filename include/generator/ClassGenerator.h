@@ -7,6 +7,7 @@
 
 #include "ClassModels.h"
 
+#include <set>
 #include <string>
 
 /**
@@ -23,10 +24,18 @@ namespace ClassGenerator
      * DSL model. It includes declarations for constructors, assignment operators, methods,
      * and member variables.
      *
+     * When headerOnly is set, methods are defined in-class and the special member definitions
+     * are appended as inline definitions after the class, so no source file is required.
+     * Class templates are introduced by their template head; a trivially copyable class template
+     * is checked for each of its explicit instantiations. Classes with `allocator = pmr` use
+     * std::pmr members and declare the allocator support of AllocatorGenerator. Classes with
+     * `soa = true` are followed by their struct-of-arrays container (see SoaGenerator).
+     *
      * @param cl The ClassModel containing all DSL class data.
+     * @param headerOnly Optional flag to emit a self-contained header-only class. Defaults to false.
      * @return A string containing the C++ class declaration.
      */
-    std::string generateClassDeclaration(const ClassModels::ClassModel &cl);
+    std::string generateClassDeclaration(const ClassModels::ClassModel &cl, const bool headerOnly = false);
 
     /**
      * @brief Generates the C++ class definition from a ClassModel.
@@ -35,9 +44,58 @@ namespace ClassGenerator
      * in the class. It includes definitions for constructors, assignment operators, destructors,
      * and methods.
      *
+     * Template definitions must be visible wherever they are instantiated, so they are generated
+     * separately from the others: every member of a class template, and the member templates of
+     * other classes, are only generated when templates is set.
+     *
      * @param cl The ClassModel containing all DSL class data.
+     * @param templates Optional flag to generate the template definitions instead of the others. Defaults to false.
      * @return A string containing the C++ class definition.
      */
-    std::string generateClassDefinition(const ClassModels::ClassModel &cl);
+    std::string generateClassDefinition(const ClassModels::ClassModel &cl, const bool templates = false);
+
+    /**
+     * @brief Reports whether a class is a template or has member templates.
+     *
+     * @param cl The ClassModel containing all DSL class data.
+     * @return True if generateClassDefinition() has template definitions to generate.
+     */
+    bool hasTemplates(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Reports whether a class can be value-initialised without arguments.
+     *
+     * True if the class declares no constructors, declares a default constructor, or is
+     * allocator-aware (whose allocator-extended default constructor defaults its allocator).
+     *
+     * @param cl The ClassModel containing all DSL class data.
+     */
+    bool isDefaultConstructible(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Generates the explicit instantiations of a class template and its member templates.
+     *
+     * Emits `template class Buffer<int>;` for every instantiation of the class, followed by the
+     * instantiations of its member templates, e.g. `template void Buffer<int>::fill<char>(char value);`.
+     * Member templates of a class template are instantiated for every instantiation of the class.
+     *
+     * @param cl The ClassModel containing all DSL class data.
+     * @param externDecl True for `extern template` declarations, false for instantiation definitions.
+     * @param scope Optional qualification of the class name, e.g. "Outer::". Defaults to none.
+     * @return The instantiations, one per line, or an empty string if there are none.
+     */
+    std::string generateExplicitInstantiations(const ClassModels::ClassModel &cl, const bool externDecl,
+                                               const std::string &scope = "");
+
+    /**
+     * @brief Collects the standard headers a class declaration depends on.
+     *
+     * Headers already included by every generated header (<string>, <stdexcept>) are not listed.
+     * The types of non-type template parameters, such as std::size_t, add their headers.
+     *
+     * @param cl The ClassModel containing all DSL class data.
+     * @return The headers to include, in angle-bracket form (e.g. "<new>").
+     */
+    std::set<std::string> requiredHeaders(const ClassModels::ClassModel &cl);
 
 } // namespace ClassGenerator
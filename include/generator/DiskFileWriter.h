@@ -9,8 +9,10 @@
 #pragma once
 
 #include "IFileWriter.h"
+#include "ProjectMetadata.h"
 
 #include <string>
+#include <vector>
 
 /**
  * @namespace GeneratedFileWriter
@@ -45,9 +47,11 @@ namespace GeneratedFileWriter
          *
          * @param oF The output folder for generated files. Optional, by default is
          * "generatedOutputs".
+         * @param exceptions Optional flag, false for projects built without exceptions, whose headers
+         * then do not include <stdexcept>. Defaults to true.
          */
-        DiskFileWriter(const std::string &oF = "generatedOutputs")
-            : outputFolder(oF)
+        DiskFileWriter(const std::string &oF = "generatedOutputs", const bool exceptions = true)
+            : outputFolder(oF), exceptions(exceptions)
         {
         }
 
@@ -73,6 +77,17 @@ namespace GeneratedFileWriter
          */
         void writeSourceFile(const std::string &filePath, const std::string &content) override;
 
+        /**
+         * @brief Writes a template definition file to disk.
+         *
+         * The file path provided will have the "ROOT/" prefix removed before being written
+         * to the <outputFolder>/include/ directory with a .tpp extension.
+         *
+         * @param filePath The relative file path for the template definition file.
+         * @param content The content to be written to the template definition file.
+         */
+        void writeTemplateFile(const std::string &filePath, const std::string &content) override;
+
         /**
          * @brief Writes the provided CMakeLists.txt content to disk.
          *
@@ -84,14 +99,66 @@ namespace GeneratedFileWriter
          */
         void writeCmakeLists(const std::string &cmakeListsTxt) const;
 
+        /**
+         * @brief Writes a library subproject's CMakeLists.txt to disk.
+         *
+         * The file is written to <outputFolder>/src/<libraryPath>/CMakeLists.txt.
+         *
+         * @param libraryPath The library folder relative to src/.
+         * @param cmakeListsTxt The string containing the content to be written to CMakeLists.txt.
+         */
+        void writeLibraryCmakeLists(const std::string &libraryPath, const std::string &cmakeListsTxt) const;
+
+        /**
+         * @brief Writes the provided CMakePresets.json content to disk.
+         *
+         * The presets file is written next to CMakeLists.txt at the root of the output folder.
+         *
+         * @param cmakePresetsJson The string containing the content to be written to CMakePresets.json.
+         */
+        void writeCmakePresets(const std::string &cmakePresetsJson) const;
+
+        /**
+         * @brief Writes Bazel build files to disk.
+         *
+         * BUILD.bazel and MODULE.bazel are written at the root of the output folder.
+         *
+         * @param bazelFiles A pair where the first element is the content for BUILD.bazel and the
+         *                   second element is the content for MODULE.bazel.
+         */
+        void writeBazelFiles(const std::pair<std::string, std::string> &bazelFiles) const;
+
+        /**
+         * @brief Writes the provided compilation database to disk.
+         *
+         * The compile_commands.json file is written at the root of the output folder where
+         * clangd and other tooling look for it by default.
+         *
+         * @param compileCommandsJson The string containing the content to be written to compile_commands.json.
+         */
+        void writeCompileCommands(const std::string &compileCommandsJson) const;
+
         /**
          * @brief Writes the main.cpp file.
          *
          * This function creates or overwrites the main.cpp file with the necessary content,
          * including a Doxygen header comment, required includes, and a minimal main function
-         * implementation that prints a "Hello, world!" message.
+         * implementation that prints a "Hello, world!" message. Projects with the built-in
+         * profiler open a profiling session for the lifetime of main().
+         *
+         * @param projMeta The project metadata, deciding whether the profiler is installed.
+         */
+        void writeMain(const ProjectMetadata::ProjMetadata &projMeta) const;
+
+        /**
+         * @brief Writes files generated outside the directory tree to disk.
+         *
+         * Each file is written at its path relative to the root of the output folder, e.g. shared
+         * runtime headers under include/, tests under tests/ and benchmarks under benchmarks/.
+         *
+         * @param supportFiles The files recorded in the project metadata.
          */
-        void writeMain() const;
+        void writeSupportFiles(const std::vector<ProjectMetadata::SupportFile> &supportFiles) const;
 
         /**
          * @brief Writes VS Code configuration JSON files to disk.
@@ -107,6 +174,7 @@ namespace GeneratedFileWriter
 
     private:
         const std::string outputFolder; //**< Output folder for generated files */
+        const bool exceptions;          //**< Whether generated headers include <stdexcept> for throwing stubs */
     };
 
 } // namespace GeneratedFileWriter
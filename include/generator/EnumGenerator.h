@@ -0,0 +1,68 @@
+/**
+ * @file EnumGenerator.h
+ * @brief Functions to generate scoped enumerations with constant-time name conversions.
+ */
+
+#pragma once
+
+#include "CodeGroupModels.h"
+#include "EnumModels.h"
+
+#include <set>
+#include <string>
+
+/**
+ * @namespace EnumGenerator
+ * @brief Generates `enum class` declarations from `- enum` blocks, with their conversions and traits.
+ *
+ * Each enumeration gets a constexpr `toString()` overload in its namespace, indexing an array of
+ * the enumerator names. A specialisation of `enums::EnumTraits` at global scope lists its count,
+ * values and names together with a perfect hash of the names built at compile time, which
+ * `enums::fromString<E>()` from a support header generated once per project uses to look a name
+ * up with one hash and one comparison. A static_assert checks every name converts back.
+ */
+namespace EnumGenerator
+{
+    /// Name of the support header declaring EnumTraits and fromString(), relative to include/.
+    inline constexpr const char *SUPPORT_HEADER = "EnumTraits.h";
+
+    /**
+     * @brief Generates the enumeration and its `toString()` overload.
+     *
+     * @param en The enumeration model.
+     * @return The declarations, to be emitted in the enumeration's namespace.
+     */
+    std::string generateEnumDeclaration(const EnumModels::EnumModel &en);
+
+    /**
+     * @brief Generates the `enums::EnumTraits` specialisation of an enumeration, to be emitted at global scope.
+     *
+     * @param en The enumeration model.
+     * @param scope Optional qualification of the enumeration name, e.g. "Outer::". Defaults to none.
+     * @return The specialisation and its round-trip static_assert, preceded by a blank line.
+     */
+    std::string generateEnumTraits(const EnumModels::EnumModel &en, const std::string &scope = "");
+
+    /**
+     * @brief Collects the headers an enumeration's declarations and traits need.
+     *
+     * @param en The enumeration model.
+     * @return The headers, including the quoted support header.
+     */
+    std::set<std::string> requiredHeaders(const EnumModels::EnumModel &en);
+
+    /**
+     * @brief Reports whether a namespace or any of its nested namespaces declares an enumeration.
+     *
+     * @param ns The namespace model.
+     */
+    bool hasEnums(const CodeGroupModels::NamespaceModel &ns);
+
+    /**
+     * @brief Generates the support header declaring EnumTraits, PerfectHash and fromString().
+     *
+     * @return The complete header content.
+     */
+    std::string generateSupportHeader();
+
+} // namespace EnumGenerator
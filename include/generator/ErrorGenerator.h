@@ -0,0 +1,119 @@
+/**
+ * @file ErrorGenerator.h
+ * @brief Functions to generate exception-free error reporting through std::expected.
+ */
+
+#pragma once
+
+#include "CallableModels.h"
+#include "ClassModels.h"
+#include "CodeGroupModels.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace ErrorGenerator
+ * @brief Resolves the project's `errors` property and generates the error code support header.
+ *
+ * With `errors = expected` every method and free function returns `std::expected<T, errors::Error>`
+ * and its stub returns `std::unexpected(errors::Error::NOT_IMPLEMENTED)` instead of throwing.
+ * Constructors cannot return a value, so each custom constructor gets a static `create()` factory
+ * returning `std::expected` and the stubs of constructors and assignment operators terminate. The
+ * error enumeration is generated like any DSL enum, with toString() and enums::fromString(), in a
+ * support header generated once per project, and the project builds with `-fno-exceptions`.
+ *
+ * Callables returning a reference or `auto` keep their return type, as std::expected cannot hold
+ * a reference and cannot deduce its value type; their stubs terminate too.
+ */
+namespace ErrorGenerator
+{
+    /// Name of the support header declaring errors::Error, relative to include/.
+    inline constexpr const char *SUPPORT_HEADER = "Errors.h";
+
+    /**
+     * @brief Reports whether a callable's return type is wrapped in std::expected.
+     *
+     * @param callable The callable model, after applyErrorHandling().
+     */
+    bool returnsExpected(const CallableModels::CallableModel &callable);
+
+    /**
+     * @brief Returns the return type a callable is generated with.
+     *
+     * @param callable The callable model, after applyErrorHandling().
+     * @return The declared return type, wrapped in `std::expected<..., errors::Error>` if returnsExpected().
+     */
+    std::string returnType(const CallableModels::CallableModel &callable);
+
+    /**
+     * @brief Wraps a value type in the std::expected type of generated callables.
+     *
+     * @param valueType The value type, e.g. "int".
+     * @return The type, e.g. "std::expected<int, errors::Error>".
+     */
+    std::string expectedType(const std::string &valueType);
+
+    /**
+     * @brief Returns the statement ending the stub of a callable that returns std::expected.
+     *
+     * @return The statement, without indentation or trailing newline.
+     */
+    std::string notImplementedStatement();
+
+    /**
+     * @brief Marks a class and its methods as reporting errors through std::expected.
+     *
+     * @param cl The class model.
+     * @param errors The project's error handling.
+     * @return A copy of the class with resolved flags.
+     * @throws std::runtime_error if the class is serialisable, as deserialisation reports errors with exceptions.
+     */
+    ClassModels::ClassModel applyErrorHandling(const ClassModels::ClassModel &cl, const CodeGroupModels::ErrorHandling errors);
+
+    /**
+     * @brief Resolves the error handling of every class and function of a namespace, recursively.
+     *
+     * @param ns The namespace model.
+     * @param errors The project's error handling.
+     * @return A copy of the namespace with resolved flags.
+     */
+    CodeGroupModels::NamespaceModel applyErrorHandling(const CodeGroupModels::NamespaceModel &ns,
+                                                       const CodeGroupModels::ErrorHandling errors);
+
+    /**
+     * @brief Resolves the error handling of a file of free functions.
+     *
+     * @param functions The function models.
+     * @param errors The project's error handling.
+     * @return A copy of the functions with resolved flags.
+     */
+    std::vector<CallableModels::FunctionModel> applyErrorHandling(const std::vector<CallableModels::FunctionModel> &functions,
+                                                                  const CodeGroupModels::ErrorHandling errors);
+
+    /**
+     * @brief Resolves the error handling of a file of merged classes.
+     *
+     * @param classes The class models.
+     * @param errors The project's error handling.
+     * @return A copy of the classes with resolved flags.
+     */
+    std::vector<ClassModels::ClassModel> applyErrorHandling(const std::vector<ClassModels::ClassModel> &classes,
+                                                            const CodeGroupModels::ErrorHandling errors);
+
+    /**
+     * @brief Collects the headers needed by std::expected return types and their stubs.
+     *
+     * @return The headers, including the quoted support header.
+     */
+    std::set<std::string> requiredHeaders();
+
+    /**
+     * @brief Generates the support header declaring errors::Error with its name conversions.
+     *
+     * @return The complete header content.
+     */
+    std::string generateSupportHeader();
+
+} // namespace ErrorGenerator
@@ -18,6 +18,7 @@
 
 #include <string>
 #include <concepts>
+#include <vector>
 
 /**
  * @namespace FileNodeGenerator
@@ -38,7 +39,9 @@ namespace FileNodeGenerator
     {
         std::string headerContent; ///< Generated header file content.
         std::string sourceContent; ///< Generated source file content.
+        std::string templateContent; ///< Generated template definitions for the .tpp file; empty if there are none.
         std::string baseFilePath;  ///< Base relative file path (e.g., "MyProject/core/TestClass").
+        bool headerOnly = false;   ///< True if all content lives in the header and no source file should be written.
     };
 
     /**
@@ -65,6 +68,18 @@ namespace FileNodeGenerator
          * @return The base file path as a std::string.
          */
         virtual std::string getBasePath() const = 0;
+        /**
+         * @brief Reports whether this file is generated header-only.
+         *
+         * @return True if no source file is produced for this node.
+         */
+        virtual bool isHeaderOnly() const = 0;
+        /**
+         * @brief Reports whether this file has template definitions for a .tpp file.
+         *
+         * @return True if generateFiles() produces template content.
+         */
+        virtual bool hasTemplateFile() const = 0;
     };
 
     /**
@@ -74,6 +89,7 @@ namespace FileNodeGenerator
      * - ClassModels::ClassModel
      * - CodeGroupModels::NamespaceModel
      * - std::vector<CallableModels::FunctionModel>
+     * - std::vector<ClassModels::ClassModel> (several small classes merged into one translation unit)
      *
      * Used to ensure only these types can be passed into FileNode for code generation.
      *
@@ -83,7 +99,8 @@ namespace FileNodeGenerator
     concept ValidFileNodeType =
         std::same_as<T, ClassModels::ClassModel> ||
         std::same_as<T, CodeGroupModels::NamespaceModel> ||
-        std::same_as<T, std::vector<CallableModels::FunctionModel>>;
+        std::same_as<T, std::vector<CallableModels::FunctionModel>> ||
+        std::same_as<T, std::vector<ClassModels::ClassModel>>;
 
     /**
      * @brief Templated FileNode class for generating code files.
@@ -101,6 +118,8 @@ namespace FileNodeGenerator
         T content;            ///< The DSL object used for code generation.
         std::string basePath; ///< The base relative path within the project (e.g., "MyProject/core").
         std::string fileName; ///< The base file name (without extension).
+        bool headerOnly;      ///< True if definitions are emitted inline in the header and no source is produced.
+        std::vector<std::string> siblingHeaders; ///< Headers of the same directory the header includes first, e.g. "Core.h".
 
         /**
          * @brief Constructs a new FileNode.
@@ -108,15 +127,24 @@ namespace FileNodeGenerator
          * @param basePath The base relative path for the file.
          * @param fileName The base name of the file (without extension).
          * @param cont The DSL object for generating file content.
+         * @param headerOnly Optional flag to emit all definitions inline in the header. Defaults to false.
+         * @param siblingHeaders Optional headers of the same directory declaring what the content uses,
+         *                       such as the enumerations of a split namespace. Defaults to none.
          */
-        FileNode(const std::string &basePath, const std::string &fileName, T cont);
+        FileNode(const std::string &basePath, const std::string &fileName, T cont, bool headerOnly = false,
+                 std::vector<std::string> siblingHeaders = {});
 
         /**
          * @brief Generates the header and source file contents.
          *
          * This method computes the base file path by combining the basePath and fileName.
-         * It then generates header content (via generateHeaderContent()) and source content
-         * (via generateSourceContent()). The caller is responsible for prepending "include/" and "src/".
+         * It then generates header content (via the sibling headers, generateIncludes() and generateHeaderContent())
+         * and source content (via generateSourceContent()). Template definitions (via
+         * generateTemplateContent()) go to a `.tpp` file included at the end of the header, followed by
+         * the `extern template` declarations whose definitions end the source content. For header-only nodes the header is produced by
+         * generateHeaderOnlyContent() and the source content is left empty. In both cases the
+         * declarations are followed by the global-scope specialisations of generateGlobalSpecializations(). The caller is
+         * responsible for prepending "include/" and "src/".
          *
          * @return A GeneratedFiles struct containing the generated header and source content,
          *         as well as the base file path.
@@ -129,6 +157,22 @@ namespace FileNodeGenerator
          * @return The base relative file path as a std::string.
          */
         std::string getBasePath() const override;
+
+        /**
+         * @brief Reports whether this file is generated header-only.
+         *
+         * @return True if no source file is produced for this node.
+         */
+        bool isHeaderOnly() const override;
+
+        /**
+         * @brief Reports whether this file has template definitions for a .tpp file.
+         *
+         * Header-only files define their templates in the header and never have one.
+         *
+         * @return True if generateFiles() produces template content.
+         */
+        bool hasTemplateFile() const override;
     };
 
     /**
@@ -155,6 +199,74 @@ namespace FileNodeGenerator
     template <typename T>
     std::string generateSourceContent(const T &obj);
 
+    /**
+     * @brief Generates self-contained header content for a DSL object.
+     *
+     * The header carries both declarations and inline definitions so that no source file is
+     * required. This function should be specialized for different DSL types.
+     *
+     * @tparam T The type of the DSL object.
+     * @param obj The DSL object.
+     * @return A std::string containing the generated header-only content.
+     */
+    template <typename T>
+    std::string generateHeaderOnlyContent(const T &obj);
+
+    /**
+     * @brief Generates the template definitions of a DSL object.
+     *
+     * Templates must be defined wherever they are instantiated, so their definitions are written
+     * to a `.tpp` file included at the end of the header instead of the source file. This
+     * function should be specialized for different DSL types.
+     *
+     * @tparam T The type of the DSL object.
+     * @param obj The DSL object.
+     * @return A std::string containing the template definitions, or an empty string if there are none.
+     */
+    template <typename T>
+    std::string generateTemplateContent(const T &obj);
+
+    /**
+     * @brief Generates the explicit instantiations of a DSL object's templates.
+     *
+     * The header declares them `extern template` so that including translation units do not
+     * instantiate the templates again, and the source file defines them once. This function
+     * should be specialized for different DSL types.
+     *
+     * @tparam T The type of the DSL object.
+     * @param obj The DSL object.
+     * @param externDecl True for `extern template` declarations, false for instantiation definitions.
+     * @return A std::string of instantiations, one per line, or an empty string if there are none.
+     */
+    template <typename T>
+    std::string generateExplicitInstantiations(const T &obj, const bool externDecl);
+
+    /**
+     * @brief Generates the specialisations of a DSL object's enumerations and value classes.
+     *
+     * Specialisations of enums::EnumTraits and std::hash must be declared outside the namespace of
+     * the type they describe, so they follow the declarations at global scope. This function should be specialized for different DSL types.
+     *
+     * @tparam T The type of the DSL object.
+     * @param obj The DSL object.
+     * @return A std::string of specialisations, or an empty string if there are none.
+     */
+    template <typename T>
+    std::string generateGlobalSpecializations(const T &obj);
+
+    /**
+     * @brief Generates the #include directives a DSL object's header needs.
+     *
+     * Only headers beyond the common preamble written by the file writer are listed, so the
+     * result is empty for most objects. This function should be specialized for different DSL types.
+     *
+     * @tparam T The type of the DSL object.
+     * @param obj The DSL object.
+     * @return A std::string of #include lines followed by a blank line, or an empty string.
+     */
+    template <typename T>
+    std::string generateIncludes(const T &obj);
+
 } // namespace FileNodeGenerator
 
 // Include inline template definitions.
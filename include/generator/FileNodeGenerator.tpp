@@ -4,6 +4,7 @@
 
 #include <sstream>
 #include <string>
+#include <utility>
 
 namespace FileNodeGenerator
 {
@@ -14,8 +15,9 @@ namespace FileNodeGenerator
 
     template <typename T>
         requires ValidFileNodeType<T>
-    FileNode<T>::FileNode(const std::string &basePath, const std::string &fileName, T cont)
-        : content(cont), basePath(basePath), fileName(fileName)
+    FileNode<T>::FileNode(const std::string &basePath, const std::string &fileName, T cont, bool headerOnly,
+                          std::vector<std::string> siblingHeaders)
+        : content(cont), basePath(basePath), fileName(fileName), headerOnly(headerOnly), siblingHeaders(std::move(siblingHeaders))
     {
     }
 
@@ -25,8 +27,42 @@ namespace FileNodeGenerator
     {
         GeneratedFiles files;
         files.baseFilePath = basePath + "/" + fileName;
-        files.headerContent = generateHeaderContent(content);
+        files.headerOnly = headerOnly;
+
+        // Sibling headers lead the quoted headers of the generated includes.
+        std::string includes;
+        for (const auto &header : siblingHeaders)
+        {
+            includes += "#include \"" + header + "\"\n";
+        }
+        const std::string generatedIncludes = generateIncludes(content);
+        includes += (generatedIncludes.empty() && !includes.empty()) ? "\n" : generatedIncludes;
+
+        // EnumTraits and std::hash are specialised at global scope, after the namespaces declaring the types.
+        const std::string specializations = generateGlobalSpecializations(content);
+        if (headerOnly)
+        {
+            // Everything lives in the header; no source file is produced.
+            files.headerContent = includes + generateHeaderOnlyContent(content) + specializations;
+            return files;
+        }
+        files.headerContent = includes + generateHeaderContent(content) + specializations;
         files.sourceContent = generateSourceContent(content);
+        files.templateContent = generateTemplateContent(content);
+        if (!files.templateContent.empty())
+        {
+            // Template definitions follow the declarations they define.
+            files.headerContent += "\n#include \"" + fileName + ".tpp\"\n";
+
+            // Instantiate the listed arguments once, in the source file.
+            std::string externs = generateExplicitInstantiations(content, true);
+            if (!externs.empty())
+            {
+                files.headerContent += "\n// Explicitly instantiated in " + fileName + ".cpp.\n" + externs;
+                files.sourceContent += (files.sourceContent.empty() ? "" : "\n");
+                files.sourceContent += "// Explicit instantiations.\n" + generateExplicitInstantiations(content, false);
+            }
+        }
         return files;
     }
 
@@ -37,6 +73,20 @@ namespace FileNodeGenerator
         return basePath;
     }
 
+    template <typename T>
+        requires ValidFileNodeType<T>
+    bool FileNode<T>::isHeaderOnly() const
+    {
+        return headerOnly;
+    }
+
+    template <typename T>
+        requires ValidFileNodeType<T>
+    bool FileNode<T>::hasTemplateFile() const
+    {
+        return !headerOnly && !generateTemplateContent(content).empty();
+    }
+
     // --------------------------------------------------------------------------
     // Default Helper Function Template Definitions (fallback for missing specializations)
     // --------------------------------------------------------------------------
@@ -59,4 +109,49 @@ namespace FileNodeGenerator
         return {};
     }
 
+    // Triggers a compile-time error if instantiated without a specialization.
+    template <typename T>
+        requires ValidFileNodeType<T>
+    std::string generateHeaderOnlyContent(const T &)
+    {
+        static_assert(sizeof(T) == 0, "generateHeaderOnlyContent not implemented for this DSL model type");
+        return {};
+    }
+
+    // Triggers a compile-time error if instantiated without a specialization.
+    template <typename T>
+        requires ValidFileNodeType<T>
+    std::string generateTemplateContent(const T &)
+    {
+        static_assert(sizeof(T) == 0, "generateTemplateContent not implemented for this DSL model type");
+        return {};
+    }
+
+    // Triggers a compile-time error if instantiated without a specialization.
+    template <typename T>
+        requires ValidFileNodeType<T>
+    std::string generateExplicitInstantiations(const T &, const bool)
+    {
+        static_assert(sizeof(T) == 0, "generateExplicitInstantiations not implemented for this DSL model type");
+        return {};
+    }
+
+    // Triggers a compile-time error if instantiated without a specialization.
+    template <typename T>
+        requires ValidFileNodeType<T>
+    std::string generateGlobalSpecializations(const T &)
+    {
+        static_assert(sizeof(T) == 0, "generateGlobalSpecializations not implemented for this DSL model type");
+        return {};
+    }
+
+    // Triggers a compile-time error if instantiated without a specialization.
+    template <typename T>
+        requires ValidFileNodeType<T>
+    std::string generateIncludes(const T &)
+    {
+        static_assert(sizeof(T) == 0, "generateIncludes not implemented for this DSL model type");
+        return {};
+    }
+
 } // namespace FileNodeGenerator
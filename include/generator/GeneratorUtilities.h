@@ -12,9 +12,12 @@
 
 #pragma once
 
+#include "ClassModels.h"
 #include "PropertiesModels.h"
 
+#include <set>
 #include <string>
+#include <vector>
 
 /**
  * @namespace GeneratorUtilities
@@ -72,4 +75,85 @@ namespace GeneratorUtilities
      */
     std::string removeRootPrefix(const std::string &path);
 
+    /**
+     * @brief Returns the names of a template's parameters.
+     *
+     * The name is the last word of each declaration, e.g. `N` for `std::size_t N`.
+     *
+     * @param spec The template specification.
+     * @return The parameter names in declaration order.
+     */
+    std::vector<std::string> templateParameterNames(const PropertiesModels::TemplateSpec &spec);
+
+    /**
+     * @brief Generates the template head introducing a templated declaration.
+     *
+     * @param spec The template specification.
+     * @return "template <...>" followed by a newline, or an empty string for non-templates.
+     */
+    std::string templateHeader(const PropertiesModels::TemplateSpec &spec);
+
+    /**
+     * @brief Generates the argument list naming a template by its own parameters.
+     *
+     * Used to qualify out-of-line member definitions, e.g. `Buffer<T, N>::size`.
+     *
+     * @param spec The template specification.
+     * @return "<T, N>", or an empty string for non-templates.
+     */
+    std::string templateArgumentList(const PropertiesModels::TemplateSpec &spec);
+
+    /**
+     * @brief Generates one Doxygen `@tparam` line per template parameter.
+     *
+     * @param spec The template specification.
+     * @return The lines, each starting with " * ", or an empty string for non-templates.
+     */
+    std::string templateParameterDoxygen(const PropertiesModels::TemplateSpec &spec);
+
+    /**
+     * @brief Collects the standard headers declaring the types of non-type template parameters.
+     *
+     * Recognises the `<cstddef>` types (e.g. `std::size_t N`) and the fixed-width integers of
+     * `<cstdint>` (e.g. `std::uint8_t Bits`).
+     *
+     * @param spec The template specification.
+     * @return The headers to include, in angle-bracket form.
+     */
+    std::set<std::string> templateParameterHeaders(const PropertiesModels::TemplateSpec &spec);
+
+    /**
+     * @brief Replaces every template parameter name in a piece of code with its argument.
+     *
+     * Only whole identifiers are replaced, so `T` in `std::vector<T>` is substituted while
+     * `Type` is not.
+     *
+     * @param code The code to substitute in, e.g. a rendered signature.
+     * @param spec The template specification naming the parameters.
+     * @param arguments One instantiation's comma-separated argument list.
+     * @return The code with the parameters replaced.
+     */
+    std::string substituteTemplateArguments(const std::string &code, const PropertiesModels::TemplateSpec &spec,
+                                            const std::string &arguments);
+
+    /**
+     * @brief Returns the data members of all access sections in emission order.
+     *
+     * @param cl The class model.
+     * @return The public, then private, then protected members.
+     */
+    std::vector<PropertiesModels::Parameter> allMembers(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Returns the name of a generated test or benchmark executable for a class.
+     *
+     * Executable names must be unique across the project, so the namespaces of the qualified
+     * class name are folded into it, e.g. `Geo::Shape` with suffix `ValueTest` gives `GeoShapeValueTest`.
+     *
+     * @param qualifiedName The class name, qualified with its namespaces.
+     * @param suffix The kind of executable, appended to the folded name.
+     * @return The executable name.
+     */
+    std::string executableName(const std::string &qualifiedName, const std::string &suffix);
+
 } // namespace GeneratorUtilities
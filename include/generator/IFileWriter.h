@@ -39,4 +39,14 @@ public:
      * @param content The content to be written to the source file.
      */
     virtual void writeSourceFile(const std::string &filePath, const std::string &content) = 0;
+
+    /**
+     * @brief Writes a template definition (.tpp) file with the specified path and content.
+     *
+     * The file is placed next to the header of the same path, which includes it.
+     *
+     * @param filePath The relative file path for the template definition file.
+     * @param content The content to be written to the template definition file.
+     */
+    virtual void writeTemplateFile(const std::string &filePath, const std::string &content) = 0;
 };
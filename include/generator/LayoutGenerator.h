@@ -0,0 +1,106 @@
+/**
+ * @file LayoutGenerator.h
+ * @brief Functions to estimate and optimise the memory layout of generated classes.
+ */
+
+#pragma once
+
+#include "ClassModels.h"
+#include "PropertiesModels.h"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+/**
+ * @namespace LayoutGenerator
+ * @brief Provides functions to order data members and estimate the resulting object size.
+ *
+ * Sizes and alignments assume an LP64 target with the Itanium C++ ABI and libstdc++
+ * (e.g. 64-bit Linux with GCC or Clang). Only the layout of builtin types and of the standard
+ * scalar aliases (e.g. std::size_t, std::int32_t, std::byte) is known; other custom and auto
+ * types are treated as being of unknown size.
+ */
+namespace LayoutGenerator
+{
+    /// Cache line size assumed for std::hardware_destructive_interference_size.
+    inline constexpr size_t CACHE_LINE_SIZE = 64;
+
+    /// Size of pointers and references, and the word size of std::string internals, on the assumed target.
+    inline constexpr size_t POINTER_SIZE = 8;
+
+    /**
+     * @brief Size and alignment of a type in bytes.
+     */
+    struct TypeLayout
+    {
+        size_t size;      ///< sizeof the type.
+        size_t alignment; ///< alignof the type.
+    };
+
+    /**
+     * @brief Estimated size of a class before and after member reordering.
+     */
+    struct LayoutReport
+    {
+        size_t declaredSize;  ///< Estimated size with members in DSL order.
+        size_t optimisedSize; ///< Estimated size with members in emitted order.
+        bool isComplete;      ///< False if members of unknown size were left out of the estimate.
+
+        /**
+         * @brief Returns the number of padding bytes removed by reordering.
+         *
+         * Zero if grouping hot and cold members made the class larger.
+         */
+        size_t bytesSaved() const { return declaredSize > optimisedSize ? declaredSize - optimisedSize : 0; }
+    };
+
+    /**
+     * @brief Returns the size and alignment of a data member's type.
+     *
+     * Pointers and references both occupy one pointer-sized slot as members. Arrays multiply
+     * the element size by every dimension, which must be an integer literal to be known.
+     *
+     * @param type The data type of the member.
+     * @return The type's layout, or std::nullopt if it is neither a builtin type nor a known standard alias.
+     */
+    std::optional<TypeLayout> typeLayout(const PropertiesModels::DataType &type);
+
+    /**
+     * @brief Reports whether a data member must start a new cache line.
+     *
+     * A member annotated `@own_cacheline` starts a new line, and so does the member declared
+     * right after it, so that nothing else shares its line.
+     *
+     * @param member The data member.
+     * @param previousOwnsLine True if the previously declared member is annotated `@own_cacheline`.
+     * @return True if the member must be declared alignas(std::hardware_destructive_interference_size).
+     */
+    bool startsCacheLine(const PropertiesModels::Parameter &member, const bool previousOwnsLine);
+
+    /**
+     * @brief Orders the data members of a class according to their annotations and layout policy.
+     *
+     * Members never move between access sections. Within a section, `@hot` members come first
+     * and `@cold` members last; each group otherwise keeps DSL order. Under the compact policy
+     * each group takes whichever of decreasing alignment, increasing alignment or DSL order ends
+     * it at the lowest offset, given where the previous group ended, so compaction never grows
+     * the class. Members of unknown size keep their relative order at the front of a group.
+     *
+     * @param cl The class whose members are ordered.
+     * @return A copy of the class with its members in the order they should be declared.
+     */
+    ClassModels::ClassModel orderMembers(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Estimates the object size of a class before and after orderMembers().
+     *
+     * Members are laid out in public, private, protected section order, matching the order in
+     * which ClassGenerator emits them.
+     *
+     * @param cl The class whose layout is estimated.
+     * @return The estimated size in DSL order and in emitted order.
+     */
+    LayoutReport estimateLayout(const ClassModels::ClassModel &cl);
+
+} // namespace LayoutGenerator
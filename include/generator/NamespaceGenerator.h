@@ -11,6 +11,7 @@
 
 #include "CodeGroupModels.h"
 
+#include <set>
 #include <string>
 
 /**
@@ -38,10 +39,17 @@ namespace NamespaceGenerator
      *  - A Doxygen-style comment if a description is provided.
      *  - Nested declarations for classes, functions, and nested namespaces.
      *
+     * When headerOnly is set, nested classes and functions carry inline definitions so the
+     * namespace needs no source file.
+     *
      * @param ns The NamespaceModel containing the DSL namespace data.
+     * @param headerOnly Optional flag to emit inline definitions for header-only output. Defaults to false.
+     * @param scope Optional qualification of the enclosing namespaces, e.g. "Outer::", which prefixes
+     *              the trace scope names of free functions. Defaults to none.
      * @return A string containing the complete C++ namespace declaration.
      */
-    std::string generateNamespaceDeclaration(const CodeGroupModels::NamespaceModel &ns);
+    std::string generateNamespaceDeclaration(const CodeGroupModels::NamespaceModel &ns, const bool headerOnly = false,
+                                             const std::string &scope = "");
 
     /**
      * @brief Generates the C++ namespace definition from a NamespaceModel.
@@ -50,9 +58,60 @@ namespace NamespaceGenerator
      *  - Generating definitions for nested classes and functions.
      *  - Recursively generating code for nested namespaces.
      *
+     * Template definitions are generated separately from the others, as for
+     * ClassGenerator::generateClassDefinition().
+     *
      * @param ns The NamespaceModel containing the DSL namespace data.
+     * @param templates Optional flag to generate the template definitions instead of the others. Defaults to false.
+     * @param scope Optional qualification of the enclosing namespaces, e.g. "Outer::", which prefixes
+     *              the trace scope names of free functions. Defaults to none.
      * @return A string containing the complete C++ namespace definition.
      */
-    std::string generateNamespaceDefinition(const CodeGroupModels::NamespaceModel &ns);
+    std::string generateNamespaceDefinition(const CodeGroupModels::NamespaceModel &ns, const bool templates = false,
+                                            const std::string &scope = "");
+
+    /**
+     * @brief Reports whether a namespace contains any templates, recursively.
+     *
+     * @param ns The NamespaceModel containing the DSL namespace data.
+     * @return True if generateNamespaceDefinition() has template definitions to generate.
+     */
+    bool hasTemplates(const CodeGroupModels::NamespaceModel &ns);
+
+    /**
+     * @brief Generates the explicit instantiations of the templates in a namespace, recursively.
+     *
+     * Instantiations are qualified with the namespace path so they can be emitted at global scope.
+     * Entities of anonymous namespaces cannot be named there and are skipped.
+     *
+     * @param ns The NamespaceModel containing the DSL namespace data.
+     * @param externDecl True for `extern template` declarations, false for instantiation definitions.
+     * @param scope Optional qualification of the enclosing namespaces, e.g. "Outer::". Defaults to none.
+     * @return The instantiations, one per line, or an empty string if there are none.
+     */
+    std::string generateExplicitInstantiations(const CodeGroupModels::NamespaceModel &ns, const bool externDecl,
+                                               const std::string &scope = "");
+
+    /**
+     * @brief Generates the global-scope specialisations of a namespace, recursively.
+     *
+     * These are the enums::EnumTraits specialisations of its enumerations followed by the std::hash
+     * specialisations of its value classes. Names are qualified with the namespace path so the
+     * specialisations can be emitted at global scope. Members of anonymous namespaces are visible
+     * there unqualified.
+     *
+     * @param ns The NamespaceModel containing the DSL namespace data.
+     * @param scope Optional qualification of the enclosing namespaces, e.g. "Outer::". Defaults to none.
+     * @return The specialisations, or an empty string if there are none.
+     */
+    std::string generateGlobalSpecializations(const CodeGroupModels::NamespaceModel &ns, const std::string &scope = "");
+
+    /**
+     * @brief Collects the standard headers the classes of a namespace depend on, recursively.
+     *
+     * @param ns The NamespaceModel containing the DSL namespace data.
+     * @return The headers to include, in angle-bracket form.
+     */
+    std::set<std::string> requiredHeaders(const CodeGroupModels::NamespaceModel &ns);
 
 } // namespace NamespaceGenerator
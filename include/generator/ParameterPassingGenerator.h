@@ -0,0 +1,107 @@
+/**
+ * @file ParameterPassingGenerator.h
+ * @brief Functions to apply a parameter passing convention to callable signatures.
+ */
+
+#pragma once
+
+#include "CallableModels.h"
+#include "ClassModels.h"
+#include "CodeGroupModels.h"
+#include "PropertiesModels.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace ParameterPassingGenerator
+ * @brief Rewrites the parameter types of callables and custom constructors according to the
+ *        project's passing convention, before any code is generated from them.
+ *
+ * Under every convention other than PassingConvention::DECLARED, parameters declared without a
+ * pointer, reference or array declarator are treated as read-only inputs:
+ *   - builtin types fit in registers and stay by value,
+ *   - strings become `const std::string&` or `std::string_view`,
+ *   - custom types known to be at most two pointers wide (e.g. `std::size_t`, `std::int32_t`,
+ *     `std::string_view`, see LayoutGenerator::typeLayout) and DSL enums stay by value,
+ *   - other custom types, whose size is unknown or larger, become `const T&`.
+ * Parameters annotated `@sink` are stored or consumed by the callee, so they stay by value
+ * without const to be moved from, as do custom constructor parameters that initialise a
+ * same-named member. Data members and return types are never changed.
+ */
+namespace ParameterPassingGenerator
+{
+    /**
+     * @brief Returns the type a parameter is passed as under a convention.
+     *
+     * @param param The parameter as declared in the DSL.
+     * @param convention The project's passing convention.
+     * @param valueTypes Names of custom types that are cheap to copy, such as DSL enums.
+     * @return The type to emit in the signature.
+     */
+    PropertiesModels::DataType passedType(const PropertiesModels::Parameter &param,
+                                          const CodeGroupModels::PassingConvention convention,
+                                          const std::set<std::string> &valueTypes = {});
+
+    /**
+     * @brief Applies a convention to a parameter list.
+     *
+     * @param params The parameters as declared in the DSL.
+     * @param convention The project's passing convention.
+     * @param valueTypes Names of custom types that are cheap to copy, such as DSL enums.
+     * @return The parameters with their passed types.
+     */
+    std::vector<PropertiesModels::Parameter> applyConvention(const std::vector<PropertiesModels::Parameter> &params,
+                                                             const CodeGroupModels::PassingConvention convention,
+                                                             const std::set<std::string> &valueTypes = {});
+
+    /**
+     * @brief Applies a convention to the methods and custom constructors of a class.
+     *
+     * @param cl The class model.
+     * @param convention The project's passing convention.
+     * @param valueTypes Names of custom types that are cheap to copy, such as DSL enums.
+     * @return A copy of the class with rewritten parameter types.
+     */
+    ClassModels::ClassModel applyConvention(const ClassModels::ClassModel &cl,
+                                            const CodeGroupModels::PassingConvention convention,
+                                            const std::set<std::string> &valueTypes = {});
+
+    /**
+     * @brief Applies a convention to every class and function of a namespace, recursively.
+     *
+     * @param ns The namespace model.
+     * @param convention The project's passing convention.
+     * @param valueTypes Names of custom types that are cheap to copy; the namespace's own enums are added.
+     * @return A copy of the namespace with rewritten parameter types.
+     */
+    CodeGroupModels::NamespaceModel applyConvention(const CodeGroupModels::NamespaceModel &ns,
+                                                    const CodeGroupModels::PassingConvention convention,
+                                                    const std::set<std::string> &valueTypes = {});
+
+    /**
+     * @brief Applies a convention to a file of free functions.
+     *
+     * @param functions The function models.
+     * @param convention The project's passing convention.
+     * @param valueTypes Names of custom types that are cheap to copy, such as DSL enums.
+     * @return A copy of the functions with rewritten parameter types.
+     */
+    std::vector<CallableModels::FunctionModel> applyConvention(const std::vector<CallableModels::FunctionModel> &functions,
+                                                               const CodeGroupModels::PassingConvention convention,
+                                                               const std::set<std::string> &valueTypes = {});
+
+    /**
+     * @brief Applies a convention to a file of merged classes.
+     *
+     * @param classes The class models.
+     * @param convention The project's passing convention.
+     * @param valueTypes Names of custom types that are cheap to copy, such as DSL enums.
+     * @return A copy of the classes with rewritten parameter types.
+     */
+    std::vector<ClassModels::ClassModel> applyConvention(const std::vector<ClassModels::ClassModel> &classes,
+                                                         const CodeGroupModels::PassingConvention convention,
+                                                         const std::set<std::string> &valueTypes = {});
+
+} // namespace ParameterPassingGenerator
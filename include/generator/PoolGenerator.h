@@ -0,0 +1,87 @@
+/**
+ * @file PoolGenerator.h
+ * @brief Functions to generate pooled allocation for classes, with its runtime support and benchmark.
+ */
+
+#pragma once
+
+#include "ClassModels.h"
+
+#include <set>
+#include <string>
+
+/**
+ * @namespace PoolGenerator
+ * @brief Generates class-level `operator new` and `operator delete` for classes with `pooled = true`.
+ *
+ * The operators take blocks from the ObjectPool of a support header generated once per project.
+ * Each thread keeps a free list of blocks carved from slab pages, so allocating and freeing an
+ * object is a couple of pointer moves without a lock. Every `new` of the class, including through
+ * std::make_unique, uses the pool; std::make_shared and containers holding objects by value do not.
+ *
+ * Every pooled class that is default constructible and not a template also gets a benchmark
+ * comparing the pool with the global allocator in the generated project.
+ */
+namespace PoolGenerator
+{
+    /// Name of the support header declaring ObjectPool, relative to include/.
+    inline constexpr const char *SUPPORT_HEADER = "ObjectPool.h";
+
+    /**
+     * @brief Generates the in-class `operator new` and `operator delete` of a pooled class.
+     *
+     * The operators are defined in-class so that allocation inlines into every new-expression.
+     * Objects of a derived class of another size fall back to the global allocator.
+     *
+     * @param cl The class model.
+     * @return The operators, or an empty string if the class is not pooled.
+     */
+    std::string generatePoolDeclarations(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Collects the headers the pooled operators need.
+     *
+     * @param cl The class model.
+     * @return The headers, including the quoted support header, or an empty set if the class is not pooled.
+     */
+    std::set<std::string> requiredHeaders(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Generates the support header declaring ObjectPool.
+     *
+     * @return The complete header content.
+     */
+    std::string generateSupportHeader();
+
+    /**
+     * @brief Reports whether a benchmark is generated for a class.
+     *
+     * The benchmark allocates objects without arguments, so the class must be default constructible
+     * and not a template.
+     *
+     * @param cl The class model.
+     */
+    bool hasBenchmark(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Returns the name of a class's pool benchmark executable.
+     *
+     * @param qualifiedName The class name qualified by its namespaces, e.g. "Core::Order".
+     * @return The name with the namespace separators removed, followed by "PoolBenchmark".
+     */
+    std::string benchmarkName(const std::string &qualifiedName);
+
+    /**
+     * @brief Generates a benchmark comparing the pool with the global allocator.
+     *
+     * The benchmark repeatedly allocates a batch of objects and frees them again, once through the
+     * class's pooled operators and once through `::new` and `::delete`, and prints nanoseconds per
+     * allocation and free for each.
+     *
+     * @param qualifiedName The class name qualified by its namespaces, e.g. "Core::Order".
+     * @param header The file name of the header declaring the class.
+     * @return The benchmark source.
+     */
+    std::string generateBenchmark(const std::string &qualifiedName, const std::string &header);
+
+} // namespace PoolGenerator
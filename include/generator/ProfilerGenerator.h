@@ -0,0 +1,63 @@
+/**
+ * @file ProfilerGenerator.h
+ * @brief Functions to generate the built-in profiling library of a scaffolded project.
+ */
+
+#pragma once
+
+#include <string>
+
+/**
+ * @namespace ProfilerGenerator
+ * @brief Generates the `profiling` library added to projects with `profiler = true`.
+ *
+ * The library records completed scopes into lock-free per-thread ring buffers, and a session
+ * drains them from a background thread into a Chrome trace JSON file, together with samples of
+ * named counters and summaries of named histograms. The generated main.cpp opens a session for
+ * the lifetime of main() and, when the project is instrumented and its tracing macro is defined,
+ * routes every TRACE_SCOPE to the profiler.
+ */
+namespace ProfilerGenerator
+{
+    /// Name of the profiling library target, and of its folder under include/ and src/.
+    inline constexpr const char *LIBRARY_NAME = "profiling";
+
+    /// Path of the profiling header, relative to include/.
+    inline constexpr const char *HEADER = "profiling/Profiler.h";
+
+    /// Path of the profiling source, relative to src/.
+    inline constexpr const char *SOURCE = "profiling/Profiler.cpp";
+
+    /**
+     * @brief Returns the file the generated main.cpp streams its trace to.
+     *
+     * @param projectName The name of the project.
+     * @return The project name followed by ".trace.json", relative to the working directory.
+     */
+    std::string traceFileName(const std::string &projectName);
+
+    /**
+     * @brief Generates the profiling header declaring recordScope, Counter, Histogram and Session.
+     *
+     * @return The complete header content.
+     */
+    std::string generateHeader();
+
+    /**
+     * @brief Generates the profiling source implementing the ring buffers and the trace writer.
+     *
+     * @return The complete source content.
+     */
+    std::string generateSource();
+
+    /**
+     * @brief Generates the statements opening main() that install the profiler.
+     *
+     * @param projectName The name of the project.
+     * @param tracing True if the project has instrumented callables, whose trace scopes are then
+     *                routed to the profiler whenever the project's tracing macro is defined.
+     * @return The statements, indented for the body of main() and ending in a newline.
+     */
+    std::string generateMainSetup(const std::string &projectName, const bool tracing);
+
+} // namespace ProfilerGenerator
@@ -12,6 +12,9 @@
 
 #pragma once
 
+#include "CodeGroupModels.h"
+
+#include <set>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -45,20 +48,33 @@ namespace ProjectMetadata
         bool isProjLevel;                        ///< True if the library is at the project (top) level.
         std::vector<std::string> dependencies;   ///< A list of dependencies for the library.
         std::vector<std::string> subDirectories; ///< A list of nested folders for CMake file generation.
+        bool isHeaderOnly;                       ///< True if the library is emitted header-only (INTERFACE target).
+        std::vector<std::string> translationUnits; ///< Base paths (no extension) of every generated source file.
+        std::vector<std::string> headers;          ///< Base paths (no extension) of every generated header file.
+        std::vector<std::string> templateFiles;    ///< Base paths (no extension) of every generated .tpp file.
+        bool instrument;                           ///< True if every callable body in the library opens with a trace scope.
+        std::string version;                       ///< The library version from the DSL; empty if none was given.
 
         /**
          * @brief Default constructor for LibraryMetadata.
          *
          * This constructor initializes the library metadata with default values.
-         * It sets the relative path and name to empty strings, the isProjLevel flag to false,
-         * and leaves both the dependencies and subDirectories vectors empty.
+         * It sets the relative path and name to empty strings, the isProjLevel, isHeaderOnly and instrument
+         * flags to false, leaves the dependencies, subDirectories, translationUnits, headers and templateFiles vectors empty
+         * and the version unset.
          */
         LibraryMetadata()
             : relativePath(""),
               name(""),
               isProjLevel(false),
               dependencies(),
-              subDirectories()
+              subDirectories(),
+              isHeaderOnly(false),
+              translationUnits(),
+              headers(),
+              templateFiles(),
+              instrument(false),
+              version("")
         {
         }
 
@@ -71,25 +87,67 @@ namespace ProjectMetadata
          * @param name The name of the library.
          * @param isProjLevel True if this library is at the project level.
          * @param dependencies A vector of dependencies for the library.
+         * @param isHeaderOnly True if the library is emitted header-only. Defaults to false.
+         * @param instrument True if every callable body in the library opens with a trace scope. Defaults to false.
+         * @param version The library version. Defaults to none.
          */
-        LibraryMetadata(const std::string relativePath, const std::string name, const bool isProjLevel, const std::vector<std::string> dependencies)
+        LibraryMetadata(const std::string relativePath, const std::string name, const bool isProjLevel, const std::vector<std::string> dependencies,
+                        const bool isHeaderOnly = false, const bool instrument = false, const std::string version = "")
             : relativePath(std::move(relativePath)),
               name(std::move(name)),
               isProjLevel(isProjLevel),
               dependencies(std::move(dependencies)),
-              subDirectories({this->relativePath})
+              subDirectories({this->relativePath}),
+              isHeaderOnly(isHeaderOnly),
+              translationUnits(),
+              headers(),
+              templateFiles(),
+              instrument(instrument),
+              version(std::move(version))
         {
         }
     };
 
+    /**
+     * @brief A project file generated outside the directory tree, e.g. a shared runtime header or a test.
+     */
+    struct SupportFile
+    {
+        std::string relativePath; ///< Path relative to the project root, e.g. "include/BinarySerialization.h".
+        std::string content;      ///< The complete file content.
+    };
+
+    /**
+     * @brief Represents a generated test or benchmark executable.
+     *
+     * Tests exercise the code generated for one file of the directory tree, so they link the library
+     * owning that file, or the project-level sources when it belongs to the project level.
+     */
+    struct TestMetadata
+    {
+        std::string name;            ///< The executable and test name.
+        std::string source;          ///< The test source, relative to the project root.
+        std::string library;         ///< The name of the library owning the tested file.
+        bool isProjLevel;            ///< True if the tested file belongs to the project level.
+        bool isBenchmark;            ///< True for benchmarks, which are labelled "benchmark".
+    };
+
     /**
      * @brief Represents overall project metadata.
      *
-     * This structure aggregates project-wide information, mapping library names to their metadata.
+     * This structure aggregates project-wide information, mapping library names to their metadata,
+     * together with the project-wide generation options copied from the project model, the files
+     * generated outside the directory tree and the tests built from them.
      */
     struct ProjMetadata
     {
         std::unordered_map<std::string, LibraryMetadata> libraries; ///< Metadata for each library in the project.
+        CodeGroupModels::ProjectOptions options{};                   ///< Project-wide generation options.
+        std::vector<SupportFile> supportFiles{};                     ///< Files generated outside the directory tree.
+        std::vector<TestMetadata> tests{};                           ///< Generated tests and benchmarks.
+        bool tracing = false;                                        ///< True if any generated body opens with a trace scope.
+        bool ownCacheline = false;                                   ///< True if any class has an `@own_cacheline` member.
+        std::set<std::string> enums{};                               ///< Names of every DSL enum, which parameters take by value.
     };
 
 } // namespace ProjectMetadata
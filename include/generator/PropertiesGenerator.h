@@ -18,6 +18,7 @@
 
 #include "PropertiesModels.h"
 
+#include <set>
 #include <vector>
 #include <string>
 
@@ -58,4 +59,15 @@ namespace PropertiesGenerator
      */
     std::string generateDeclarationSpecifier(const PropertiesModels::DeclartionSpecifier &dS, const bool def = false);
 
+    /**
+     * @brief Collects the standard headers a parameter list depends on.
+     *
+     * Only std::string_view (e.g. from the string_view passing convention) needs a header beyond
+     * the common preamble.
+     *
+     * @param params The parameters of a callable or constructor.
+     * @return The headers to include, in angle-bracket form.
+     */
+    std::set<std::string> requiredHeaders(const std::vector<PropertiesModels::Parameter> &params);
+
 } // namespace PropertiesGenerator
@@ -0,0 +1,51 @@
+/**
+ * @file ReflectionGenerator.h
+ * @brief Functions to generate compile-time reflection metadata for classes.
+ */
+
+#pragma once
+
+#include "ClassModels.h"
+
+#include <set>
+#include <string>
+
+/**
+ * @namespace ReflectionGenerator
+ * @brief Generates `static constexpr auto fields()` for classes with `reflect = true`.
+ *
+ * fields() returns a std::tuple with one `reflection::FieldDescriptor` per data member, in
+ * declaration order, holding the member's name, its type as written, a pointer to the member and
+ * its access. The descriptor type and the helpers iterating it (forEachField, fieldCount and
+ * fieldIndex) live in a support header generated once per project, so generic code such as
+ * serialisers, loggers and ORM mappers can walk the members at compile time without a registry.
+ */
+namespace ReflectionGenerator
+{
+    /// Name of the support header declaring FieldDescriptor, relative to include/.
+    inline constexpr const char *SUPPORT_HEADER = "Reflection.h";
+
+    /**
+     * @brief Generates the in-class `fields()` descriptor table.
+     *
+     * @param cl The class model, with its members in emission order.
+     * @return The declaration with its body, or an empty string if the class is not reflected.
+     */
+    std::string generateReflectionDeclarations(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Collects the headers the descriptor table needs.
+     *
+     * @param cl The class model.
+     * @return The headers, including the quoted support header, or an empty set if the class is not reflected.
+     */
+    std::set<std::string> requiredHeaders(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Generates the support header declaring FieldDescriptor and its helpers.
+     *
+     * @return The complete header content.
+     */
+    std::string generateSupportHeader();
+
+} // namespace ReflectionGenerator
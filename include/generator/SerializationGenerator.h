@@ -0,0 +1,142 @@
+/**
+ * @file SerializationGenerator.h
+ * @brief Functions to generate binary serialisation members for classes, with their runtime support and tests.
+ */
+
+#pragma once
+
+#include "ClassModels.h"
+
+#include <cstdint>
+#include <set>
+#include <string>
+
+/**
+ * @namespace SerializationGenerator
+ * @brief Generates `serialize()` and `deserialize()` members for classes with `serialize = binary`.
+ *
+ * The members write to and read from the BinaryWriter and BinaryReader of a support header
+ * generated once per project. Each stream starts with the class's layout version, a hash of the
+ * name, type and order of its serialised members, so data written by another layout is rejected.
+ * Adjacent members of builtin arithmetic type, including fixed arrays of them, form runs that are
+ * copied with std::memcpy into a single reserved block; strings and containers are prefixed with
+ * their element count. Pointer members are not serialised, as addresses do not survive a round trip.
+ *
+ * Every serialisable class that is default constructible and not a template also gets a round-trip
+ * test and a throughput benchmark in the generated project.
+ */
+namespace SerializationGenerator
+{
+    /// Name of the support header declaring BinaryWriter and BinaryReader, relative to include/.
+    inline constexpr const char *SUPPORT_HEADER = "BinarySerialization.h";
+
+    /**
+     * @brief Reports whether a class asks for serialisation members.
+     *
+     * @param cl The class model.
+     */
+    bool isSerializable(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Computes the layout version of a class's serialised members.
+     *
+     * The version is the 32-bit FNV-1a hash of the type and name of every serialised member in
+     * emission order, so it changes whenever the stream layout does.
+     *
+     * @param cl The class model, with its members in emission order.
+     * @return The layout version.
+     */
+    std::uint32_t layoutVersion(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Generates the in-class `serializationVersion` constant and member declarations.
+     *
+     * @param cl The class model, with its members in emission order.
+     * @return The declarations, or an empty string if the class is not serialisable.
+     */
+    std::string generateSerializationDeclarations(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Generates the `serialize()` and `deserialize()` definitions.
+     *
+     * The bodies are complete and need no implementation.
+     *
+     * @param cl The class model, with its members in emission order.
+     * @param className The class name, with its template arguments for class templates (e.g. "Buffer<T>").
+     * @param inlineDef True to prefix the definitions with `inline` for header-only output.
+     * @param prefix Text emitted before each definition, e.g. the class's template head.
+     * @return The definitions, or an empty string if the class is not serialisable.
+     */
+    std::string generateSerializationDefinitions(const ClassModels::ClassModel &cl, const std::string &className,
+                                                 const bool inlineDef = false, const std::string &prefix = "");
+
+    /**
+     * @brief Collects the headers the serialisation members need.
+     *
+     * @param cl The class model.
+     * @return The headers, including the quoted support header, or an empty set if the class is not serialisable.
+     */
+    std::set<std::string> requiredHeaders(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Generates the support header declaring BinaryWriter and BinaryReader.
+     *
+     * @return The complete header content.
+     */
+    std::string generateSupportHeader();
+
+    /**
+     * @brief Reports whether a round-trip test and benchmark are generated for a class.
+     *
+     * The test and benchmark need an object to work on, so the class must be default constructible
+     * (no constructors, a default constructor or an allocator-aware class) and not a template.
+     *
+     * @param cl The class model.
+     */
+    bool hasRoundTripTest(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Returns the name of a class's round-trip test executable.
+     *
+     * @param qualifiedName The class name qualified by its namespaces, e.g. "Core::Record".
+     * @return The name with the namespace separators removed, followed by "SerializationTest".
+     */
+    std::string testName(const std::string &qualifiedName);
+
+    /**
+     * @brief Returns the name of a class's benchmark executable.
+     *
+     * @param qualifiedName The class name qualified by its namespaces, e.g. "Core::Record".
+     * @return The name with the namespace separators removed, followed by "SerializationBenchmark".
+     */
+    std::string benchmarkName(const std::string &qualifiedName);
+
+    /**
+     * @brief Generates a self-contained round-trip test of a class's serialisation.
+     *
+     * The test writes a distinct value for every serialised member one at a time and checks that
+     * deserialising the stream and serialising the object again reproduces it byte for byte, which
+     * also checks the bulk-copied runs against the per-member encoding. Truncated streams and
+     * streams of another layout version must be rejected. The test returns non-zero on failure.
+     *
+     * @param cl The class model as declared in the DSL.
+     * @param qualifiedName The class name qualified by its namespaces, e.g. "Core::Record".
+     * @param header The file name of the header declaring the class.
+     * @return The test source.
+     */
+    std::string generateRoundTripTest(const ClassModels::ClassModel &cl, const std::string &qualifiedName,
+                                      const std::string &header);
+
+    /**
+     * @brief Generates a benchmark timing the serialisation of a class.
+     *
+     * The benchmark serialises a batch of objects into one buffer and deserialises them back,
+     * printing nanoseconds per object and throughput for each direction.
+     *
+     * @param qualifiedName The class name qualified by its namespaces, e.g. "Core::Record".
+     * @param header The file name of the header declaring the class.
+     * @return The benchmark source.
+     */
+    std::string generateBenchmark(const std::string &qualifiedName, const std::string &header);
+
+} // namespace SerializationGenerator
@@ -0,0 +1,50 @@
+/**
+ * @file SoaGenerator.h
+ * @brief Functions to generate struct-of-arrays companion containers for classes.
+ */
+
+#pragma once
+
+#include "ClassModels.h"
+
+#include <set>
+#include <string>
+
+/**
+ * @namespace SoaGenerator
+ * @brief Generates the `<Class>SoA` container of classes with `soa = true`.
+ *
+ * The container stores each public member of the class in its own std::vector, so that a loop
+ * over one member reads contiguous memory the compiler can vectorise. Elements are appended
+ * from class instances and accessed through proxies holding a reference to each member, while
+ * whole columns are exposed as std::span.
+ */
+namespace SoaGenerator
+{
+    /**
+     * @brief Returns the name of a class's struct-of-arrays container.
+     *
+     * @param cl The class model.
+     * @return The class name followed by "SoA".
+     */
+    std::string soaName(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Generates the struct-of-arrays container declaration, defined in-class.
+     *
+     * Class templates get a container template with the same parameters.
+     *
+     * @param cl The class model.
+     * @return The container declaration, or an empty string if the class does not ask for one.
+     */
+    std::string generateSoaDeclaration(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Collects the standard headers the struct-of-arrays container needs.
+     *
+     * @param cl The class model.
+     * @return The headers, or an empty set if the class does not ask for a container.
+     */
+    std::set<std::string> requiredHeaders(const ClassModels::ClassModel &cl);
+
+} // namespace SoaGenerator
@@ -6,6 +6,9 @@
 
 #include "ClassModels.h"
 
+#include <string>
+#include <vector>
+
 /**
  * @namespace SpecialMemberGenerator
  * @brief Contains functions for generating code related to special member functions (constructors)
@@ -13,6 +16,40 @@
  */
 namespace SpecialMemberGenerator
 {
+    /**
+     * @brief Infers the exception specification of a special member from the class's member types.
+     *
+     * Builtin types, strings, pointers and references never throw when default constructed or
+     * moved, so a class made only of them gets a plain `noexcept`. Members of custom type make
+     * the specification conditional on the given trait holding for each such type, e.g.
+     *     noexcept(std::is_nothrow_move_constructible_v<Buffer>)
+     *
+     * @param members All data members of the class.
+     * @param trait The type trait without its std:: prefix and _v suffix.
+     * @return The specification with a leading space.
+     */
+    std::string generateNoexceptSpecifier(const std::vector<PropertiesModels::Parameter> &members, const std::string &trait);
+
+    /**
+     * @brief Reports whether member-wise copy and move are correct for a class.
+     *
+     * Raw pointer members may own their pointee and reference members cannot be reassigned, so
+     * either one means the copy and move members need a hand-written implementation.
+     *
+     * @param members All data members of the class.
+     * @return True if the copy and move members can be declared `= default`.
+     */
+    bool isMemberwise(const std::vector<PropertiesModels::Parameter> &members);
+
+    /**
+     * @brief Reports whether a constructor moves any of its parameters into members.
+     *
+     * @param ctor The constructor model.
+     * @param members All data members of the class.
+     * @return True if the constructor definition uses std::move.
+     */
+    bool movesParameters(const ClassModels::Constructor &ctor, const std::vector<PropertiesModels::Parameter> &members);
+
     /**
      * @brief Generates the constructor declaration for a class.
      *
@@ -20,13 +57,22 @@ namespace SpecialMemberGenerator
      * It supports custom, copy, move, and default constructors. For default constructors, additional
      * declarations for the copy and move constructors are also generated.
      *
+     * An explicit `noexcept` on the constructor model is emitted as given. Otherwise default and
+     * move constructors infer it from the members (see generateNoexceptSpecifier()).
+     *
      * @param className The name of the class.
      * @param ctor The constructor model containing type, parameters, and description.
+     * @param members All data members of the class, used to infer noexcept.
+     * @param defaulted True to declare copy and move constructors `= default`, which then need no definition.
+     * @param allocatorExtended True if the class is allocator-aware; custom constructors with parameters
+     *                          then take a trailing `const allocator_type& alloc = {}`.
      * @return A string containing the generated constructor declaration(s).
      *
      * @exception std::runtime_error if an unrecognised constructor type is provided.
      */
-    std::string generateConstructorDeclaration(const std::string &className, const ClassModels::Constructor &ctor);
+    std::string generateConstructorDeclaration(const std::string &className, const ClassModels::Constructor &ctor,
+                                               const std::vector<PropertiesModels::Parameter> &members = {},
+                                               const bool defaulted = false, const bool allocatorExtended = false);
 
     /**
      * @brief Generates the constructor definition for a class.
@@ -35,14 +81,23 @@ namespace SpecialMemberGenerator
      * provided constructor model and the members defined in various access specifier groups.
      *
      * For a custom constructor, the parameters are used along with an initializer list for all members.
+     * Members with a same-named parameter are initialised from it, moving non-const by-value strings
+     * and custom types; the rest are value-initialised. If every parameter initialises a member the
+     * constructor is complete and gets an empty body instead of a placeholder.
      * For copy and move constructors, the definition includes an initializer list based on the members.
      * For a default constructor, no definition is generated since the compiler will generate it automatically.
+     * The exception specification matches generateConstructorDeclaration(); unconditionally noexcept
+     * stubs, and all stubs of exception-free projects, call std::terminate() instead of throwing.
      *
-     * @param className The name of the class.
+     * @param className The name of the class, with its template arguments for class templates (e.g. "Buffer<T>").
      * @param ctor The constructor model containing type, parameters, and description.
      * @param publicMembers A vector of public member parameters.
      * @param privateMembers A vector of private member parameters.
      * @param protectedMembers A vector of protected member parameters.
+     * @param inlineDef Optional flag to prefix the definition with `inline` for header-only output.
+     * @param allocatorExtended True if the class is allocator-aware; custom constructors with parameters
+     *                          then take a trailing allocator and pass it to allocator-aware members.
+     * @param exceptionFree True if the project reports errors through std::expected.
      * @return A string containing the generated constructor definition.
      *
      * @exception std::runtime_error if an unrecognised constructor type is provided.
@@ -50,7 +105,9 @@ namespace SpecialMemberGenerator
     std::string generateConstructorDefinition(const std::string &className, const ClassModels::Constructor &ctor,
                                               const std::vector<PropertiesModels::Parameter> publicMembers,
                                               const std::vector<PropertiesModels::Parameter> privateMembers,
-                                              const std::vector<PropertiesModels::Parameter> protectedMembers);
+                                              const std::vector<PropertiesModels::Parameter> protectedMembers,
+                                              const bool inlineDef = false, const bool allocatorExtended = false,
+                                              const bool exceptionFree = false);
 
     /**
      * @brief Generates the destructor declaration.
@@ -81,11 +138,16 @@ namespace SpecialMemberGenerator
      * This function produces the declaration for the move assignment operator.
      * The generated declaration is of the form:
      *     MyClass& operator=(MyClass&& other) noexcept;
+     * where noexcept is inferred from the members (see generateNoexceptSpecifier()).
      *
      * @param className The name of the class.
+     * @param members All data members of the class, used to infer noexcept.
+     * @param defaulted True to declare the operator `= default`, which then needs no definition.
      * @return A string containing the move assignment operator declaration.
      */
-    std::string generateMoveAssignmentDeclaration(const std::string &className);
+    std::string generateMoveAssignmentDeclaration(const std::string &className,
+                                                  const std::vector<PropertiesModels::Parameter> &members = {},
+                                                  const bool defaulted = false);
 
     /**
      * @brief Generates the move assignment operator definition.
@@ -94,13 +156,19 @@ namespace SpecialMemberGenerator
      * body that throws a runtime error indicating the method is not yet implemented.
      * The generated definition is of the form:
      *     MyClass& MyClass::operator=(MyClass&& other) noexcept {
-     *         throw std::runtime_error("Not implemented");
+     *         std::terminate(); // Not implemented
      *     }
+     * A conditional noexcept keeps the throwing placeholder.
      *
      * @param className The name of the class.
+     * @param inlineDef Optional flag to prefix the definition with `inline` for header-only output.
+     * @param members All data members of the class, used to infer noexcept.
+     * @param exceptionFree True if the project reports errors through std::expected; the placeholder then terminates.
      * @return A string containing the move assignment operator definition.
      */
-    std::string generateMoveAssignmentDefinition(const std::string &className);
+    std::string generateMoveAssignmentDefinition(const std::string &className, const bool inlineDef = false,
+                                                 const std::vector<PropertiesModels::Parameter> &members = {},
+                                                 const bool exceptionFree = false);
 
     /**
      * @brief Generates the copy assignment operator declaration.
@@ -110,9 +178,10 @@ namespace SpecialMemberGenerator
      *     MyClass& operator=(const MyClass& other);
      *
      * @param className The name of the class.
+     * @param defaulted True to declare the operator `= default`, which then needs no definition.
      * @return A string containing the copy assignment operator declaration.
      */
-    std::string generateCopyAssignmentDeclaration(const std::string &className);
+    std::string generateCopyAssignmentDeclaration(const std::string &className, const bool defaulted = false);
 
     /**
      * @brief Generates the copy assignment operator definition.
@@ -125,8 +194,38 @@ namespace SpecialMemberGenerator
      *     }
      *
      * @param className The name of the class.
+     * @param inlineDef Optional flag to prefix the definition with `inline` for header-only output.
+     * @param exceptionFree True if the project reports errors through std::expected; the placeholder then terminates.
      * @return A string containing the copy assignment operator definition.
      */
-    std::string generateCopyAssignmentDefinition(const std::string &className);
+    std::string generateCopyAssignmentDefinition(const std::string &className, const bool inlineDef = false,
+                                                 const bool exceptionFree = false);
+
+    /**
+     * @brief Generates the declaration of the `create()` factory of a custom constructor.
+     *
+     * Constructors cannot return an error, so exception-free projects construct through a static
+     * factory taking the constructor's parameters and returning std::expected:
+     *     static std::expected<MyClass, errors::Error> create(int id);
+     *
+     * @param className The name of the class.
+     * @param ctor The constructor model.
+     * @return The declaration, or an empty string if the constructor is not a custom constructor.
+     */
+    std::string generateFactoryDeclaration(const std::string &className, const ClassModels::Constructor &ctor);
+
+    /**
+     * @brief Generates the definition of the `create()` factory of a custom constructor.
+     *
+     * The placeholder body constructs the object in place from the arguments, moving those the
+     * constructor moves into members, and leaves their validation as a TODO.
+     *
+     * @param className The name of the class, with its template arguments for class templates (e.g. "Buffer<T>").
+     * @param ctor The constructor model.
+     * @param inlineDef Optional flag to prefix the definition with `inline` for header-only output.
+     * @return The definition, or an empty string if the constructor is not a custom constructor.
+     */
+    std::string generateFactoryDefinition(const std::string &className, const ClassModels::Constructor &ctor,
+                                          const bool inlineDef = false);
 
 } // namespace SpecialMemberGenerator
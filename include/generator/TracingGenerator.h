@@ -0,0 +1,134 @@
+/**
+ * @file TracingGenerator.h
+ * @brief Functions to instrument generated callable bodies with trace scopes.
+ */
+
+#pragma once
+
+#include "CallableModels.h"
+#include "ClassModels.h"
+#include "CodeGroupModels.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * @namespace TracingGenerator
+ * @brief Resolves which callables are instrumented and generates the tracing support header.
+ *
+ * `instrument = true` may be set on a project, library, class, method or function, and applies
+ * to every callable below it. Instrumented bodies open with `TRACE_SCOPE("Class::method");`,
+ * declared in a support header generated once per project. The macro expands to nothing unless
+ * `<PROJECT>_ENABLE_TRACING` is defined, so instrumentation costs nothing when it is off.
+ *
+ * constexpr and consteval callables are never instrumented, as their bodies may run at compile time.
+ */
+namespace TracingGenerator
+{
+    /// Name of the support header declaring TRACE_SCOPE, relative to include/.
+    inline constexpr const char *SUPPORT_HEADER = "Tracing.h";
+
+    /**
+     * @brief Returns the macro, and CMake option, that compiles the trace scopes of a project.
+     *
+     * @param projectName The name of the project.
+     * @return The upper-cased project name followed by "_ENABLE_TRACING", e.g. "MYPROJECT_ENABLE_TRACING".
+     */
+    std::string optionName(const std::string &projectName);
+
+    /**
+     * @brief Reports whether a callable's body opens with a trace scope.
+     *
+     * @param callable The callable model, after applyInstrumentation().
+     */
+    bool isInstrumented(const CallableModels::CallableModel &callable);
+
+    /**
+     * @brief Generates the statement opening an instrumented body.
+     *
+     * @param callable The callable model, after applyInstrumentation().
+     * @param scopeName The name the scope is reported under, e.g. "Order::submit".
+     * @return The statement, without indentation or trailing newline, or an empty string if the
+     *         callable is not instrumented.
+     */
+    std::string traceStatement(const CallableModels::CallableModel &callable, const std::string &scopeName);
+
+    /**
+     * @brief Marks the methods of a class as instrumented if the class or an enclosing scope asks for it.
+     *
+     * @param cl The class model.
+     * @param inherited True if the enclosing library or project is instrumented.
+     * @return A copy of the class with resolved method flags.
+     */
+    ClassModels::ClassModel applyInstrumentation(const ClassModels::ClassModel &cl, const bool inherited);
+
+    /**
+     * @brief Resolves the instrumentation of every class and function of a namespace, recursively.
+     *
+     * @param ns The namespace model.
+     * @param inherited True if the enclosing library or project is instrumented.
+     * @return A copy of the namespace with resolved callable flags.
+     */
+    CodeGroupModels::NamespaceModel applyInstrumentation(const CodeGroupModels::NamespaceModel &ns, const bool inherited);
+
+    /**
+     * @brief Resolves the instrumentation of a file of free functions.
+     *
+     * @param functions The function models.
+     * @param inherited True if the enclosing library or project is instrumented.
+     * @return A copy of the functions with resolved flags.
+     */
+    std::vector<CallableModels::FunctionModel> applyInstrumentation(const std::vector<CallableModels::FunctionModel> &functions,
+                                                                    const bool inherited);
+
+    /**
+     * @brief Resolves the instrumentation of a file of merged classes.
+     *
+     * @param classes The class models.
+     * @param inherited True if the enclosing library or project is instrumented.
+     * @return A copy of the classes with resolved method flags.
+     */
+    std::vector<ClassModels::ClassModel> applyInstrumentation(const std::vector<ClassModels::ClassModel> &classes,
+                                                              const bool inherited);
+
+    /**
+     * @brief Reports whether any method of a class is instrumented.
+     *
+     * @param cl The class model, after applyInstrumentation().
+     */
+    bool hasTraceScopes(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Reports whether any callable of a namespace is instrumented, recursively.
+     *
+     * @param ns The namespace model, after applyInstrumentation().
+     */
+    bool hasTraceScopes(const CodeGroupModels::NamespaceModel &ns);
+
+    /**
+     * @brief Reports whether any function of a file of free functions is instrumented.
+     *
+     * @param functions The function models, after applyInstrumentation().
+     */
+    bool hasTraceScopes(const std::vector<CallableModels::FunctionModel> &functions);
+
+    /**
+     * @brief Reports whether any method of a file of merged classes is instrumented.
+     *
+     * @param classes The class models, after applyInstrumentation().
+     */
+    bool hasTraceScopes(const std::vector<ClassModels::ClassModel> &classes);
+
+    /**
+     * @brief Generates the support header declaring TRACE_SCOPE.
+     *
+     * When the project's tracing macro is defined, each scope times itself with
+     * std::chrono::steady_clock and reports to a replaceable handler that writes to std::clog
+     * by default; otherwise TRACE_SCOPE expands to nothing.
+     *
+     * @param projectName The name of the project.
+     * @return The complete header content.
+     */
+    std::string generateSupportHeader(const std::string &projectName);
+
+} // namespace TracingGenerator
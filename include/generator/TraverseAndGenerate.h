@@ -34,8 +34,10 @@ namespace FileGeneration
      * This function performs a depth-first traversal of the directory tree. For each
      * directory node, it iterates over its file nodes, invokes the generateFiles() method
      * to obtain file contents, and writes the header and source files using the provided
-     * IFileWriter instance. The generated base file path is assumed to start with "ROOT/",
-     * which will be removed by the file writer implementation.
+     * IFileWriter instance. Header-only file nodes produce no source file, and nodes with
+     * template definitions also produce a .tpp file. The generated base
+     * file path is assumed to start with "ROOT/", which will be removed by the file writer
+     * implementation.
      *
      * @param node A shared pointer to the current DirectoryNode.
      * @param writer A reference to an implementation of IFileWriter used to write files.
@@ -0,0 +1,135 @@
+/**
+ * @file ValueGenerator.h
+ * @brief Functions to generate comparison and hashing for value classes, with their runtime support and tests.
+ */
+
+#pragma once
+
+#include "ClassModels.h"
+
+#include <set>
+#include <string>
+
+/**
+ * @namespace ValueGenerator
+ * @brief Generates comparison operators and a std::hash specialisation for classes with `value = true`.
+ *
+ * The class gets defaulted `operator<=>` and `operator==`, comparing the data members in
+ * declaration order, and a `hash()` member combining the hashes of the same members with the
+ * splitmix64 mixer of a support header generated once per project. A `std::hash` specialisation
+ * calling `hash()` follows the declarations at global scope, so the class can key unordered
+ * containers as well as sorted ones without hand-written hash functions.
+ *
+ * Every value class that is default constructible and not a template also gets a test of the
+ * operators and hash in the generated project, and a hash-quality benchmark when it has a public
+ * integral member to vary.
+ */
+namespace ValueGenerator
+{
+    /// Name of the support header declaring the hash mixer, relative to include/.
+    inline constexpr const char *SUPPORT_HEADER = "ValueHash.h";
+
+    /**
+     * @brief Generates the in-class comparison operators and `hash()` member.
+     *
+     * @param cl The class model, with its members in emission order.
+     * @return The declarations with their bodies, or an empty string if the class is not a value class.
+     */
+    std::string generateValueDeclarations(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Generates the `std::hash` specialisation of a class, to be emitted at global scope.
+     *
+     * Class templates get a partial specialisation for every set of template arguments.
+     *
+     * @param cl The class model.
+     * @param scope Optional qualification of the class name, e.g. "Outer::". Defaults to none.
+     * @return The specialisation preceded by a blank line, or an empty string if the class is not a value class.
+     */
+    std::string generateHashSpecialization(const ClassModels::ClassModel &cl, const std::string &scope = "");
+
+    /**
+     * @brief Collects the headers the operators and hash need.
+     *
+     * @param cl The class model.
+     * @return The headers, including the quoted support header, or an empty set if the class is not a value class.
+     */
+    std::set<std::string> requiredHeaders(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Generates the support header declaring the hash mixer and hashValue().
+     *
+     * @return The complete header content.
+     */
+    std::string generateSupportHeader();
+
+    /**
+     * @brief Reports whether a test of the operators and hash is generated for a class.
+     *
+     * The test needs an object to work on, so the class must be a value class, default
+     * constructible and not a template.
+     *
+     * @param cl The class model.
+     */
+    bool hasTest(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Reports whether a hash-quality benchmark is generated for a class.
+     *
+     * The benchmark builds distinct objects by varying one public member, so besides qualifying for
+     * the test the class needs a public, non-const integral member that is neither a pointer nor an array.
+     *
+     * @param cl The class model.
+     */
+    bool hasBenchmark(const ClassModels::ClassModel &cl);
+
+    /**
+     * @brief Returns the name of a class's test executable.
+     *
+     * @param qualifiedName The class name qualified by its namespaces, e.g. "Core::Order".
+     * @return The name with the namespace separators removed, followed by "ValueTest".
+     */
+    std::string testName(const std::string &qualifiedName);
+
+    /**
+     * @brief Returns the name of a class's benchmark executable.
+     *
+     * @param qualifiedName The class name qualified by its namespaces, e.g. "Core::Order".
+     * @return The name with the namespace separators removed, followed by "HashBenchmark".
+     */
+    std::string benchmarkName(const std::string &qualifiedName);
+
+    /**
+     * @brief Generates a self-contained test of a class's comparison operators and hash.
+     *
+     * A copy of a default-constructed object must compare equal, be equivalent under `<=>` when the
+     * members support it and hash equal. Changing any public builtin or string member must break
+     * equality and change the hash, and an unordered set must keep one of two equal objects. The
+     * test returns non-zero on failure.
+     *
+     * @param cl The class model as declared in the DSL.
+     * @param qualifiedName The class name qualified by its namespaces, e.g. "Core::Order".
+     * @param header The file name of the header declaring the class.
+     * @return The test source.
+     */
+    std::string generateTest(const ClassModels::ClassModel &cl, const std::string &qualifiedName, const std::string &header);
+
+    /**
+     * @brief Generates a benchmark measuring the distribution and speed of a class's hash.
+     *
+     * The benchmark hashes objects differing only in their first public integral member and
+     * reports the bucket occupancy of power-of-two tables indexed by the low and by the high bits
+     * of the hash, the average number of output bits flipped by flipping one input bit, and the
+     * time per hash. The same figures are printed for std::hash of the member alone for
+     * comparison. The benchmark returns non-zero if the occupancy or the avalanche is far from
+     * that of a random function.
+     *
+     * @param cl The class model as declared in the DSL.
+     * @param qualifiedName The class name qualified by its namespaces, e.g. "Core::Order".
+     * @param header The file name of the header declaring the class.
+     * @return The benchmark source.
+     */
+    std::string generateBenchmark(const ClassModels::ClassModel &cl, const std::string &qualifiedName,
+                                  const std::string &header);
+
+} // namespace ValueGenerator
@@ -43,6 +43,14 @@ namespace CallableModels
         PropertiesModels::DeclartionSpecifier declSpec;
         /// A description of the callable.
         std::string description;
+        /// True if the callable is declared noexcept.
+        bool isNoexcept;
+        /// Template parameters and explicit instantiations; empty for non-templates.
+        PropertiesModels::TemplateSpec templateSpec;
+        /// True if the callable's body opens with a trace scope.
+        bool instrument;
+        /// True if the project reports errors through std::expected rather than exceptions.
+        bool expected = false;
 
         /**
          * @brief Constructor for CallableModel.
@@ -55,13 +63,20 @@ namespace CallableModels
          * @param params A vector of parameters associated with the callable.
          * @param dC Declaration specifiers that modify the callable's behavior (e.g., inline, static).
          * @param desc Optional description of the callable. Defaults to a single space.
+         * @param noexceptSpec Optional flag to declare the callable noexcept. Defaults to false.
+         * @param tmpl Optional template parameters and instantiations. Defaults to a non-template.
+         * @param instrumented Optional flag to open the callable's body with a trace scope. Defaults to false.
          */
         CallableModel(const PropertiesModels::DataType retType, std::string n,
                       std::vector<PropertiesModels::Parameter> params,
                       const PropertiesModels::DeclartionSpecifier &dC,
-                      std::string desc = "")
+                      std::string desc = "",
+                      bool noexceptSpec = false,
+                      PropertiesModels::TemplateSpec tmpl = PropertiesModels::TemplateSpec(),
+                      bool instrumented = false)
             : returnType(retType), name(std::move(n)), parameters(std::move(params)),
-              declSpec(std::move(dC)), description(std::move(desc))
+              declSpec(std::move(dC)), description(std::move(desc)), isNoexcept(noexceptSpec),
+              templateSpec(std::move(tmpl)), instrument(instrumented)
         {
         }
     };
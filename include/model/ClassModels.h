@@ -68,6 +68,7 @@ namespace ClassModels
     {
         ConstructorType type;                                /**< The type of constructor */
         std::vector<PropertiesModels::Parameter> parameters; /**< Constructor parameters (empty for default, copy, or move) */
+        std::optional<bool> isNoexcept;                      /**< Explicit noexcept; unset to infer it (default and move) or omit it */
 
         /**
          * @brief Constructor for the Constructor model.
@@ -75,11 +76,13 @@ namespace ClassModels
          * @param type The type of constructor (default, copy, move, or custom).
          * @param params The parameters for the constructor. For non-custom constructors, this should be empty.
          * @param desc A description of the constructor.
+         * @param noexceptSpec Optional explicit noexcept. Defaults to unset.
          */
         Constructor(ConstructorType type,
                     const std::vector<PropertiesModels::Parameter> &params,
-                    const std::string &desc)
-            : SpecialMemberFunction(desc), type(type), parameters(params)
+                    const std::string &desc,
+                    std::optional<bool> noexceptSpec = std::nullopt)
+            : SpecialMemberFunction(desc), type(type), parameters(params), isNoexcept(noexceptSpec)
         {
         }
     };
@@ -105,6 +108,60 @@ namespace ClassModels
         Destructor &operator=(Destructor &&) = default;
     };
 
+    /**
+     * @brief Enumerates how data members are ordered within each access section.
+     */
+    enum class LayoutPolicy
+    {
+        DECLARED, /**< Members are emitted in DSL order (default) */
+        COMPACT   /**< Members are sorted by alignment and size to minimise padding */
+    };
+
+    /**
+     * @brief Enumerates how requested copy and move members are generated.
+     */
+    enum class SpecialMemberPolicy
+    {
+        DEFAULTED, /**< Declared `= default` when member-wise copy and move suffice (default) */
+        CUSTOM     /**< Always declared with out-of-line stubs to implement */
+    };
+
+    /**
+     * @brief Enumerates how the members of a class allocate memory.
+     */
+    enum class AllocatorPolicy
+    {
+        STD, /**< Members use their default allocators (default) */
+        PMR  /**< Members use std::pmr containers and the class is allocator-aware */
+    };
+
+    /**
+     * @brief Enumerates the serialisation code generated for a class.
+     */
+    enum class SerializationFormat
+    {
+        NONE,  /**< No serialisation members (default) */
+        BINARY /**< serialize()/deserialize() members using the generated binary writer and reader */
+    };
+
+    /**
+     * @brief Opt-in generation options set through class block properties.
+     */
+    struct ClassOptions
+    {
+        LayoutPolicy layout = LayoutPolicy::DECLARED;                        ///< Ordering of data members within access sections.
+        SpecialMemberPolicy specialMembers = SpecialMemberPolicy::DEFAULTED; ///< Generation of copy and move members.
+        bool triviallyCopyable = false;                                      ///< Assert std::is_trivially_copyable for the class.
+        AllocatorPolicy allocator = AllocatorPolicy::STD;                    ///< Allocation model of the data members.
+        bool soa = false;                                                    ///< Generate a <Class>SoA struct-of-arrays companion.
+        SerializationFormat serialize = SerializationFormat::NONE;           ///< Serialisation members to generate.
+        bool pooled = false;                                                 ///< Allocate instances from a per-class object pool.
+        bool instrument = false;                                             ///< Open every method body with a trace scope.
+        bool reflect = false;                                                ///< Generate a constexpr fields() descriptor table.
+        bool value = false;                                                  ///< Generate comparison operators and a std::hash specialisation.
+        bool expected = false;                                               ///< Stub without exceptions and add std::expected create() factories.
+    };
+
     /**
      * @brief Represents a C++ class as defined in the scaffolder DSL.
      *
@@ -133,6 +190,10 @@ namespace ClassModels
         bool hasCopyAssignment; /**< True if copy assignment operator should be generated */
         bool hasMoveAssignment; /**< True if move assignment operator should be generated */
 
+        ClassOptions options; /**< Opt-in generation options */
+
+        PropertiesModels::TemplateSpec templateSpec; /**< Template parameters and explicit instantiations; empty for non-templates */
+
         /**
          * @brief Constructor for ClassModel.
          *
@@ -148,6 +209,8 @@ namespace ClassModels
          * @param protMembers List of protected data members.
          * @param copyAssign Whether the copy assignment operator should be generated.
          * @param moveAssign Whether the move assignment operator should be generated.
+         * @param opts Opt-in generation options. Defaults to none.
+         * @param tmpl Template parameters and instantiations. Defaults to a non-template class.
          */
         ClassModel(
             const std::string &n,
@@ -161,7 +224,9 @@ namespace ClassModels
             const std::vector<PropertiesModels::Parameter> &privMembers,
             const std::vector<PropertiesModels::Parameter> &protMembers,
             bool copyAssign,
-            bool moveAssign)
+            bool moveAssign,
+            const ClassOptions &opts = ClassOptions(),
+            const PropertiesModels::TemplateSpec &tmpl = PropertiesModels::TemplateSpec())
             : name(n),
               description(desc),
               constructors(ctors),
@@ -173,7 +238,9 @@ namespace ClassModels
               privateMembers(privMembers),
               protectedMembers(protMembers),
               hasCopyAssignment(copyAssign),
-              hasMoveAssignment(moveAssign)
+              hasMoveAssignment(moveAssign),
+              options(opts),
+              templateSpec(tmpl)
         {
         }
     };
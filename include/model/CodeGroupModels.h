@@ -13,6 +13,7 @@
 #include "PropertiesModels.h"
 #include "CallableModels.h"
 #include "ClassModels.h"
+#include "EnumModels.h"
 
 #include <vector>
 #include <string>
@@ -31,7 +32,7 @@ namespace CodeGroupModels
     /**
      * @brief Represents a namespace in the code generation system.
      *
-     * This struct models a namespace that can contain nested classes and functions.
+     * This struct models a namespace that can contain nested classes, functions and enumerations.
      * Additional nested namespaces can be added if necessary.
      */
     struct NamespaceModel
@@ -41,6 +42,81 @@ namespace CodeGroupModels
         std::vector<ClassModels::ClassModel> classes;         ///< A list of classes defined within this namespace.
         std::vector<CallableModels::FunctionModel> functions; ///< A list of functions defined within this namespace.
         std::vector<NamespaceModel> namespaces;               ///< A list of nested namespaces.
+        std::vector<EnumModels::EnumModel> enums{};           ///< A list of enumerations, declared ahead of the classes.
+    };
+
+    /**
+     * @brief Enumerates how a library's code is packaged into build targets.
+     */
+    enum class LibraryMode
+    {
+        COMPILED,   /**< Declarations in headers, definitions in compiled source files (default) */
+        HEADER_ONLY /**< All definitions emitted inline in headers; built as an INTERFACE target */
+    };
+
+    /**
+     * @brief Enumerates how the generated CMake build is laid out.
+     */
+    enum class CMakeLayout
+    {
+        MONOLITHIC, /**< Every target is declared in the single top-level CMakeLists.txt (default) */
+        SUBPROJECTS /**< Each library gets its own CMakeLists.txt, added via add_subdirectory with exported targets */
+    };
+
+    /**
+     * @brief Enumerates which build systems the generated project is configured for.
+     */
+    enum class BuildSystem
+    {
+        CMAKE, /**< CMakeLists.txt, presets and CMake-driven VS Code tasks (default) */
+        BAZEL, /**< BUILD.bazel and MODULE.bazel instead of CMake */
+        BOTH   /**< CMake and Bazel files side by side */
+    };
+
+    /**
+     * @brief Enumerates how DSL elements are distributed over translation units.
+     */
+    enum class TuGranularity
+    {
+        PER_ENTITY, /**< One file per class, per namespace and per folder of free functions (default) */
+        SPLIT,      /**< Additionally split every namespace into one file per class */
+        BALANCED    /**< Split oversized namespaces, merge tiny classes and chunk functions to an even TU cost */
+    };
+
+    /**
+     * @brief Enumerates how callable parameters are passed in generated signatures.
+     */
+    enum class PassingConvention
+    {
+        DECLARED,   /**< Parameters are passed exactly as declared in the DSL (default) */
+        CONST_REF,  /**< Cheap builtins by value, strings and custom types by const reference */
+        STRING_VIEW /**< As CONST_REF, but strings as std::string_view */
+    };
+
+    /**
+     * @brief Enumerates how generated callables report errors.
+     */
+    enum class ErrorHandling
+    {
+        EXCEPTIONS, /**< Stubs throw std::runtime_error (default) */
+        EXPECTED    /**< Callables return std::expected and the project builds with -fno-exceptions */
+    };
+
+    /**
+     * @brief Project-wide generation options set through project block properties.
+     */
+    struct ProjectOptions
+    {
+        BuildSystem buildSystem = BuildSystem::CMAKE;            ///< Build systems to generate files for.
+        CMakeLayout cmakeLayout = CMakeLayout::MONOLITHIC;       ///< Layout of the generated CMake build.
+        TuGranularity granularity = TuGranularity::PER_ENTITY;   ///< Translation unit granularity policy.
+        size_t maxFunctionsPerFile = 0;                          ///< Cap on free functions per file, 0 for no cap.
+        size_t targetTuCost = 24;                                ///< Estimated cost each balanced translation unit aims for.
+        bool profilingTools = false;                             ///< Whether profiling tasks and launch configs are generated.
+        PassingConvention passing = PassingConvention::DECLARED; ///< Convention for callable parameters.
+        bool instrument = false;                                 ///< Whether every callable body opens with a trace scope.
+        bool profiler = false;                                   ///< Whether the built-in profiling library is generated.
+        ErrorHandling errors = ErrorHandling::EXCEPTIONS;        ///< How generated callables report errors.
     };
 
     /**
@@ -127,6 +203,10 @@ namespace CodeGroupModels
         std::string version;
         /// A vector of dependencies (e.g., other libraries or build features such as Boost).
         std::vector<std::string> dependencies;
+        /// How the library is packaged (compiled sources or header-only).
+        LibraryMode mode;
+        /// Whether every callable body in the library opens with a trace scope.
+        bool instrument;
 
         /**
          * @brief Constructs a new LibraryModel.
@@ -138,6 +218,8 @@ namespace CodeGroupModels
          * @param classFiles Optional class models that generate individual files.
          * @param namespaceFiles Optional namespace models that generate individual files.
          * @param functionFile Optional free function models; the vector represents a file containing functions.
+         * @param mode Optional packaging mode of the library. Defaults to LibraryMode::COMPILED.
+         * @param instrument Optional flag to open every callable body with a trace scope. Defaults to false.
          */
         LibraryModel(std::string name,
                      std::string version,
@@ -145,10 +227,14 @@ namespace CodeGroupModels
                      const std::vector<FolderModel> &subFolders = {},
                      const std::vector<ClassModels::ClassModel> &classFiles = {},
                      const std::vector<NamespaceModel> &namespaceFiles = {},
-                     const std::vector<CallableModels::FunctionModel> &functionFile = {})
+                     const std::vector<CallableModels::FunctionModel> &functionFile = {},
+                     LibraryMode mode = LibraryMode::COMPILED,
+                     bool instrument = false)
             : FolderModel(std::move(name), subFolders, classFiles, namespaceFiles, functionFile),
               version(std::move(version)),
-              dependencies(std::move(dependencies))
+              dependencies(std::move(dependencies)),
+              mode(mode),
+              instrument(instrument)
         {
         }
     };
@@ -168,6 +254,8 @@ namespace CodeGroupModels
         std::vector<std::string> dependencies;
         /// A vector of libraries that are part of the project.
         std::vector<LibraryModel> libraries;
+        /// Project-wide generation options.
+        ProjectOptions options;
 
         /**
          * @brief Constructs a new ProjectModel.
@@ -180,6 +268,7 @@ namespace CodeGroupModels
          * @param classFiles Optional class models that generate individual files.
          * @param namespaceFiles Optional namespace models that generate individual files.
          * @param functionFile Optional free function models; the vector represents a file containing functions.
+         * @param options Optional project-wide generation options.
          */
         ProjectModel(std::string name,
                      std::string version,
@@ -188,11 +277,13 @@ namespace CodeGroupModels
                      const std::vector<FolderModel> &subFolders = {},
                      const std::vector<ClassModels::ClassModel> &classFiles = {},
                      const std::vector<NamespaceModel> &namespaceFiles = {},
-                     const std::vector<CallableModels::FunctionModel> &functionFile = {})
+                     const std::vector<CallableModels::FunctionModel> &functionFile = {},
+                     const ProjectOptions &options = {})
             : FolderModel(std::move(name), subFolders, classFiles, namespaceFiles, functionFile),
               version(std::move(version)),
               dependencies(std::move(dependencies)),
-              libraries(std::move(libraries))
+              libraries(std::move(libraries)),
+              options(options)
         {
         }
     };
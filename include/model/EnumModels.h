@@ -0,0 +1,34 @@
+/**
+ * @file EnumModels.h
+ * @brief Contains the model definition of enumerations in the scaffolder DSL.
+ *
+ * Enumerations are generated as scoped enums with constant-time conversions to and from their
+ * enumerator names, so they replace the ints and strings otherwise used to model closed sets.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+/**
+ * @namespace EnumModels
+ * @brief Contains the model definition of enumerations in the scaffolder DSL.
+ */
+namespace EnumModels
+{
+    /**
+     * @brief Represents a scoped enumeration as defined in the scaffolder DSL.
+     *
+     * Enumerators take consecutive values from zero in declaration order, which lets the generated
+     * toString() index an array of names and EnumTraits list every value.
+     */
+    struct EnumModel
+    {
+        std::string name;                ///< The name of the enumeration.
+        std::string description;         ///< A description of what the enumeration represents.
+        std::vector<std::string> values; ///< The enumerator names in declaration order.
+        std::string underlyingType;      ///< The underlying type, e.g. "std::uint8_t", or empty for the default.
+    };
+
+} // namespace EnumModels
@@ -97,6 +97,43 @@ namespace PropertiesModels
         return static_cast<u_int8_t>(qualifiers & flag) != 0;
     }
 
+    /**
+     * @brief Bitmask of DSL annotations attached to a parameter or data member (e.g. `@hot`, `@sink`).
+     */
+    enum class Annotation : u_int8_t
+    {
+        NONE = 0,          /**< No annotation */
+        HOT = 1,           /**< Member is accessed on hot paths and grouped first */
+        COLD = 2,          /**< Member is rarely accessed and grouped last */
+        OWN_CACHELINE = 4, /**< Member is contended and gets a cache line to itself */
+        SINK = 8           /**< Parameter is stored or consumed and passed by value to be moved from */
+    };
+
+    /**
+     * @brief Overloads the bitwise OR operator for Annotation.
+     *
+     * @param lhs The left-hand side Annotation.
+     * @param rhs The right-hand side Annotation.
+     * @return A new Annotation representing the combined flags.
+     */
+    inline Annotation operator|(Annotation lhs, Annotation rhs)
+    {
+        return static_cast<Annotation>(
+            static_cast<u_int8_t>(lhs) | static_cast<u_int8_t>(rhs));
+    }
+
+    /**
+     * @brief Checks if a specific annotation flag is set in an Annotation bitmask.
+     *
+     * @param annotations The combined Annotation bitmask.
+     * @param flag The specific Annotation flag to check.
+     * @return true if the flag is set; false otherwise.
+     */
+    inline bool hasAnnotation(Annotation annotations, Annotation flag)
+    {
+        return (static_cast<u_int8_t>(annotations) & static_cast<u_int8_t>(flag)) != 0;
+    }
+
     /**
      * @brief Represents pointer declarators for data types.
      *
@@ -190,6 +227,28 @@ namespace PropertiesModels
         }
     };
 
+    /**
+     * @brief Template parameters of a class or callable and the instantiations it is compiled for.
+     *
+     * Parameters and argument lists are kept as written in the DSL, e.g. `typename T` and
+     * `std::size_t N` with the instantiation `int, 4`.
+     */
+    struct TemplateSpec
+    {
+        std::vector<std::string> parameters;     /**< Template parameter declarations; empty if not a template */
+        std::vector<std::string> instantiations; /**< Argument lists explicitly instantiated in the source file */
+
+        /**
+         * @brief Reports whether the entity is a template.
+         *
+         * @return true if any template parameters are declared; false otherwise.
+         */
+        bool isTemplate() const
+        {
+            return !parameters.empty();
+        }
+    };
+
     /**
      * @brief Represents a parameter with a type and a name.
      *
@@ -197,17 +256,19 @@ namespace PropertiesModels
      */
     struct Parameter
     {
-        DataType type;    /**< Data type of the parameter */
-        std::string name; /**< Name of the parameter */
+        DataType type;          /**< Data type of the parameter */
+        std::string name;       /**< Name of the parameter */
+        Annotation annotations; /**< DSL annotations such as @hot or @cold */
 
         /**
          * @brief Constructor for Parameter.
          *
          * @param t The data type of the parameter.
          * @param n The name of the parameter.
+         * @param a Optional DSL annotations. Defaults to none.
          */
-        Parameter(const DataType t, const std::string n)
-            : type(t), name(std::move(n))
+        Parameter(const DataType t, const std::string n, const Annotation a = Annotation::NONE)
+            : type(t), name(std::move(n)), annotations(a)
         {
         }
     };
@@ -63,7 +63,8 @@ namespace CallableParser
     inline CallableModels::MethodModel parseMethodProperties(const std::string &methodName, std::deque<std::string_view> &propertyLines)
     {
         auto base = parseCallableProperties(methodName, propertyLines);
-        return CallableModels::MethodModel(base.returnType, methodName, base.parameters, base.declSpec, base.description);
+        return CallableModels::MethodModel(base.returnType, methodName, base.parameters, base.declSpec, base.description, base.isNoexcept,
+                                           base.templateSpec, base.instrument);
     }
 
     /**
@@ -80,7 +81,8 @@ namespace CallableParser
     inline CallableModels::FunctionModel parseFunctionProperties(const std::string &functionName, std::deque<std::string_view> &propertyLines)
     {
         auto base = parseCallableProperties(functionName, propertyLines);
-        return CallableModels::FunctionModel(base.returnType, functionName, base.parameters, base.declSpec, base.description);
+        return CallableModels::FunctionModel(base.returnType, functionName, base.parameters, base.declSpec, base.description, base.isNoexcept,
+                                             base.templateSpec, base.instrument);
     }
 
 } // namespace CallableParser
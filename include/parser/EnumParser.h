@@ -0,0 +1,39 @@
+/**
+ * @file EnumParser.h
+ * @brief Provides functions to parse enum blocks from the scaffolder DSL.
+ *
+ * An enum block lists the enumerators of a scoped enumeration, optionally with a description and
+ * an underlying type. The parser uses the same consume-as-you-go approach as the other block
+ * parsers, taking lines from a std::deque of std::string_view until the block's end marker.
+ */
+
+#pragma once
+
+#include "EnumModels.h"
+
+#include <deque>
+#include <string>
+#include <string_view>
+
+/**
+ * @namespace EnumParser
+ * @brief Provides functions to parse enum blocks from the scaffolder DSL.
+ */
+namespace EnumParser
+{
+    /**
+     * @brief Parses an enum block from the DSL using a consume-as-you-go approach.
+     *
+     * Supported properties are `values` (required, comma-separated enumerator names),
+     * `description` and `underlying` (the underlying integral type, e.g. `std::uint8_t`).
+     *
+     * @param enumName The name of the enumeration.
+     * @param lines A deque of DSL lines representing the enum block. Lines are consumed up to and including the end marker.
+     * @return EnumModels::EnumModel The parsed enumeration.
+     *
+     * @throws std::runtime_error on unknown properties, missing values, enumerators that are not
+     *         identifiers or enumerators declared twice.
+     */
+    EnumModels::EnumModel parseEnumBlock(const std::string &enumName, std::deque<std::string_view> &lines);
+
+} // namespace EnumParser
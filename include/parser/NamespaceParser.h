@@ -4,7 +4,7 @@
  *
  * This file declares functions for processing DSL input that defines C++ namespaces.
  * A namespace block may contain properties (such as a description) and nested blocks for
- * classes, functions, or even other namespaces. Methods are not allowed at the namespace level.
+ * classes, functions, enumerations, or even other namespaces. Methods are not allowed at the namespace level.
  * The parser uses a consume-as-you-go approach with a std::deque of std::string_view to ensure each line
  * is processed exactly once.
  */
@@ -25,7 +25,7 @@
  *
  * This namespace defines functions that process DSL lines to construct
  * a NamespaceModel. A namespace block may contain a description property
- * and nested blocks for classes, functions, and nested namespaces.
+ * and nested blocks for classes, functions, enumerations and nested namespaces.
  * Methods cannot be declared directly in a namespace.
  */
 namespace NamespaceParser
@@ -38,6 +38,7 @@ namespace NamespaceParser
      * - Nested namespaces (using the "namespace" keyword)
      * - Classes (using the "class" keyword)
      * - Free functions (using the "function" keyword)
+     * - Enumerations (using the "enum" keyword)
      *
      * If a "method" block is encountered, a std::runtime_error is thrown.
      *
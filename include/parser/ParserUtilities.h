@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <string>
 #include <string_view>
 #include <functional>
 #include <vector>
@@ -52,6 +53,33 @@ namespace ParserUtilities
      */
     std::vector<std::string_view> split(std::string_view input, char delimiter);
 
+    /**
+     * @brief Splits a string view by a delimiter that is not nested in brackets.
+     *
+     * Delimiters inside `<>`, `()` or `[]` are kept, so template-ids such as
+     * `std::map<int, std::string>` stay in one piece.
+     * Whitespace is preserved and must be trimmed externally if needed.
+     *
+     * @param input The string to split.
+     * @param delimiter The character delimiter to split on.
+     * @return A vector of substrings as std::string_view.
+     * @throws std::runtime_error if the brackets are unbalanced.
+     */
+    std::vector<std::string_view> splitTopLevel(std::string_view input, char delimiter);
+
+    /**
+     * @brief Parses a boolean property value.
+     *
+     * Accepts exactly `true` or `false`, so a mistyped opt-in flag is reported rather than
+     * silently read as disabled.
+     *
+     * @param key The property key, used in error messages.
+     * @param value The property value to parse.
+     * @return The parsed flag.
+     * @throws std::runtime_error if the value is neither `true` nor `false`.
+     */
+    bool parseFlag(const std::string &key, std::string_view value);
+
     /**
      * @brief Flushes a buffered block and dispatches it to a handler.
      *
@@ -63,11 +63,26 @@ namespace PropertiesParser
      */
     PropertiesModels::TypeDeclarator parseTypeDeclarator(std::string_view &typeStr);
 
+    /**
+     * @brief Parses trailing annotations from the provided string view.
+     *
+     * Annotations follow the type, separated by whitespace (e.g., "long @hot"). Supported
+     * annotations are `@hot`, `@cold` and `@own_cacheline`. This function extracts them
+     * from the end of the string view.
+     *
+     * @param typeStr A reference to the std::string_view containing the type; it is modified to remove annotations.
+     * @return The combined Annotation bitmask, or Annotation::NONE if there are none.
+     *
+     * @throws std::runtime_error if an annotation is unknown or both `@hot` and `@cold` are given.
+     */
+    PropertiesModels::Annotation parseAnnotations(std::string_view &typeStr);
+
     /**
      * @brief Parses a comma-separated list of parameters from the provided string view.
      *
      * The expected format is "param1:int, param2:float". Each parameter is split into a name
-     * and a type, with the type being parsed using parseDataType.
+     * and a type, with the type being parsed using parseDataType. A type may be followed by
+     * annotations, which are parsed using parseAnnotations.
      *
      * @param paramStr A std::string_view containing the parameter segment to parse.
      * @return A vector of Parameter objects representing the parsed parameters.
@@ -76,6 +91,33 @@ namespace PropertiesParser
      */
     std::vector<PropertiesModels::Parameter> parseParameters(std::string_view paramStr);
 
+    /**
+     * @brief Parses a comma-separated list of template parameter declarations.
+     *
+     * The expected format is "typename T, std::size_t N". Declarations are kept as written;
+     * each must end with the parameter name.
+     *
+     * @param paramStr A std::string_view containing the template parameter segment to parse.
+     * @return The template parameter declarations.
+     *
+     * @throws std::runtime_error if the list is empty, a declaration has no name or is a pack.
+     */
+    std::vector<std::string> parseTemplateParameters(std::string_view paramStr);
+
+    /**
+     * @brief Parses a semicolon-separated list of template argument lists.
+     *
+     * The expected format is "int, 4; double, 8", giving one explicit instantiation per
+     * argument list. Commas inside template-ids do not separate arguments.
+     *
+     * @param argStr A std::string_view containing the instantiation segment to parse.
+     * @param arity The number of template parameters every argument list must match.
+     * @return The argument lists, without surrounding angle brackets.
+     *
+     * @throws std::runtime_error if an argument list has the wrong number of arguments.
+     */
+    std::vector<std::string> parseTemplateInstantiations(std::string_view argStr, const size_t arity);
+
     /**
      * @brief Parses declaration specifiers from the provided string view.
      *
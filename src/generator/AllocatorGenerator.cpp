@@ -0,0 +1,232 @@
+#include "AllocatorGenerator.h"
+#include "GeneratorUtilities.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <sstream>
+#include <utility>
+
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ */
+namespace
+{
+    /// Standard containers with a std::pmr alias, paired with the header declaring it.
+    constexpr std::array<std::pair<const char *, const char *>, 12> PMR_CONTAINERS = {{
+        {"vector", "<vector>"},
+        {"deque", "<deque>"},
+        {"list", "<list>"},
+        {"forward_list", "<forward_list>"},
+        {"map", "<map>"},
+        {"multimap", "<map>"},
+        {"set", "<set>"},
+        {"multiset", "<set>"},
+        {"unordered_map", "<unordered_map>"},
+        {"unordered_multimap", "<unordered_map>"},
+        {"unordered_set", "<unordered_set>"},
+        {"unordered_multiset", "<unordered_set>"},
+    }};
+
+    /**
+     * @brief Replaces every occurrence of a substring.
+     *
+     * @param text The text to rewrite.
+     * @param from The substring to replace.
+     * @param to The replacement.
+     * @param wholeWord True to skip occurrences followed by an identifier character (e.g. std::string_view).
+     */
+    std::string replaceAll(std::string text, const std::string &from, const std::string &to, const bool wholeWord)
+    {
+        size_t pos = 0;
+        while ((pos = text.find(from, pos)) != std::string::npos)
+        {
+            size_t end = pos + from.size();
+            if (wholeWord && end < text.size() &&
+                (std::isalnum(static_cast<unsigned char>(text[end])) || text[end] == '_'))
+            {
+                pos = end;
+                continue;
+            }
+            text.replace(pos, from.size(), to);
+            pos += to.size();
+        }
+        return text;
+    }
+
+    /**
+     * @brief Joins the initialisers of every member into a member-initialiser list.
+     *
+     * @param members The data members in emission order.
+     * @param source The object members are initialised from, or empty to value-initialise them.
+     * @param move True to move allocator-aware members from the source.
+     * @return The list with a leading " : ", or an empty string if there are no members.
+     */
+    std::string initialiserList(const std::vector<PropertiesModels::Parameter> &members, const std::string &source,
+                                const bool move)
+    {
+        std::string list;
+        for (const auto &mem : members)
+        {
+            std::string argument;
+            if (!source.empty())
+            {
+                argument = source + "." + mem.name;
+                if (move && AllocatorGenerator::isAllocatorAware(mem))
+                    argument = "std::move(" + argument + ")";
+            }
+            list += (list.empty() ? " : " : ", ") + AllocatorGenerator::memberInitialiser(mem, argument);
+        }
+        return list;
+    }
+
+} // end anonymous namespace
+
+namespace AllocatorGenerator
+{
+    PropertiesModels::DataType pmrType(const PropertiesModels::DataType &type)
+    {
+        PropertiesModels::DataType rewritten = type;
+        if (type.type == PropertiesModels::Types::STRING)
+        {
+            rewritten.type = PropertiesModels::Types::CUSTOM;
+            rewritten.customType = "std::pmr::string";
+        }
+        else if (type.type == PropertiesModels::Types::CUSTOM && type.customType)
+        {
+            std::string name = replaceAll(*type.customType, "std::string", "std::pmr::string", true);
+            for (const auto &[container, header] : PMR_CONTAINERS)
+            {
+                name = replaceAll(name, std::string("std::") + container + "<", std::string("std::pmr::") + container + "<", false);
+            }
+            rewritten.customType = name;
+        }
+        return rewritten;
+    }
+
+    ClassModels::ClassModel applyAllocator(const ClassModels::ClassModel &cl)
+    {
+        if (cl.options.allocator != ClassModels::AllocatorPolicy::PMR)
+            return cl;
+
+        ClassModels::ClassModel rewritten = cl;
+        const auto members = GeneratorUtilities::allMembers(cl);
+        for (auto *section : {&rewritten.publicMembers, &rewritten.privateMembers, &rewritten.protectedMembers})
+        {
+            for (auto &mem : *section)
+            {
+                mem.type = pmrType(mem.type);
+            }
+        }
+
+        // Parameters initialising a member take its type, so they can be moved into it.
+        for (auto &ctor : rewritten.constructors)
+        {
+            for (auto &param : ctor.parameters)
+            {
+                bool initialisesMember = std::any_of(members.begin(), members.end(), [&param](const PropertiesModels::Parameter &mem)
+                                                     { return mem.name == param.name; });
+                if (initialisesMember)
+                    param.type = pmrType(param.type);
+            }
+        }
+        return rewritten;
+    }
+
+    bool isAllocatorAware(const PropertiesModels::Parameter &member)
+    {
+        const auto &decl = member.type.typeDecl;
+        return member.type.type == PropertiesModels::Types::CUSTOM && member.type.customType &&
+               decl.ptrCount == 0 && !decl.isLValReference && !decl.isRValReference && decl.arrayDimensions.empty();
+    }
+
+    std::string memberInitialiser(const PropertiesModels::Parameter &member, const std::string &argument)
+    {
+        if (!isAllocatorAware(member))
+            return member.name + "(" + argument + ")";
+
+        // std::pmr types take the allocator last; other types get uses-allocator construction.
+        const std::string &type = *member.type.customType;
+        if (type.starts_with("std::pmr::"))
+            return member.name + "(" + (argument.empty() ? "" : argument + ", ") + "alloc)";
+        return member.name + "(std::make_obj_using_allocator<" + type + ">(alloc" +
+               (argument.empty() ? "" : ", " + argument) + "))";
+    }
+
+    std::string generateAllocatorDeclarations(const ClassModels::ClassModel &cl)
+    {
+        if (cl.options.allocator != ClassModels::AllocatorPolicy::PMR)
+            return "";
+
+        // Declaring constructors suppresses the implicit default constructor, which the allocator then stands in for.
+        const bool declaresDefault = std::any_of(cl.constructors.begin(), cl.constructors.end(), [](const ClassModels::Constructor &ctor)
+                                                 { return ctor.type == ClassModels::ConstructorType::DEFAULT; });
+
+        std::ostringstream oss;
+        oss << "    using allocator_type = std::pmr::polymorphic_allocator<>;\n\n";
+        oss << "    /**\n     * @brief Allocator-extended default constructor.\n"
+            << "     * @param alloc The allocator passed to allocator-aware members.\n     */\n"
+            << "    explicit " << cl.name << "(const allocator_type& alloc" << (declaresDefault ? "" : " = {}") << ");\n\n";
+        oss << "    /**\n     * @brief Allocator-extended copy constructor.\n"
+            << "     * @param other The " << cl.name << " object to copy from.\n"
+            << "     * @param alloc The allocator passed to allocator-aware members.\n     */\n"
+            << "    " << cl.name << "(const " << cl.name << "& other, const allocator_type& alloc);\n\n";
+        oss << "    /**\n     * @brief Allocator-extended move constructor.\n"
+            << "     * @param other The " << cl.name << " object to move from.\n"
+            << "     * @param alloc The allocator passed to allocator-aware members.\n     */\n"
+            << "    " << cl.name << "(" << cl.name << "&& other, const allocator_type& alloc);\n\n";
+        return oss.str();
+    }
+
+    std::string generateAllocatorDefinitions(const ClassModels::ClassModel &cl, const std::string &className,
+                                             const bool inlineDef, const std::string &prefix)
+    {
+        if (cl.options.allocator != ClassModels::AllocatorPolicy::PMR)
+            return "";
+
+        const auto members = GeneratorUtilities::allMembers(cl);
+        // An unused allocator parameter is left unnamed to avoid -Wunused-parameter.
+        const bool usesAlloc = std::any_of(members.begin(), members.end(), isAllocatorAware);
+        const std::string allocParam = usesAlloc ? "const allocator_type& alloc" : "const allocator_type&";
+        const std::string head = prefix + (inlineDef ? "inline " : "") + className + "::" +
+                                 className.substr(0, className.find('<')) + "(";
+
+        std::ostringstream oss;
+        oss << head << allocParam << ")" << initialiserList(members, "", false) << "\n{\n}\n\n";
+        oss << head << "const " << className << "& other, " << allocParam << ")"
+            << initialiserList(members, "other", false) << "\n{\n}\n\n";
+        oss << head << className << "&& other, " << allocParam << ")"
+            << initialiserList(members, "other", true) << "\n{\n}\n\n";
+        return oss.str();
+    }
+
+    std::set<std::string> requiredHeaders(const ClassModels::ClassModel &cl)
+    {
+        if (cl.options.allocator != ClassModels::AllocatorPolicy::PMR)
+            return {};
+
+        std::set<std::string> headers = {"<memory_resource>"};
+        for (const auto &mem : GeneratorUtilities::allMembers(cl))
+        {
+            if (!mem.type.customType)
+                continue;
+            const std::string &type = *mem.type.customType;
+            if (type.find("std::pmr::string") != std::string::npos)
+                headers.insert("<string>");
+            for (const auto &[container, header] : PMR_CONTAINERS)
+            {
+                if (type.find(std::string("std::pmr::") + container + "<") != std::string::npos)
+                    headers.insert(header);
+            }
+            if (isAllocatorAware(mem))
+            {
+                // std::move in the allocator-extended move constructor.
+                headers.insert("<utility>");
+                if (!type.starts_with("std::pmr::"))
+                    headers.insert("<memory>");
+            }
+        }
+        return headers;
+    }
+
+} // namespace AllocatorGenerator
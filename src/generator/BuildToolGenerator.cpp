@@ -1,6 +1,10 @@
 #include "BuildToolsGenerator.h"
 #include "GeneratorUtilities.h"
+#include "ProfilerGenerator.h"
+#include "TracingGenerator.h"
 
+#include <algorithm>
+#include <cctype>
 #include <fstream>
 #include <iostream>
 #include <format>
@@ -31,11 +35,13 @@ namespace
      *
      * @param lib The LibraryMetadata object containing dependency information.
      * @param binName The name of the binary (executable or library target) to link the dependencies to.
+     * @param scope The CMake usage requirement scope to link with (PUBLIC, or INTERFACE for header-only targets).
      * @return A string containing the generated CMake commands for dependency linking.
      * @throws std::runtime_error if dependencies are not in the right format. It is assumed that dependencies
      * are CMake style i.e. <Package>::<Target>.
      */
-    std::string generateDependencies(const ProjectMetadata::LibraryMetadata &lib, const std::string &binName)
+    std::string generateDependencies(const ProjectMetadata::LibraryMetadata &lib, const std::string &binName,
+                                     const std::string &scope = "PUBLIC")
     {
         std::ostringstream dependencies;
 
@@ -52,13 +58,302 @@ namespace
             dependencies << "\n# Find and link " << dep << " library\n";
             dependencies << "find_package(" << packageName << " REQUIRED)\n";
             dependencies << "if(" << packageName << "_FOUND)\n";
-            dependencies << "target_link_libraries(" << binName << " PUBLIC " << dep << ")\n";
+            dependencies << "target_link_libraries(" << binName << " " << scope << " " << dep << ")\n";
             dependencies << "endif()\n";
         }
 
         return dependencies.str();
     }
 
+    /**
+     * @brief Generates CMake snippet for optimised build configuration.
+     *
+     * The snippet adds an ENABLE_IPO option that turns on interprocedural optimisation (LTO)
+     * after confirming toolchain support through CheckIPOSupported, an ENABLE_DEV_BUILD option
+     * for fast incremental relinks (shared libraries, mold or lld with a gdb index, split DWARF
+     * and a ccache launcher when those tools are installed), and a PGO_MODE cache
+     * variable selecting the profile guided optimisation stage. GENERATE instruments the
+     * build to write profiles into PGO_PROFILE_DIR; USE feeds those profiles back into the
+     * compiler (merging raw Clang profiles with llvm-profdata first). The settings are
+     * emitted ahead of any target so they apply to every library and the main binary.
+     *
+     * @return A string containing the CMake commands for IPO, developer and PGO configuration.
+     */
+    std::string generateOptimisationSettings()
+    {
+        return R"(# Interprocedural optimisation (LTO), enabled by the release presets.
+option(ENABLE_IPO "Enable interprocedural optimisation when supported" OFF)
+if(ENABLE_IPO)
+    include(CheckIPOSupported)
+    check_ipo_supported(RESULT IPO_SUPPORTED OUTPUT IPO_ERROR LANGUAGES CXX)
+    if(IPO_SUPPORTED)
+        set(CMAKE_INTERPROCEDURAL_OPTIMIZATION ON)
+    else()
+        message(WARNING "IPO is not supported: ${IPO_ERROR}")
+    endif()
+endif()
+
+# Fast-iteration developer build, enabled by the dev preset.
+option(ENABLE_DEV_BUILD "Shared libraries, fast linker and split debug info for quick relinks" OFF)
+if(ENABLE_DEV_BUILD)
+    set(BUILD_SHARED_LIBS ON)
+    set(CMAKE_POSITION_INDEPENDENT_CODE ON)
+    # Prefer mold, then lld, over the default linker.
+    find_program(MOLD_LINKER mold)
+    find_program(LLD_LINKER ld.lld)
+    if(MOLD_LINKER)
+        add_link_options(-fuse-ld=mold -Wl,--gdb-index)
+    elseif(LLD_LINKER)
+        add_link_options(-fuse-ld=lld -Wl,--gdb-index)
+    endif()
+    # Keep debug info out of the objects the linker has to process.
+    add_compile_options(-gsplit-dwarf)
+    find_program(CCACHE_PROGRAM ccache)
+    if(CCACHE_PROGRAM)
+        set(CMAKE_CXX_COMPILER_LAUNCHER ${CCACHE_PROGRAM})
+    endif()
+endif()
+
+# Profile guided optimisation: OFF, GENERATE (instrumented training build) or USE.
+set(PGO_MODE "OFF" CACHE STRING "Profile guided optimisation stage")
+set_property(CACHE PGO_MODE PROPERTY STRINGS OFF GENERATE USE)
+set(PGO_PROFILE_DIR "${CMAKE_SOURCE_DIR}/pgo-profiles" CACHE PATH "Directory holding PGO profile data")
+if(PGO_MODE STREQUAL "GENERATE")
+    add_compile_options(-fprofile-generate=${PGO_PROFILE_DIR})
+    add_link_options(-fprofile-generate=${PGO_PROFILE_DIR})
+elseif(PGO_MODE STREQUAL "USE")
+    if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        # Clang writes raw profiles which must be merged before use.
+        find_program(LLVM_PROFDATA llvm-profdata REQUIRED)
+        file(GLOB PGO_RAW_PROFILES "${PGO_PROFILE_DIR}/*.profraw")
+        execute_process(COMMAND ${LLVM_PROFDATA} merge -output=${PGO_PROFILE_DIR}/default.profdata ${PGO_RAW_PROFILES})
+        add_compile_options(-fprofile-use=${PGO_PROFILE_DIR}/default.profdata)
+    else()
+        add_compile_options(-fprofile-use=${PGO_PROFILE_DIR} -fprofile-correction -Wno-missing-profile)
+    endif()
+endif()
+
+)";
+    }
+
+    /**
+     * @brief Generates the CMake setting pinning std::hardware_destructive_interference_size.
+     *
+     * Members annotated `@own_cacheline` are aligned to that constant, whose value GCC warns may
+     * change with -mtune. Pinning it silences the warning; GCC only accepts the parameter from
+     * version 12, and projects without such members get no setting at all.
+     *
+     * @param projMeta The project metadata.
+     * @return The setting, or an empty string if no class has an `@own_cacheline` member.
+     */
+    std::string generateInterferenceSizeSetting(const ProjectMetadata::ProjMetadata &projMeta)
+    {
+        if (!projMeta.ownCacheline)
+        {
+            return "";
+        }
+
+        return "# Pin std::hardware_destructive_interference_size, which aligns @own_cacheline members,\n"
+               "# so GCC does not warn that its value may change with -mtune.\n"
+               "if(CMAKE_CXX_COMPILER_ID STREQUAL \"GNU\" AND CMAKE_CXX_COMPILER_VERSION VERSION_GREATER_EQUAL 12)\n"
+               "    add_compile_options(--param=destructive-interference-size=64)\n"
+               "endif()\n\n";
+    }
+
+    /**
+     * @brief Generates the CMake option compiling the trace scopes of instrumented callables.
+     *
+     * The option defines the project's tracing macro for every target; without it TRACE_SCOPE
+     * expands to nothing.
+     *
+     * @param projMeta The project metadata.
+     * @return The option, or an empty string if no generated body opens with a trace scope.
+     */
+    std::string generateTracingOption(const ProjectMetadata::ProjMetadata &projMeta)
+    {
+        if (!projMeta.tracing)
+        {
+            return "";
+        }
+
+        const std::string option = TracingGenerator::optionName(projMeta.libraries.at("proj").name);
+        return std::format("# Trace scopes of instrumented methods and functions, compiled out unless enabled.\n"
+                           "option({0} \"Compile the TRACE_SCOPE hooks of instrumented callables\" OFF)\n"
+                           "if({0})\n"
+                           "    add_compile_definitions({0})\n"
+                           "endif()\n\n",
+                           option);
+    }
+
+    /**
+     * @brief Generates the CMake settings of a project built without exceptions.
+     *
+     * @param projMeta The project metadata.
+     * @return The compile options, or an empty string if the project reports errors with exceptions.
+     */
+    std::string generateErrorHandlingSettings(const ProjectMetadata::ProjMetadata &projMeta)
+    {
+        if (projMeta.options.errors != CodeGroupModels::ErrorHandling::EXPECTED)
+        {
+            return "";
+        }
+
+        return "# Generated callables report errors through std::expected, so nothing is built with exceptions.\n"
+               "if(MSVC)\n"
+               "    add_compile_options(/EHs-c- /D_HAS_EXCEPTIONS=0)\n"
+               "else()\n"
+               "    add_compile_options(-fno-exceptions)\n"
+               "endif()\n\n";
+    }
+
+    /**
+     * @brief Generates the CMake target of the built-in profiling library.
+     *
+     * The target is declared ahead of the libraries so that every target can link it.
+     *
+     * @param projMeta The project metadata.
+     * @return The target, or an empty string if the project has no profiler.
+     */
+    std::string generateProfilerTarget(const ProjectMetadata::ProjMetadata &projMeta)
+    {
+        if (!projMeta.options.profiler)
+        {
+            return "";
+        }
+
+        return std::format("# Built-in profiler streaming scopes, counters and histograms to a Chrome trace.\n"
+                           "find_package(Threads REQUIRED)\n"
+                           "add_library({0} ${{CMAKE_SOURCE_DIR}}/src/{1})\n"
+                           "target_include_directories({0} PUBLIC ${{CMAKE_SOURCE_DIR}}/include)\n"
+                           "target_link_libraries({0} PUBLIC Threads::Threads)\n\n",
+                           ProfilerGenerator::LIBRARY_NAME, ProfilerGenerator::SOURCE);
+    }
+
+    /**
+     * @brief Escapes a string for inclusion in a JSON string literal.
+     *
+     * @param value The raw string.
+     * @return The string with backslashes and double quotes escaped.
+     */
+    std::string escapeJson(const std::string &value)
+    {
+        std::string escaped;
+        escaped.reserve(value.size());
+        for (const char c : value)
+        {
+            if (c == '\\' || c == '"')
+            {
+                escaped += '\\';
+            }
+            escaped += c;
+        }
+        return escaped;
+    }
+
+    /**
+     * @brief Builds the flags every translation unit of the project is compiled with.
+     *
+     * Mirrors the project-wide settings of the generated CMakeLists.txt: the language standard,
+     * -fno-exceptions when errors are reported through std::expected, and the pinned
+     * destructive interference size when a class has an `@own_cacheline` member.
+     *
+     * @param projMeta The project metadata.
+     * @return The compiler and its flags, without include directories.
+     */
+    std::vector<std::string> generateCompileFlags(const ProjectMetadata::ProjMetadata &projMeta)
+    {
+        std::vector<std::string> flags = {"c++", "-std=c++23"};
+        if (projMeta.options.errors == CodeGroupModels::ErrorHandling::EXPECTED)
+        {
+            flags.emplace_back("-fno-exceptions");
+        }
+        if (projMeta.ownCacheline)
+        {
+            flags.emplace_back("--param=destructive-interference-size=64");
+        }
+        return flags;
+    }
+
+    /**
+     * @brief Appends include flags to a copy of the project-wide compile flags.
+     */
+    std::vector<std::string> withIncludeFlags(std::vector<std::string> flags, const std::vector<std::string> &includeFlags)
+    {
+        flags.insert(flags.end(), includeFlags.begin(), includeFlags.end());
+        return flags;
+    }
+
+    /**
+     * @brief Generates one compile_commands.json entry.
+     *
+     * @param projectRoot Absolute path of the generated project, used as the working directory.
+     * @param file Absolute path of the compiled source.
+     * @param arguments The compiler and its flags, to which the compile step is appended.
+     * @return The entry as a JSON object.
+     */
+    std::string generateCompileCommand(const std::string &projectRoot, const std::string &file,
+                                       const std::vector<std::string> &arguments)
+    {
+        std::ostringstream entry;
+        entry << "    {\n"
+              << "        \"directory\": \"" << escapeJson(projectRoot) << "\",\n"
+              << "        \"file\": \"" << escapeJson(file) << "\",\n"
+              << "        \"arguments\": [";
+        for (const auto &arg : arguments)
+        {
+            entry << "\"" << escapeJson(arg) << "\", ";
+        }
+        entry << "\"-c\", \"" << escapeJson(file) << "\"]\n"
+              << "    }";
+        return entry.str();
+    }
+
+    /**
+     * @brief Builds the include flags a library's translation units are compiled with.
+     *
+     * Mirrors the generated CMakeLists.txt: every target sees the global include directory and the
+     * include directories of its own subfolders. The main binary additionally sees the include
+     * directories of every library, since it links them all publicly.
+     *
+     * @param lib The library whose translation units are being compiled.
+     * @param projMeta The project metadata holding every library.
+     * @param projectRoot Absolute path of the generated project.
+     * @return The ordered list of -I flags.
+     */
+    std::vector<std::string> generateIncludeFlags(const ProjectMetadata::LibraryMetadata &lib,
+                                                  const ProjectMetadata::ProjMetadata &projMeta,
+                                                  const std::string &projectRoot)
+    {
+        std::vector<std::string> flags = {"-I" + projectRoot + "/include"};
+
+        auto addSubDirectories = [&](const ProjectMetadata::LibraryMetadata &owner)
+        {
+            for (const auto &subDir : owner.subDirectories)
+            {
+                std::string subRelPath = GeneratorUtilities::removeRootPrefix(subDir);
+                // The project root and the unset library root both map onto the global include directory.
+                if (subRelPath.empty() || subRelPath == "ROOT")
+                {
+                    continue;
+                }
+                flags.emplace_back("-I" + projectRoot + "/include/" + subRelPath);
+            }
+        };
+
+        addSubDirectories(lib);
+        if (lib.isProjLevel)
+        {
+            for (const auto &[_, other] : projMeta.libraries)
+            {
+                if (!other.isProjLevel)
+                {
+                    addSubDirectories(other);
+                }
+            }
+        }
+        return flags;
+    }
+
     /**
      * @brief Generates CMake snippet for library targets based on project metadata.
      *
@@ -66,7 +361,8 @@ namespace
      * commands to define each library target. It skips the main binary (project-level)
      * target and assumes that non-project-level library source files are located in
      * "src/<relativePath>/..." and that the include directories are defined by the
-     * library's subDirectories vector.
+     * library's subDirectories vector. Header-only libraries have no sources and are
+     * emitted as INTERFACE targets.
      *
      * @param projMeta The project metadata containing information about all libraries.
      * @return A string containing the CMake commands for defining library targets.
@@ -81,28 +377,302 @@ namespace
             {
                 continue;
             }
-            // Prune ROOT from relative path for globbing purposes.
-            std::string relPath = GeneratorUtilities::removeRootPrefix(lib.relativePath);
-            // Glob all .cpp files in the library folder (including all subdirectories).
-            std::string globCommand = std::format("file(GLOB_RECURSE {0}_SOURCES CONFIGURE_DEPENDS \"${{CMAKE_SOURCE_DIR}}/src/{1}/*.cpp\")\n",
-                                                  lib.name, relPath);
-            globCommand += std::format("add_library({} ${{{}_SOURCES}})\n", lib.name, lib.name);
-            cmakeSnippet += globCommand;
+            // Header-only libraries propagate everything through the INTERFACE scope.
+            const std::string scope = lib.isHeaderOnly ? "INTERFACE" : "PUBLIC";
+
+            if (lib.isHeaderOnly)
+            {
+                // No sources to compile; consumers inline the definitions from the headers.
+                cmakeSnippet += std::format("add_library({} INTERFACE)\n", lib.name);
+            }
+            else
+            {
+                // Prune ROOT from relative path for globbing purposes.
+                std::string relPath = GeneratorUtilities::removeRootPrefix(lib.relativePath);
+                // Glob all .cpp files in the library folder (including all subdirectories).
+                std::string globCommand = std::format("file(GLOB_RECURSE {0}_SOURCES CONFIGURE_DEPENDS \"${{CMAKE_SOURCE_DIR}}/src/{1}/*.cpp\")\n",
+                                                      lib.name, relPath);
+                globCommand += std::format("add_library({} ${{{}_SOURCES}})\n", lib.name, lib.name);
+                cmakeSnippet += globCommand;
+            }
 
             // Instead of using a single include directory, add all subdirectories stored in metadata.
             for (const auto &subDir : lib.subDirectories)
             {
                 std::string subRelPath = GeneratorUtilities::removeRootPrefix(subDir);
-                cmakeSnippet += std::format("target_include_directories({} PUBLIC ${{CMAKE_SOURCE_DIR}}/include/{}/)\n",
-                                            lib.name, subRelPath);
+                cmakeSnippet += std::format("target_include_directories({} {} ${{CMAKE_SOURCE_DIR}}/include/{}/)\n",
+                                            lib.name, scope, subRelPath);
             }
 
             // Generate dependency linking commands using the dependency generator.
-            cmakeSnippet += generateDependencies(lib, lib.name) + "\n";
+            cmakeSnippet += generateDependencies(lib, lib.name, scope);
+            if (projMeta.options.profiler)
+            {
+                cmakeSnippet += std::format("target_link_libraries({} {} {})\n", lib.name, scope, ProfilerGenerator::LIBRARY_NAME);
+            }
+            cmakeSnippet += "\n";
         }
         return cmakeSnippet;
     }
 
+    /**
+     * @brief Lists the support headers shared by generated code, e.g. the binary serialisation runtime.
+     *
+     * The profiler header is left out, since it belongs to the profiling library.
+     *
+     * @param projMeta The project metadata holding the support files.
+     * @return The header paths relative to the project root, e.g. "include/BinarySerialization.h".
+     */
+    std::vector<std::string> collectSupportHeaders(const ProjectMetadata::ProjMetadata &projMeta)
+    {
+        const std::string profilerHeader = std::string("include/") + ProfilerGenerator::HEADER;
+        std::vector<std::string> headers;
+        for (const auto &supportFile : projMeta.supportFiles)
+        {
+            if (supportFile.relativePath.starts_with("include/") && supportFile.relativePath != profilerHeader)
+            {
+                headers.push_back(supportFile.relativePath);
+            }
+        }
+        return headers;
+    }
+
+    /**
+     * @brief Generates the package configuration files of a library subproject.
+     *
+     * `<Library>Config.cmake` finds the library's dependencies and includes its exported targets, and
+     * `<Library>ConfigVersion.cmake` accepts requests for the same major version. Both are installed
+     * next to the targets file, so an installed library can be consumed with find_package().
+     *
+     * @param lib The library metadata; a library without a version is packaged as version 0.0.0.
+     * @return The CMake commands writing and installing the package configuration.
+     */
+    std::string generatePackageConfig(const ProjectMetadata::LibraryMetadata &lib)
+    {
+        std::string config = "@PACKAGE_INIT@\\n\\n";
+        if (!lib.dependencies.empty())
+        {
+            config += "include(CMakeFindDependencyMacro)\\n";
+            for (const auto &dep : lib.dependencies)
+            {
+                config += "find_dependency(" + dep.substr(0, dep.find("::")) + ")\\n";
+            }
+        }
+        config += std::format("include(\\\"\\${{CMAKE_CURRENT_LIST_DIR}}/{0}Targets.cmake\\\")\\n"
+                              "check_required_components({0})\\n",
+                              lib.name);
+
+        return std::format("\n# Package configuration, so installed builds can find_package({0})\n"
+                           "include(CMakePackageConfigHelpers)\n"
+                           "file(WRITE ${{CMAKE_CURRENT_BINARY_DIR}}/{0}Config.cmake.in \"{1}\")\n"
+                           "configure_package_config_file(${{CMAKE_CURRENT_BINARY_DIR}}/{0}Config.cmake.in\n"
+                           "                              ${{CMAKE_CURRENT_BINARY_DIR}}/{0}Config.cmake\n"
+                           "                              INSTALL_DESTINATION ${{CMAKE_INSTALL_LIBDIR}}/cmake/{0})\n"
+                           "write_basic_package_version_file(${{CMAKE_CURRENT_BINARY_DIR}}/{0}ConfigVersion.cmake\n"
+                           "                                 VERSION {2} COMPATIBILITY SameMajorVersion)\n"
+                           "install(FILES ${{CMAKE_CURRENT_BINARY_DIR}}/{0}Config.cmake ${{CMAKE_CURRENT_BINARY_DIR}}/{0}ConfigVersion.cmake\n"
+                           "        DESTINATION ${{CMAKE_INSTALL_LIBDIR}}/cmake/{0})\n",
+                           lib.name, config, lib.version.empty() ? "0.0.0" : lib.version);
+    }
+
+    /**
+     * @brief Generates the directory-level CMakeLists.txt for a library subproject.
+     *
+     * The subproject is usable both through add_subdirectory() from the generated top-level
+     * CMakeLists.txt and as a standalone CMake project configured from its own folder. Include
+     * directories are expressed relative to the subproject so the build tree and install tree
+     * both resolve, and the target is exported (in the build tree and on install) under the
+     * project namespace so external builds can consume it without reconfiguring the project.
+     * The install tree also holds the project's support headers, which generated headers include,
+     * and a package configuration for find_package(). Consumers are compiled as C++23 at least.
+     *
+     * @param lib The library metadata to generate the subproject for.
+     * @param exportNamespace The namespace exported targets are placed in (the project name).
+     * @param supportHeaders The project's support headers, relative to the project root.
+     * @return A string containing the library's CMakeLists.txt content.
+     */
+    std::string generateLibrarySubproject(const ProjectMetadata::LibraryMetadata &lib, const std::string &exportNamespace,
+                                          const std::vector<std::string> &supportHeaders)
+    {
+        const std::string scope = lib.isHeaderOnly ? "INTERFACE" : "PUBLIC";
+        std::ostringstream cmakeFile;
+
+        cmakeFile << "cmake_minimum_required(VERSION 3.16)\n";
+        cmakeFile << "project(" << lib.name << " LANGUAGES CXX)\n\n";
+        cmakeFile << "# Standalone configuration when not added from the top-level project.\n";
+        cmakeFile << "if(CMAKE_SOURCE_DIR STREQUAL CMAKE_CURRENT_SOURCE_DIR)\n";
+        cmakeFile << "    set(CMAKE_CXX_STANDARD 23)\n";
+        cmakeFile << "    set(CMAKE_CXX_STANDARD_REQUIRED ON)\n";
+        cmakeFile << "endif()\n\n";
+        cmakeFile << "include(GNUInstallDirs)\n";
+        // Libraries live directly under src/, so the project root is two levels up.
+        cmakeFile << std::format("get_filename_component({}_ROOT \"${{CMAKE_CURRENT_SOURCE_DIR}}/../..\" ABSOLUTE)\n\n", lib.name);
+
+        if (lib.isHeaderOnly)
+        {
+            cmakeFile << std::format("add_library({} INTERFACE)\n", lib.name);
+        }
+        else
+        {
+            cmakeFile << std::format("file(GLOB_RECURSE {0}_SOURCES CONFIGURE_DEPENDS \"${{CMAKE_CURRENT_SOURCE_DIR}}/*.cpp\")\n", lib.name);
+            cmakeFile << std::format("add_library({0} ${{{0}_SOURCES}})\n", lib.name);
+        }
+        cmakeFile << std::format("add_library({0}::{1} ALIAS {1})\n", exportNamespace, lib.name);
+        cmakeFile << std::format("target_compile_features({} {} cxx_std_23)\n", lib.name, scope);
+
+        // The global include directory holds the support headers; standalone builds do not get it from the top level.
+        cmakeFile << std::format("target_include_directories({0} {1} $<BUILD_INTERFACE:${{{0}_ROOT}}/include> "
+                                 "$<INSTALL_INTERFACE:${{CMAKE_INSTALL_INCLUDEDIR}}>)\n",
+                                 lib.name, scope);
+        for (const auto &subDir : lib.subDirectories)
+        {
+            std::string subRelPath = GeneratorUtilities::removeRootPrefix(subDir);
+            // The unset library root maps onto the global include directory, already added above.
+            if (subRelPath.empty() || subRelPath == "ROOT")
+            {
+                continue;
+            }
+            cmakeFile << std::format("target_include_directories({0} {1} $<BUILD_INTERFACE:${{{0}_ROOT}}/include/{2}/> "
+                                     "$<INSTALL_INTERFACE:${{CMAKE_INSTALL_INCLUDEDIR}}/{2}>)\n",
+                                     lib.name, scope, subRelPath);
+        }
+        cmakeFile << generateDependencies(lib, lib.name, scope) << "\n";
+
+        // Export the target for the build tree and for installs.
+        std::string relPath = GeneratorUtilities::removeRootPrefix(lib.relativePath);
+        cmakeFile << "# Exported targets\n";
+        cmakeFile << std::format("install(TARGETS {0} EXPORT {0}Targets\n"
+                                 "        ARCHIVE DESTINATION ${{CMAKE_INSTALL_LIBDIR}}\n"
+                                 "        LIBRARY DESTINATION ${{CMAKE_INSTALL_LIBDIR}}\n"
+                                 "        RUNTIME DESTINATION ${{CMAKE_INSTALL_BINDIR}})\n",
+                                 lib.name);
+        cmakeFile << std::format("install(DIRECTORY ${{{0}_ROOT}}/include/{1}/ DESTINATION ${{CMAKE_INSTALL_INCLUDEDIR}}/{1})\n",
+                                 lib.name, relPath);
+        if (!supportHeaders.empty())
+        {
+            cmakeFile << "install(FILES";
+            for (const auto &header : supportHeaders)
+            {
+                cmakeFile << std::format(" ${{{}_ROOT}}/{}", lib.name, header);
+            }
+            cmakeFile << " DESTINATION ${CMAKE_INSTALL_INCLUDEDIR})\n";
+        }
+        cmakeFile << std::format("install(EXPORT {0}Targets NAMESPACE {1}:: DESTINATION ${{CMAKE_INSTALL_LIBDIR}}/cmake/{0})\n",
+                                 lib.name, exportNamespace);
+        cmakeFile << std::format("export(EXPORT {0}Targets NAMESPACE {1}:: FILE ${{CMAKE_CURRENT_BINARY_DIR}}/{0}Targets.cmake)\n",
+                                 lib.name, exportNamespace);
+        cmakeFile << generatePackageConfig(lib);
+
+        return cmakeFile.str();
+    }
+
+    /**
+     * @brief Generates the add_subdirectory() calls for library subprojects.
+     *
+     * @param projMeta The project metadata containing information about all libraries.
+     * @return A string containing one add_subdirectory() per non-project-level library.
+     */
+    std::string generateLibrarySubdirectories(const ProjectMetadata::ProjMetadata &projMeta)
+    {
+        std::string cmakeSnippet;
+        for (const auto &[_, lib] : projMeta.libraries)
+        {
+            if (lib.isProjLevel)
+            {
+                continue;
+            }
+            cmakeSnippet += std::format("add_subdirectory(src/{})\n", GeneratorUtilities::removeRootPrefix(lib.relativePath));
+        }
+        return cmakeSnippet + "\n";
+    }
+
+    /**
+     * @brief Maps a library subdirectory onto the include directory it is exposed through.
+     *
+     * @param subDir The subdirectory as recorded in LibraryMetadata (possibly "ROOT"-prefixed or empty).
+     * @return The include path relative to the project root, e.g. "include/Core/Utils".
+     */
+    std::string bazelIncludePath(const std::string &subDir)
+    {
+        std::string subRelPath = GeneratorUtilities::removeRootPrefix(subDir);
+        if (subRelPath.empty() || subRelPath == "ROOT")
+        {
+            return "include";
+        }
+        return "include/" + subRelPath;
+    }
+
+    /**
+     * @brief Formats a Starlark list attribute with one quoted entry per line.
+     *
+     * @param attribute The attribute name (e.g., "srcs").
+     * @param entries The entries of the list.
+     * @return The formatted attribute, or an empty string when there are no entries.
+     */
+    std::string bazelListAttribute(const std::string &attribute, const std::vector<std::string> &entries)
+    {
+        if (entries.empty())
+        {
+            return "";
+        }
+        std::string out = "    " + attribute + " = [\n";
+        for (const auto &entry : entries)
+        {
+            out += "        \"" + entry + "\",\n";
+        }
+        return out + "    ],\n";
+    }
+
+    /**
+     * @brief Generates a cc_library rule for a library's generated files.
+     *
+     * @param name The rule name.
+     * @param lib The library metadata providing the sources, headers and include directories.
+     * @param deps Labels of other rules the library depends on.
+     * @return The cc_library rule.
+     */
+    std::string generateBazelLibrary(const std::string &name, const ProjectMetadata::LibraryMetadata &lib,
+                                     const std::vector<std::string> &deps)
+    {
+        std::vector<std::string> srcs;
+        for (const auto &tu : lib.translationUnits)
+        {
+            srcs.emplace_back("src/" + GeneratorUtilities::removeRootPrefix(tu) + ".cpp");
+        }
+        std::vector<std::string> hdrs;
+        for (const auto &header : lib.headers)
+        {
+            hdrs.emplace_back("include/" + GeneratorUtilities::removeRootPrefix(header) + ".h");
+        }
+        // Template definitions are only ever included, never compiled on their own.
+        std::vector<std::string> textualHdrs;
+        for (const auto &templateFile : lib.templateFiles)
+        {
+            textualHdrs.emplace_back("include/" + GeneratorUtilities::removeRootPrefix(templateFile) + ".tpp");
+        }
+        std::vector<std::string> includes;
+        for (const auto &subDir : lib.subDirectories)
+        {
+            std::string includePath = bazelIncludePath(subDir);
+            if (std::find(includes.begin(), includes.end(), includePath) == includes.end())
+            {
+                includes.emplace_back(includePath);
+            }
+        }
+
+        std::string rule = "cc_library(\n";
+        rule += "    name = \"" + name + "\",\n";
+        rule += bazelListAttribute("srcs", srcs);
+        rule += bazelListAttribute("hdrs", hdrs);
+        rule += bazelListAttribute("textual_hdrs", textualHdrs);
+        rule += bazelListAttribute("includes", includes);
+        rule += bazelListAttribute("deps", deps);
+        rule += "    copts = COPTS,\n";
+        rule += "    visibility = [\"//visibility:public\"],\n";
+        rule += ")\n\n";
+        return rule;
+    }
+
     /**
      * @brief Generates CMake snippet for the main binary target.
      *
@@ -134,6 +704,11 @@ namespace
                 libraryDirs.push_back(relPath);
             }
         }
+        if (projMeta.options.profiler)
+        {
+            // The profiling sources build their own target.
+            libraryDirs.emplace_back(ProfilerGenerator::LIBRARY_NAME);
+        }
 
         if (!mainBinary)
         {
@@ -177,10 +752,159 @@ target_include_directories(${MAIN_TARGET} PUBLIC ${CMAKE_SOURCE_DIR}/include)
                 snippet += "target_link_libraries(${MAIN_TARGET} PUBLIC " + lib.name + ")\n";
             }
         }
+        if (projMeta.options.profiler)
+        {
+            snippet += std::format("target_link_libraries(${{MAIN_TARGET}} PUBLIC {})\n", ProfilerGenerator::LIBRARY_NAME);
+        }
 
         return snippet;
     }
 
+    /**
+     * @brief Generates CMake snippet for the generated tests and benchmarks.
+     *
+     * Every test is an executable registered with CTest. Tests of library files link the library.
+     * Project-level files are only built into the main executable, so when they are tested their
+     * sources (all but main.cpp) are also compiled once into the `<Project>_lib` object library,
+     * which links every library like the main binary does. Benchmarks carry the "benchmark"
+     * label, so `ctest -L benchmark` runs them alone.
+     *
+     * @param projMeta The project metadata containing the tests and library information.
+     * @return A string containing the CMake commands, or an empty string if there are no tests.
+     * @note Must follow generateMainBinaryTarget(), whose ALL_SRCS list it reuses.
+     */
+    std::string generateTestTargets(const ProjectMetadata::ProjMetadata &projMeta)
+    {
+        if (projMeta.tests.empty())
+        {
+            return "";
+        }
+
+        std::string snippet = "# Generated Tests\nenable_testing()\n";
+        const bool testsProjectLevel = std::any_of(projMeta.tests.begin(), projMeta.tests.end(), [](const auto &test)
+                                                   { return test.isProjLevel; });
+        if (testsProjectLevel)
+        {
+            snippet += R"(
+# Project-level sources for the tests, built once.
+set(TESTED_SRCS ${ALL_SRCS})
+list(FILTER TESTED_SRCS EXCLUDE REGEX "${CMAKE_SOURCE_DIR}/src/main\\.cpp$")
+add_library(${MAIN_TARGET}_lib OBJECT ${TESTED_SRCS})
+)";
+            for (const auto &[_, lib] : projMeta.libraries)
+            {
+                if (lib.isProjLevel)
+                {
+                    // Sources include their headers by file name.
+                    for (const auto &subDir : lib.subDirectories)
+                    {
+                        std::string subRelPath = GeneratorUtilities::removeRootPrefix(subDir);
+                        snippet += std::format("target_include_directories(${{MAIN_TARGET}}_lib PUBLIC ${{CMAKE_SOURCE_DIR}}/include{})\n",
+                                               subRelPath.empty() || subRelPath == "ROOT" ? "" : "/" + subRelPath);
+                    }
+                }
+                else
+                {
+                    snippet += "target_link_libraries(${MAIN_TARGET}_lib PUBLIC " + lib.name + ")\n";
+                }
+            }
+            if (projMeta.options.profiler)
+            {
+                snippet += std::format("target_link_libraries(${{MAIN_TARGET}}_lib PUBLIC {})\n", ProfilerGenerator::LIBRARY_NAME);
+            }
+        }
+
+        for (const auto &test : projMeta.tests)
+        {
+            snippet += "\n";
+            snippet += std::format("add_executable({} {})\n", test.name, test.source);
+            snippet += std::format("target_link_libraries({} PRIVATE {})\n", test.name,
+                                   test.isProjLevel ? "${MAIN_TARGET}_lib" : test.library);
+            snippet += std::format("add_test(NAME {0} COMMAND {0})\n", test.name);
+            if (test.isBenchmark)
+            {
+                snippet += std::format("set_tests_properties({} PROPERTIES LABELS benchmark)\n", test.name);
+            }
+        }
+        return snippet;
+    }
+
+    /**
+     * @brief Generates a gdb launch configuration for the project binary in a build directory.
+     *
+     * @param name The configuration name shown in VS Code.
+     * @param buildDir The build directory relative to the workspace folder.
+     * @param projectName The name of the project binary.
+     * @param preLaunchTask The task that builds the binary before launching.
+     * @return The launch configuration as a JSON object.
+     */
+    std::string generateGdbLaunch(const std::string &name, const std::string &buildDir, const std::string &projectName,
+                                  const std::string &preLaunchTask)
+    {
+        std::ostringstream oss;
+        oss << "        {\n"
+            << "            \"name\": \"" << name << "\",\n"
+            << "            \"type\": \"cppdbg\",\n"
+            << "            \"request\": \"launch\",\n"
+            << "            \"program\": \"${workspaceFolder}/" << buildDir << "/" << projectName << "\",\n"
+            << "            \"args\": [],\n"
+            << "            \"stopAtEntry\": false,\n"
+            << "            \"cwd\": \"${workspaceFolder}/" << buildDir << "\",\n"
+            << "            \"environment\": [],\n"
+            << "            \"externalConsole\": false,\n"
+            << "            \"MIMode\": \"gdb\",\n"
+            << "            \"preLaunchTask\": \"" << preLaunchTask << "\"\n"
+            << "        }";
+        return oss.str();
+    }
+
+    /**
+     * @brief Generates a VS Code shell task running a command through bash.
+     *
+     * Tasks in the build group report compiler diagnostics through the gcc problem matcher;
+     * other tasks only run tools and match nothing.
+     *
+     * @param label The task label.
+     * @param command The bash command line.
+     * @param group The task group, "build" or "test".
+     * @param dependsOn Label of a task to run first, or empty for none.
+     * @return The task as a JSON object.
+     */
+    std::string generateShellTask(const std::string &label, const std::string &command, const std::string &group,
+                                  const std::string &dependsOn = "")
+    {
+        std::ostringstream oss;
+        oss << "        {\n"
+            << "            \"label\": \"" << label << "\",\n"
+            << "            \"type\": \"shell\",\n"
+            << "            \"command\": \"/bin/bash\",\n"
+            << "            \"args\": [\n"
+            << "                \"-c\",\n"
+            << "                \"" << command << "\"\n"
+            << "            ],\n";
+        if (!dependsOn.empty())
+        {
+            oss << "            \"dependsOn\": \"" << dependsOn << "\",\n";
+        }
+        oss << "            \"group\": \"" << group << "\",\n"
+            << "            \"presentation\": {\n"
+            << "                \"reveal\": \"always\",\n"
+            << "                \"panel\": \"shared\"\n"
+            << "            },\n";
+        if (group == "build")
+        {
+            oss << "            \"problemMatcher\": [\n"
+                << "                \"$gcc\"\n"
+                << "            ]\n";
+        }
+        else
+        {
+            oss << "            \"problemMatcher\": []\n";
+        }
+        oss << "        }";
+        return oss.str();
+    }
+
 }
 
 namespace BuildToolGenerator
@@ -197,37 +921,356 @@ namespace BuildToolGenerator
         cmakeFile << "# Global include directory\n";
         cmakeFile << "include_directories(${CMAKE_SOURCE_DIR}/include)\n\n";
 
+        // Optimised build settings driven by CMakePresets.json.
+        cmakeFile << generateOptimisationSettings();
+        cmakeFile << generateInterferenceSizeSetting(projMetaData);
+        cmakeFile << generateTracingOption(projMetaData);
+        cmakeFile << generateErrorHandlingSettings(projMetaData);
+        cmakeFile << generateProfilerTarget(projMetaData);
+
         // Generate library targets based on metadata (non-project-level libraries)
-        cmakeFile << "# Library Targets\n";
-        cmakeFile << generateLibraryTargets(projMetaData);
+        if (projMetaData.options.cmakeLayout == CodeGroupModels::CMakeLayout::SUBPROJECTS)
+        {
+            // Each library declares and exports its own target.
+            cmakeFile << "# Library Subprojects\n";
+            cmakeFile << generateLibrarySubdirectories(projMetaData);
+        }
+        else
+        {
+            cmakeFile << "# Library Targets\n";
+            cmakeFile << generateLibraryTargets(projMetaData);
+        }
 
         // Generate main binary target which excludes library directories in src.
         cmakeFile << "# Main Binary Target\n";
         cmakeFile << generateMainBinaryTarget(projMetaData) << "\n";
 
+        // Generate the tests and benchmarks recorded while building the directory tree.
+        const std::string tests = generateTestTargets(projMetaData);
+        if (!tests.empty())
+        {
+            cmakeFile << tests << "\n";
+        }
+
         return cmakeFile.str();
     }
 
-    std::pair<std::string, std::string> generateVscodeJSONs(const std::string &projectName)
+    std::vector<std::pair<std::string, std::string>> generateLibraryCmakeLists(const ProjectMetadata::ProjMetadata &projMetaData)
+    {
+        std::vector<std::pair<std::string, std::string>> subprojects;
+        if (projMetaData.options.cmakeLayout != CodeGroupModels::CMakeLayout::SUBPROJECTS)
+        {
+            return subprojects;
+        }
+
+        // Exported targets are namespaced by the project name.
+        std::string exportNamespace;
+        for (const auto &[_, lib] : projMetaData.libraries)
+        {
+            if (lib.isProjLevel)
+            {
+                exportNamespace = lib.name;
+            }
+        }
+        if (exportNamespace.empty())
+        {
+            throw std::runtime_error("Error: No project-level (main binary) target defined in metadata.\n");
+        }
+
+        const std::vector<std::string> supportHeaders = collectSupportHeaders(projMetaData);
+        for (const auto &[_, lib] : projMetaData.libraries)
+        {
+            if (!lib.isProjLevel)
+            {
+                subprojects.emplace_back(GeneratorUtilities::removeRootPrefix(lib.relativePath),
+                                         generateLibrarySubproject(lib, exportNamespace, supportHeaders));
+            }
+        }
+        return subprojects;
+    }
+
+    std::pair<std::string, std::string> generateBazelFiles(const ProjectMetadata::ProjMetadata &projMetaData, const std::string &version)
+    {
+        // Collect libraries in name order so the output is stable.
+        const ProjectMetadata::LibraryMetadata *mainBinary = nullptr;
+        std::vector<const ProjectMetadata::LibraryMetadata *> libraries;
+        for (const auto &[_, lib] : projMetaData.libraries)
+        {
+            if (lib.isProjLevel)
+            {
+                mainBinary = &lib;
+            }
+            else
+            {
+                libraries.push_back(&lib);
+            }
+        }
+        if (!mainBinary)
+        {
+            throw std::runtime_error("Error: No project-level (main binary) target defined in metadata.\n");
+        }
+        std::sort(libraries.begin(), libraries.end(), [](const auto *a, const auto *b)
+                  { return a->name < b->name; });
+
+        std::ostringstream buildOss;
+        buildOss << "load(\"@rules_cc//cc:defs.bzl\", \"cc_binary\", \"cc_library\""
+                 << (projMetaData.tests.empty() ? "" : ", \"cc_test\"") << ")\n\n";
+        const bool exceptionFree = projMetaData.options.errors == CodeGroupModels::ErrorHandling::EXPECTED;
+        buildOss << "COPTS = [\"-std=c++23\"" << (exceptionFree ? ", \"-fno-exceptions\"" : "") << "]\n\n";
+        if (projMetaData.tracing)
+        {
+            buildOss << "# Build with --copt=-D" << TracingGenerator::optionName(mainBinary->name)
+                     << " to compile the trace scopes of instrumented callables.\n\n";
+        }
+
+        // Support headers shared by generated code (e.g. the binary serialisation runtime) get their own rule.
+        const std::string profilerHeader = std::string("include/") + ProfilerGenerator::HEADER;
+        const std::vector<std::string> supportHeaders = collectSupportHeaders(projMetaData);
+        std::vector<std::string> supportLabels;
+        if (!supportHeaders.empty())
+        {
+            const std::string supportLibrary = mainBinary->name + "_support";
+            buildOss << "# Support headers\n";
+            buildOss << "cc_library(\n";
+            buildOss << "    name = \"" << supportLibrary << "\",\n";
+            buildOss << bazelListAttribute("hdrs", supportHeaders);
+            buildOss << bazelListAttribute("includes", {"include"});
+            buildOss << "    visibility = [\"//visibility:public\"],\n";
+            buildOss << ")\n\n";
+            supportLabels.emplace_back(":" + supportLibrary);
+        }
+        if (projMetaData.options.profiler)
+        {
+            // Every library may record into the profiler, so it is linked like the support headers.
+            buildOss << "# Built-in profiler\n";
+            buildOss << "cc_library(\n";
+            buildOss << "    name = \"" << ProfilerGenerator::LIBRARY_NAME << "\",\n";
+            buildOss << bazelListAttribute("srcs", {std::string("src/") + ProfilerGenerator::SOURCE});
+            buildOss << bazelListAttribute("hdrs", {profilerHeader});
+            buildOss << bazelListAttribute("includes", {"include"});
+            buildOss << "    copts = COPTS,\n";
+            buildOss << bazelListAttribute("linkopts", {"-pthread"});
+            buildOss << "    visibility = [\"//visibility:public\"],\n";
+            buildOss << ")\n\n";
+            supportLabels.emplace_back(std::string(":") + ProfilerGenerator::LIBRARY_NAME);
+        }
+
+        // One rule per library rather than per folder: folders of a library may include each other freely.
+        std::vector<std::string> libraryLabels;
+        for (const auto *lib : libraries)
+        {
+            buildOss << "# Library " << lib->name << "\n";
+            buildOss << generateBazelLibrary(lib->name, *lib, supportLabels);
+            libraryLabels.emplace_back(":" + lib->name);
+        }
+
+        // Project-level sources sit in a library so they get include paths; main.cpp links it.
+        const std::string projectLibrary = mainBinary->name + "_lib";
+        buildOss << "# Project-level sources\n";
+        std::vector<std::string> projectDeps = libraryLabels;
+        projectDeps.insert(projectDeps.end(), supportLabels.begin(), supportLabels.end());
+        buildOss << generateBazelLibrary(projectLibrary, *mainBinary, projectDeps);
+
+        buildOss << "# Main Binary Target\n";
+        buildOss << "cc_binary(\n";
+        buildOss << "    name = \"" << mainBinary->name << "\",\n";
+        buildOss << "    srcs = [\"src/main.cpp\"],\n";
+        buildOss << "    deps = [\":" << projectLibrary << "\"],\n";
+        buildOss << "    copts = COPTS,\n";
+        buildOss << ")\n";
+
+        // Generated tests depend on the rule building the tested file; benchmarks are tagged.
+        for (const auto &test : projMetaData.tests)
+        {
+            buildOss << "\ncc_test(\n";
+            buildOss << "    name = \"" << test.name << "\",\n";
+            buildOss << bazelListAttribute("srcs", {test.source});
+            buildOss << bazelListAttribute("deps", {":" + (test.isProjLevel ? projectLibrary : test.library)});
+            buildOss << "    copts = COPTS,\n";
+            if (test.isBenchmark)
+            {
+                buildOss << bazelListAttribute("tags", {"benchmark"});
+            }
+            buildOss << ")\n";
+        }
+
+        // Bazel module names are lower case.
+        std::string moduleName = mainBinary->name;
+        std::transform(moduleName.begin(), moduleName.end(), moduleName.begin(), [](unsigned char c)
+                       { return static_cast<char>(std::tolower(c)); });
+
+        std::ostringstream moduleOss;
+        moduleOss << "module(\n";
+        moduleOss << "    name = \"" << moduleName << "\",\n";
+        if (!version.empty())
+        {
+            moduleOss << "    version = \"" << version << "\",\n";
+        }
+        moduleOss << ")\n\n";
+        moduleOss << "bazel_dep(name = \"rules_cc\", version = \"0.1.1\")\n";
+
+        // DSL dependencies name CMake packages; they have no mechanical Bazel equivalent.
+        std::vector<std::string> externalDeps;
+        for (const auto &[_, lib] : projMetaData.libraries)
+        {
+            for (const auto &dep : lib.dependencies)
+            {
+                if (std::find(externalDeps.begin(), externalDeps.end(), dep) == externalDeps.end())
+                {
+                    externalDeps.push_back(dep);
+                }
+            }
+        }
+        std::sort(externalDeps.begin(), externalDeps.end());
+        if (!externalDeps.empty())
+        {
+            moduleOss << "\n# Dependencies declared in the DSL as CMake packages. Add the matching\n";
+            moduleOss << "# bazel_dep and reference its targets from the deps in BUILD.bazel.\n";
+            for (const auto &dep : externalDeps)
+            {
+                moduleOss << "# - " << dep << "\n";
+            }
+        }
+
+        return {buildOss.str(), moduleOss.str()};
+    }
+
+    std::string generateCmakePresets(const std::string &projectName)
+    {
+        // Presets build into build/<presetName>, except the PGO stages which share build/pgo:
+        // GCC keys profile data by object file path, so both stages must compile the same paths.
+        std::ostringstream presetsOss;
+        presetsOss << "{\n"
+                   << "    \"version\": 3,\n"
+                   << "    \"cmakeMinimumRequired\": { \"major\": 3, \"minor\": 21, \"patch\": 0 },\n"
+                   << "    \"configurePresets\": [\n"
+                   << "        {\n"
+                   << "            \"name\": \"base\",\n"
+                   << "            \"hidden\": true,\n"
+                   << "            \"binaryDir\": \"${sourceDir}/build/${presetName}\"\n"
+                   << "        },\n"
+                   << "        {\n"
+                   << "            \"name\": \"debug\",\n"
+                   << "            \"displayName\": \"" << projectName << " Debug\",\n"
+                   << "            \"inherits\": \"base\",\n"
+                   << "            \"cacheVariables\": { \"CMAKE_BUILD_TYPE\": \"Debug\" }\n"
+                   << "        },\n"
+                   << "        {\n"
+                   << "            \"name\": \"dev\",\n"
+                   << "            \"displayName\": \"" << projectName << " Dev (fast relink)\",\n"
+                   << "            \"inherits\": \"base\",\n"
+                   << "            \"cacheVariables\": { \"CMAKE_BUILD_TYPE\": \"Debug\", \"ENABLE_DEV_BUILD\": \"ON\" }\n"
+                   << "        },\n"
+                   << "        {\n"
+                   << "            \"name\": \"release\",\n"
+                   << "            \"displayName\": \"" << projectName << " Release (LTO)\",\n"
+                   << "            \"inherits\": \"base\",\n"
+                   << "            \"cacheVariables\": { \"CMAKE_BUILD_TYPE\": \"Release\", \"ENABLE_IPO\": \"ON\" }\n"
+                   << "        },\n"
+                   << "        {\n"
+                   << "            \"name\": \"profile\",\n"
+                   << "            \"displayName\": \"" << projectName << " Profile (RelWithDebInfo)\",\n"
+                   << "            \"inherits\": \"base\",\n"
+                   << "            \"cacheVariables\": { \"CMAKE_BUILD_TYPE\": \"RelWithDebInfo\", \"CMAKE_CXX_FLAGS\": \"-fno-omit-frame-pointer\" }\n"
+                   << "        },\n"
+                   << "        {\n"
+                   << "            \"name\": \"pgo-instrument\",\n"
+                   << "            \"displayName\": \"" << projectName << " PGO Instrumented\",\n"
+                   << "            \"inherits\": \"release\",\n"
+                   << "            \"binaryDir\": \"${sourceDir}/build/pgo\",\n"
+                   << "            \"cacheVariables\": { \"PGO_MODE\": \"GENERATE\", \"PGO_PROFILE_DIR\": \"${sourceDir}/pgo-profiles\" }\n"
+                   << "        },\n"
+                   << "        {\n"
+                   << "            \"name\": \"pgo-use\",\n"
+                   << "            \"displayName\": \"" << projectName << " PGO Optimised\",\n"
+                   << "            \"inherits\": \"release\",\n"
+                   << "            \"binaryDir\": \"${sourceDir}/build/pgo\",\n"
+                   << "            \"cacheVariables\": { \"PGO_MODE\": \"USE\", \"PGO_PROFILE_DIR\": \"${sourceDir}/pgo-profiles\" }\n"
+                   << "        }\n"
+                   << "    ],\n"
+                   << "    \"buildPresets\": [\n"
+                   << "        { \"name\": \"debug\", \"configurePreset\": \"debug\" },\n"
+                   << "        { \"name\": \"dev\", \"configurePreset\": \"dev\" },\n"
+                   << "        { \"name\": \"release\", \"configurePreset\": \"release\" },\n"
+                   << "        { \"name\": \"profile\", \"configurePreset\": \"profile\" },\n"
+                   << "        { \"name\": \"pgo-instrument\", \"configurePreset\": \"pgo-instrument\" },\n"
+                   << "        { \"name\": \"pgo-use\", \"configurePreset\": \"pgo-use\" }\n"
+                   << "    ]\n"
+                   << "}";
+
+        return presetsOss.str();
+    }
+
+    std::string generateCompileCommands(const ProjectMetadata::ProjMetadata &projMetaData, const std::string &projectRoot)
+    {
+        std::vector<std::string> entries;
+        const std::vector<std::string> compileFlags = generateCompileFlags(projMetaData);
+
+        for (const auto &[_, lib] : projMetaData.libraries)
+        {
+            // main.cpp is written alongside the project-level sources.
+            std::vector<std::string> sourceFiles;
+            for (const auto &tu : lib.translationUnits)
+            {
+                sourceFiles.emplace_back(projectRoot + "/src/" + GeneratorUtilities::removeRootPrefix(tu) + ".cpp");
+            }
+            if (lib.isProjLevel)
+            {
+                sourceFiles.emplace_back(projectRoot + "/src/main.cpp");
+            }
+
+            const auto arguments = withIncludeFlags(compileFlags, generateIncludeFlags(lib, projMetaData, projectRoot));
+            for (const auto &file : sourceFiles)
+            {
+                entries.emplace_back(generateCompileCommand(projectRoot, file, arguments));
+            }
+        }
+
+        // Tests and benchmarks see the include directories of the library they link.
+        for (const auto &test : projMetaData.tests)
+        {
+            const auto &lib = projMetaData.libraries.at(test.isProjLevel ? "proj" : test.library);
+            entries.emplace_back(generateCompileCommand(projectRoot, projectRoot + "/" + test.source,
+                                                        withIncludeFlags(compileFlags, generateIncludeFlags(lib, projMetaData, projectRoot))));
+        }
+
+        if (projMetaData.options.profiler)
+        {
+            // The profiling library only needs the project include directory.
+            entries.emplace_back(generateCompileCommand(projectRoot, projectRoot + "/src/" + ProfilerGenerator::SOURCE,
+                                                        withIncludeFlags(compileFlags, {"-I" + projectRoot + "/include"})));
+        }
+
+        // Library iteration order is unspecified; sort so regenerating yields identical output.
+        std::sort(entries.begin(), entries.end());
+
+        std::ostringstream database;
+        database << "[\n";
+        for (size_t i = 0; i < entries.size(); ++i)
+        {
+            database << entries[i] << (i + 1 < entries.size() ? ",\n" : "\n");
+        }
+        database << "]";
+
+        return database.str();
+    }
+
+    std::pair<std::string, std::string> generateVscodeJSONs(const std::string &projectName, const bool profilingTools)
     {
         // Build the launch.json configuration using an ostringstream.
         std::ostringstream launchOss;
         launchOss << "{\n"
                   << "    \"version\": \"0.2.0\",\n"
                   << "    \"configurations\": [\n"
-                  << "        {\n"
-                  << "            \"name\": \"Debug " << projectName << "\",\n"
-                  << "            \"type\": \"cppdbg\",\n"
-                  << "            \"request\": \"launch\",\n"
-                  << "            \"program\": \"${workspaceFolder}/build-" << projectName << "/" << projectName << "\",\n"
-                  << "            \"args\": [],\n"
-                  << "            \"stopAtEntry\": false,\n"
-                  << "            \"cwd\": \"${workspaceFolder}/build-" << projectName << "\",\n"
-                  << "            \"environment\": [],\n"
-                  << "            \"externalConsole\": false,\n"
-                  << "            \"MIMode\": \"gdb\",\n"
-                  << "            \"preLaunchTask\": \"Build and Run " << projectName << "\"\n"
-                  << "        }\n"
+                  << generateGdbLaunch("Debug " + projectName, "build-" + projectName, projectName, "Build and Run " + projectName) << ",\n"
+                  << generateGdbLaunch("Debug " + projectName + " (dev)", "build/dev", projectName, "Dev Build " + projectName);
+        if (profilingTools)
+        {
+            // Optimised code with debug info, for stepping through what the profiler reported.
+            launchOss << ",\n"
+                      << generateGdbLaunch("Profile " + projectName, "build/profile", projectName, "Profile Build " + projectName);
+        }
+        launchOss << "\n"
                   << "    ]\n"
                   << "}";
 
@@ -255,7 +1298,37 @@ namespace BuildToolGenerator
         tasksOss << "            \"problemMatcher\": [\n";
         tasksOss << "                \"$gcc\"\n";
         tasksOss << "            ]\n";
-        tasksOss << "        }\n";
+        tasksOss << "        },\n";
+        // Developer inner loop: shared libraries and a fast linker keep relinks short.
+        tasksOss << generateShellTask("Dev Build " + projectName, "cmake --preset dev && cmake --build --preset dev", "build") << ",\n";
+        // Train-then-rebuild loop: instrumented build, training run, profile-optimised rebuild.
+        tasksOss << generateShellTask("PGO Train and Rebuild " + projectName,
+                                      "rm -rf pgo-profiles && cmake --preset pgo-instrument && cmake --build --preset pgo-instrument"
+                                      " && ./build/pgo/" + projectName +
+                                          " && cmake --preset pgo-use && cmake --build --preset pgo-use --clean-first",
+                                      "build");
+        if (profilingTools)
+        {
+            // Investigation loop: every tool runs against the RelWithDebInfo binary from the profile preset.
+            const std::string profileBuild = "Profile Build " + projectName;
+            const std::string binary = "./build/profile/" + projectName;
+            tasksOss << ",\n"
+                     << generateShellTask(profileBuild, "cmake --preset profile && cmake --build --preset profile", "build") << ",\n"
+                     << generateShellTask("Perf Record " + projectName,
+                                          "perf record -g -o build/profile/perf.data " + binary, "test", profileBuild)
+                     << ",\n"
+                     << generateShellTask("Perf Report " + projectName, "perf report -i build/profile/perf.data", "test") << ",\n"
+                     // heaptrack is far cheaper to run; massif is the fallback found on most systems with valgrind.
+                     << generateShellTask("Heap Profile " + projectName,
+                                          "if command -v heaptrack >/dev/null; then heaptrack -o build/profile/heaptrack." + projectName + " " + binary +
+                                              "; else valgrind --tool=massif --massif-out-file=build/profile/massif.out " + binary +
+                                              " && ms_print build/profile/massif.out; fi",
+                                          "test", profileBuild)
+                     << ",\n"
+                     << generateShellTask("Run Benchmarks " + projectName,
+                                          "ctest --test-dir build/profile -L benchmark --output-on-failure", "test", profileBuild);
+        }
+        tasksOss << "\n";
         tasksOss << "    ]\n";
         tasksOss << "}";
 
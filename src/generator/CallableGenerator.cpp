@@ -2,62 +2,126 @@
 #include "PropertiesGenerator.h"
 #include "GeneratorUtilities.h"
 #include "CallableModels.h"
+#include "ErrorGenerator.h"
+#include "TracingGenerator.h"
 
 #include <sstream>
 #include <format>
 #include <stdexcept>
 
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ */
+namespace
+{
+    /**
+     * @brief Returns the placeholder statement of an unimplemented callable's body.
+     *
+     * A throw escaping a noexcept function terminates anyway (and GCC warns about it), so
+     * noexcept stubs terminate explicitly. Without exceptions, callables returning std::expected
+     * return an error and the others terminate.
+     *
+     * @param callable The callable model.
+     * @return The statement, without indentation or trailing newline.
+     */
+    std::string notImplementedStatement(const CallableModels::CallableModel &callable)
+    {
+        if (ErrorGenerator::returnsExpected(callable))
+            return ErrorGenerator::notImplementedStatement();
+        return callable.isNoexcept || callable.expected ? "std::terminate(); // Not implemented"
+                                                        : "throw std::runtime_error(\"Not implemented\");";
+    }
+
+    /**
+     * @brief Returns the body statements of an unimplemented callable after its TODO comment.
+     *
+     * constexpr bodies cannot throw, so they return a value-initialised result instead.
+     *
+     * @param callable The callable model.
+     * @param returnTypeStr The return type the callable is generated with.
+     * @param isConstexpr True if the callable is constexpr.
+     * @return The statement, without indentation or trailing newline.
+     */
+    std::string stubStatement(const CallableModels::CallableModel &callable, const std::string &returnTypeStr,
+                              const bool isConstexpr)
+    {
+        if (!isConstexpr || ErrorGenerator::returnsExpected(callable))
+            return notImplementedStatement(callable);
+        return "return" + (!returnTypeStr.contains("void") ? " " + returnTypeStr + "()" : "") + ";";
+    }
+
+    /**
+     * @brief Returns the trace statement opening an instrumented body, followed by the body's indentation.
+     *
+     * @param callable The callable model.
+     * @param scopeName The name the scope is reported under, e.g. "Order::submit".
+     * @return The statement line, or an empty string if the callable is not instrumented.
+     */
+    std::string traceLine(const CallableModels::CallableModel &callable, const std::string &scopeName)
+    {
+        const std::string statement = TracingGenerator::traceStatement(callable, scopeName);
+        return statement.empty() ? "" : statement + "\n    ";
+    }
+
+} // end anonymous namespace
+
 namespace CallableGenerator
 {
     //--------------------------------------------------------------------------
     // Base Generators (operate on CallableModel)
     //--------------------------------------------------------------------------
 
-    std::string generateCallableDeclaration(const CallableModels::CallableModel &callable)
+    std::string generateCallableDeclaration(const CallableModels::CallableModel &callable, const std::string &scope)
     {
         // Convert the callable's return type to its string representation.
-        std::string returnTypeStr = GeneratorUtilities::dataTypeToString(callable.returnType);
+        std::string returnTypeStr = ErrorGenerator::returnType(callable);
 
         // Generate the parameter list string.
         std::string paramList = PropertiesGenerator::generateParameterList(callable.parameters);
 
         // Retrieve the declaration specifiers (e.g., inline, static).
         std::string declSpec = PropertiesGenerator::generateDeclarationSpecifier(callable.declSpec);
+        std::string noexceptSpec = callable.isNoexcept ? " noexcept" : "";
 
         // Build a Doxygen comment block.
         std::string result = "/**\n";
         result += " * @brief " + callable.description + "\n";
+        result += GeneratorUtilities::templateParameterDoxygen(callable.templateSpec);
         result += " */\n";
+        // Templates are introduced by their template head.
+        result += GeneratorUtilities::templateHeader(callable.templateSpec);
 
         // Construct the free callable declaration.
         if (callable.declSpec.isInline)
         {
             // Define a default body that signals unimplemented functionality.
-            std::string body = "// TODO: Implement " + callable.name + " logic.\n";
-            body += "    throw std::runtime_error(\"Not implemented\");";
-            result += std::format("{}{} {}({}) {{\n    {}\n}}\n",
+            std::string body = traceLine(callable, scope + callable.name) + "// TODO: Implement " + callable.name + " logic.\n";
+            body += "    " + notImplementedStatement(callable);
+            result += std::format("{}{} {}({}){} {{\n    {}\n}}\n",
                                   declSpec,
                                   returnTypeStr,
                                   callable.name,
                                   paramList,
+                                  noexceptSpec,
                                   body);
         }
         else
         {
-            result += std::format("{}{} {}({});\n",
+            result += std::format("{}{} {}({}){};\n",
                                   declSpec,
                                   returnTypeStr,
                                   callable.name,
-                                  paramList);
+                                  paramList,
+                                  noexceptSpec);
         }
 
         return result;
     }
 
-    std::string generateCallableDefinition(const CallableModels::CallableModel &callable)
+    std::string generateCallableDefinition(const CallableModels::CallableModel &callable, const std::string &scope)
     {
         // Convert the callable's return type to its string representation.
-        std::string returnTypeStr = GeneratorUtilities::dataTypeToString(callable.returnType);
+        std::string returnTypeStr = ErrorGenerator::returnType(callable);
 
         // Generate the parameter list string.
         std::string paramList = PropertiesGenerator::generateParameterList(callable.parameters);
@@ -66,84 +130,122 @@ namespace CallableGenerator
         std::string declSpec = PropertiesGenerator::generateDeclarationSpecifier(callable.declSpec, true);
 
         // Define a default body that signals unimplemented functionality.
-        std::string body = "// TODO: Implement " + callable.name + " logic.";
-        // constexpr methods/functions cannot throw errors
-        if (!declSpec.contains("constexpr"))
-        {
-            body += "\n    throw std::runtime_error(\"Not implemented\");";
-        }
-        else
-        {
-            // constexpr methods/functions must return something
-            body += "\n    return" + (!returnTypeStr.contains("void") ? " " + returnTypeStr + "()" : "") + ";";
-        }
+        std::string body = traceLine(callable, scope + callable.name) + "// TODO: Implement " + callable.name + " logic.";
+        body += "\n    " + stubStatement(callable, returnTypeStr, declSpec.contains("constexpr"));
 
         // Construct the free callable definition.
         // Inline methods do not get defined in cpp file
         std::string definition = "";
         if (!callable.declSpec.isInline)
         {
-            definition = std::format("{}{} {}({}) {{\n    {}\n}}\n",
+            definition = std::format("{}{}{} {}({}){} {{\n    {}\n}}\n",
+                                     GeneratorUtilities::templateHeader(callable.templateSpec),
                                      declSpec,
                                      returnTypeStr,
                                      callable.name,
                                      paramList,
+                                     callable.isNoexcept ? " noexcept" : "",
                                      body);
         }
 
         return definition;
     }
 
+    std::string generateInlineFunctionDeclaration(const CallableModels::FunctionModel &func, const std::string &scope)
+    {
+        // Mark a copy of the function inline so the base generator emits its body in place.
+        CallableModels::FunctionModel inlineFunc = func;
+        inlineFunc.declSpec.isInline = true;
+        return generateCallableDeclaration(inlineFunc, scope);
+    }
+
     //--------------------------------------------------------------------------
     // Method Generators (wrap the base generators)
     //--------------------------------------------------------------------------
 
-    std::string generateMethodDeclaration(const CallableModels::MethodModel &method)
+    std::string generateMethodDeclaration(const CallableModels::MethodModel &method, const std::string &scope)
     {
         // Generate the free callable declaration using the base generator.
-        std::string decl = generateCallableDeclaration(method);
+        std::string decl = generateCallableDeclaration(method, scope);
 
         // Indent the declaration so it fits inside a class definition.
         return GeneratorUtilities::indentCode(decl);
     }
 
+    std::string generateInlineMethodDeclaration(const CallableModels::MethodModel &method, const std::string &scope)
+    {
+        // Mark a copy of the method inline so its body is emitted inside the class.
+        CallableModels::MethodModel inlineMethod = method;
+        inlineMethod.declSpec.isInline = true;
+        return generateMethodDeclaration(inlineMethod, scope);
+    }
+
     std::string generateMethodDefinition(const std::string &className, const CallableModels::MethodModel &method)
     {
         // Instead of directly using the base definition, rebuild the definition so that the function
         // name is qualified with the owning class name.
-        std::string returnTypeStr = GeneratorUtilities::dataTypeToString(method.returnType);
+        std::string returnTypeStr = ErrorGenerator::returnType(method);
         std::string paramList = PropertiesGenerator::generateParameterList(method.parameters);
         std::string declSpec = PropertiesGenerator::generateDeclarationSpecifier(method.declSpec, true);
-        // Construct body of method with TODO
-        std::string body = "// TODO: Implement " + method.name + " logic.";
-        // constexpr methods/functions cannot throw errors
-        if (!declSpec.contains("constexpr"))
-        {
-            body += "\n    throw std::runtime_error(\"Not implemented\");";
-        }
-        else
-        {
-            // constexpr methods/functions must return something
-            body += "\n    return" + (!returnTypeStr.contains("void") ? " " + returnTypeStr + "()" : "") + ";";
-        }
-
         // Construct the fully qualified method name.
         std::string qualifiedName = className + "::" + method.name;
 
+        // Construct body of method with TODO
+        std::string body = traceLine(method, qualifiedName) + "// TODO: Implement " + method.name + " logic.";
+        body += "\n    " + stubStatement(method, returnTypeStr, declSpec.contains("constexpr"));
+
         // Construct the method definition.
         std::string definition = "";
         // Inline methods do not get defined in cpp file
         if (!method.declSpec.isInline)
         {
-            definition = std::format("{}{} {}({}) {{\n    {}\n}}\n",
+            definition = std::format("{}{}{} {}({}){} {{\n    {}\n}}\n",
+                                     GeneratorUtilities::templateHeader(method.templateSpec),
                                      declSpec,
                                      returnTypeStr,
                                      qualifiedName,
                                      paramList,
+                                     method.isNoexcept ? " noexcept" : "",
                                      body);
         }
 
         return definition;
     }
 
+    std::string generateExplicitInstantiations(const CallableModels::CallableModel &callable, const bool externDecl,
+                                               const std::string &scope)
+    {
+        const auto &spec = callable.templateSpec;
+        std::string returnTypeStr = ErrorGenerator::returnType(callable);
+        std::string paramList = PropertiesGenerator::generateParameterList(callable.parameters);
+
+        // Declaration specifiers such as static are not allowed in explicit instantiations.
+        std::ostringstream oss;
+        for (const auto &arguments : spec.instantiations)
+        {
+            oss << (externDecl ? "extern template " : "template ")
+                << GeneratorUtilities::substituteTemplateArguments(returnTypeStr, spec, arguments) << " "
+                << scope << callable.name << "<" << arguments << ">("
+                << GeneratorUtilities::substituteTemplateArguments(paramList, spec, arguments) << ")"
+                << (callable.isNoexcept ? " noexcept" : "") << ";\n";
+        }
+        return oss.str();
+    }
+
+    std::set<std::string> requiredHeaders(const CallableModels::CallableModel &callable)
+    {
+        std::set<std::string> headers = PropertiesGenerator::requiredHeaders(callable.parameters);
+        headers.merge(GeneratorUtilities::templateParameterHeaders(callable.templateSpec));
+        // std::expected return types and their error codes.
+        if (ErrorGenerator::returnsExpected(callable))
+            headers.merge(ErrorGenerator::requiredHeaders());
+        // std::terminate in noexcept stubs and stubs that cannot return an error.
+        else if (callable.isNoexcept || callable.expected)
+            headers.insert("<exception>");
+        // TRACE_SCOPE in instrumented bodies.
+        if (TracingGenerator::isInstrumented(callable))
+            headers.insert(std::string("\"") + TracingGenerator::SUPPORT_HEADER + "\"");
+        return headers;
+    }
+
 } // namespace CallableGenerator
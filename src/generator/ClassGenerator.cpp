@@ -1,8 +1,18 @@
 #include "ClassGenerator.h"
+#include "AllocatorGenerator.h"
 #include "SpecialMemberGenerator.h"
 #include "CallableGenerator.h"
+#include "ErrorGenerator.h"
 #include "GeneratorUtilities.h"
+#include "LayoutGenerator.h"
+#include "PoolGenerator.h"
+#include "PropertiesGenerator.h"
+#include "ReflectionGenerator.h"
+#include "SerializationGenerator.h"
+#include "SoaGenerator.h"
+#include "ValueGenerator.h"
 
+#include <algorithm>
 #include <sstream>
 #include <format>
 
@@ -14,61 +24,256 @@
  */
 namespace
 {
+    /**
+     * @brief Returns the name qualifying a class's out-of-line member definitions.
+     *
+     * Class templates are named with their own parameters, e.g. `Buffer<T, N>`.
+     */
+    std::string qualifiedName(const ClassModels::ClassModel &cl)
+    {
+        return cl.name + GeneratorUtilities::templateArgumentList(cl.templateSpec);
+    }
+
+    /**
+     * @brief Reports whether a method's definition is a template definition.
+     *
+     * Every member of a class template is a template; other classes only have their member templates.
+     */
+    bool isTemplateDefinition(const ClassModels::ClassModel &cl, const CallableModels::MethodModel &meth)
+    {
+        return cl.templateSpec.isTemplate() || meth.templateSpec.isTemplate();
+    }
+
     /**
      * @brief Helper function to generate method definitions.
      *
      * Iterates over the provided methods and appends each method's definition to the output stream.
+     * Only the template definitions, or only the others, are generated, so that templates can be
+     * defined apart from the source file.
      *
+     * @param cl The ClassModel owning the methods.
      * @param methods The vector of MethodModel objects.
+     * @param templates True to generate the template definitions, false for the others.
      * @param oss The output stream to append the definitions.
      */
-    void classMethodDefinitionGenerator(const std::vector<CallableModels::MethodModel> &methods,
-                                        const std::string &className, std::ostringstream &oss)
+    void classMethodDefinitionGenerator(const ClassModels::ClassModel &cl,
+                                        const std::vector<CallableModels::MethodModel> &methods,
+                                        const bool templates, std::ostringstream &oss)
     {
+        const std::string classTemplate = GeneratorUtilities::templateHeader(cl.templateSpec);
         for (const auto &meth : methods)
         {
+            if (isTemplateDefinition(cl, meth) != templates)
+                continue;
             // Generate the definition for each method and append a newline.
-            oss << CallableGenerator::generateMethodDefinition(className, meth) << "\n";
+            std::string def = CallableGenerator::generateMethodDefinition(qualifiedName(cl), meth);
+            oss << (def.empty() ? "" : classTemplate) << def << "\n";
         }
     }
 
+    /**
+     * @brief Reports whether the class's copy and move members are declared `= default`.
+     *
+     * Trivially copyable classes always default them; otherwise they are defaulted unless the
+     * class asks for custom special members or member-wise semantics would be wrong.
+     */
+    bool defaultsCopyAndMove(const ClassModels::ClassModel &cl)
+    {
+        if (cl.options.triviallyCopyable)
+            return true;
+        return cl.options.specialMembers == ClassModels::SpecialMemberPolicy::DEFAULTED &&
+               SpecialMemberGenerator::isMemberwise(GeneratorUtilities::allMembers(cl));
+    }
+
+    /**
+     * @brief Reports whether the class is allocator-aware.
+     */
+    bool isAllocatorExtended(const ClassModels::ClassModel &cl)
+    {
+        return cl.options.allocator == ClassModels::AllocatorPolicy::PMR;
+    }
+
+    /**
+     * @brief Helper function to generate special member function definitions.
+     *
+     * Appends the out-of-line definitions of the class's constructors, copy/move assignment
+     * operators and destructor, followed by any serialisation members, to the output stream.
+     * Special members that need no out-of-line definition (e.g. defaulted ones) are skipped.
+     *
+     * @param cl The ClassModel whose special members are defined.
+     * @param headerOnly If true, definitions are prefixed with `inline` for header-only output.
+     * @param oss The output stream to append the definitions.
+     */
+    void classSpecialMemberDefinitionGenerator(const ClassModels::ClassModel &cl, const bool headerOnly,
+                                               std::ostringstream &oss)
+    {
+        // Defaulted copy and move members are complete in the class declaration.
+        const bool defaulted = defaultsCopyAndMove(cl);
+
+        // Members of class templates are templates themselves, which never need to be inline.
+        const std::string className = qualifiedName(cl);
+        const std::string prefix = GeneratorUtilities::templateHeader(cl.templateSpec);
+        const bool inlineDef = headerOnly && !cl.templateSpec.isTemplate();
+
+        // Generate definitions for constructors.
+        for (const auto &ctor : cl.constructors)
+        {
+            if (defaulted && ctor.type != ClassModels::ConstructorType::CUSTOM)
+                continue;
+            // Generate out-of-line constructor definition.
+            std::string def = SpecialMemberGenerator::generateConstructorDefinition(className, ctor,
+                                                                                    cl.publicMembers, cl.privateMembers, cl.protectedMembers,
+                                                                                    inlineDef, isAllocatorExtended(cl), cl.options.expected);
+            if (!def.empty())
+            {
+                oss << prefix << def << "\n";
+            }
+        }
+
+        // Exception-free classes construct through create() factories returning std::expected.
+        if (cl.options.expected)
+        {
+            for (const auto &ctor : cl.constructors)
+            {
+                std::string def = SpecialMemberGenerator::generateFactoryDefinition(className, ctor, inlineDef);
+                if (!def.empty())
+                {
+                    oss << prefix << def << "\n";
+                }
+            }
+        }
+
+        // Allocator-aware classes define their allocator-extended constructors.
+        oss << AllocatorGenerator::generateAllocatorDefinitions(cl, className, inlineDef, prefix);
+
+        // Generate definition for copy assignment operator if specified.
+        if (cl.hasCopyAssignment && !defaulted)
+        {
+            std::string def = SpecialMemberGenerator::generateCopyAssignmentDefinition(className, inlineDef, cl.options.expected);
+            if (!def.empty())
+            {
+                oss << prefix << def << "\n";
+            }
+        }
+
+        // Generate definition for move assignment operator if specified.
+        if (cl.hasMoveAssignment && !defaulted)
+        {
+            std::string def = SpecialMemberGenerator::generateMoveAssignmentDefinition(className, inlineDef, GeneratorUtilities::allMembers(cl),
+                                                                                   cl.options.expected);
+            if (!def.empty())
+            {
+                oss << prefix << def << "\n";
+            }
+        }
+
+        // Generate destructor definition if available.
+        if (cl.destructor)
+        {
+            std::string def = SpecialMemberGenerator::generateDestructorDefinition(className);
+            if (!def.empty())
+            {
+                oss << prefix << def << "\n";
+            }
+        }
+
+        // Serialisable classes define their complete serialize() and deserialize() members alongside.
+        oss << SerializationGenerator::generateSerializationDefinitions(cl, className, inlineDef, prefix);
+    }
+
     /**
      * @brief Formats and writes class member declarations.
      *
      * This function iterates over a list of member parameters and writes each declaration
      * into the provided output stream in the format:
      * "    <data type> <member name>; ///< " followed by a newline.
+     * Members that must start a new cache line are prefixed with
+     * alignas(std::hardware_destructive_interference_size).
      * An extra newline is appended after processing all members.
      *
      * @param members The vector of member parameters to format.
+     * @param lineBoundary True if the previously declared member owns its cache line; updated for the last member.
      * @param oss The output string stream where the member declarations are written.
      */
-    void classMemberDeclaration(const std::vector<PropertiesModels::Parameter> &members,
+    void classMemberDeclaration(const std::vector<PropertiesModels::Parameter> &members, bool &lineBoundary,
                                 std::ostringstream &oss)
     {
         // Format list of members
         for (const auto &mem : members)
         {
-            oss << std::format("    {} {}; ///< \n", GeneratorUtilities::dataTypeToString(mem.type), mem.name);
+            std::string alignment = LayoutGenerator::startsCacheLine(mem, lineBoundary)
+                                        ? "alignas(std::hardware_destructive_interference_size) "
+                                        : "";
+            oss << std::format("    {}{} {}; ///< \n", alignment, GeneratorUtilities::dataTypeToString(mem.type), mem.name);
+            lineBoundary = PropertiesModels::hasAnnotation(mem.annotations, PropertiesModels::Annotation::OWN_CACHELINE);
         }
         oss << "\n";
     }
+
+    /**
+     * @brief Generates the Doxygen note reporting the effect of a compact member layout.
+     *
+     * @param cl The class as declared in the DSL.
+     * @return The note line, or an empty string if the class keeps its declared layout.
+     */
+    std::string layoutNote(const ClassModels::ClassModel &cl)
+    {
+        if (cl.options.layout != ClassModels::LayoutPolicy::COMPACT)
+            return "";
+
+        LayoutGenerator::LayoutReport report = LayoutGenerator::estimateLayout(cl);
+        std::string note;
+        if (report.optimisedSize <= report.declaredSize)
+            note = std::format(" * @note Compact layout: estimated {} bytes, {} bytes saved over declared order.",
+                               report.optimisedSize, report.bytesSaved());
+        else
+            note = std::format(" * @note Compact layout: estimated {} bytes, {} bytes more than declared order to group hot and cold members.",
+                               report.optimisedSize, report.optimisedSize - report.declaredSize);
+        if (!report.isComplete)
+            note += " Members of unknown size are not counted.";
+        return note + "\n";
+    }
 }
 
 namespace ClassGenerator
 {
-    std::string generateClassDeclaration(const ClassModels::ClassModel &cl)
+    std::string generateClassDeclaration(const ClassModels::ClassModel &declared, const bool headerOnly)
     {
+        // Members are emitted in layout order; constructors initialise them in the same order.
+        const ClassModels::ClassModel cl = AllocatorGenerator::applyAllocator(LayoutGenerator::orderMembers(declared));
+
+        // Header-only classes define their methods in-class; trace scopes of inline bodies name the class.
+        const std::string scope = qualifiedName(cl) + "::";
+        auto methodDeclaration = [headerOnly, &scope](const CallableModels::MethodModel &meth)
+        {
+            return headerOnly ? CallableGenerator::generateInlineMethodDeclaration(meth, scope)
+                              : CallableGenerator::generateMethodDeclaration(meth, scope);
+        };
+
         std::ostringstream oss;
         // Generate Doxygen-style class comment.
-        oss << "/**\n * @class " << cl.name << "\n * @brief " << cl.description << "\n */\n";
+        oss << "/**\n * @class " << cl.name << "\n * @brief " << cl.description << "\n" << layoutNote(declared)
+            << GeneratorUtilities::templateParameterDoxygen(cl.templateSpec) << " */\n";
         // Start class declaration.
-        oss << "class " << cl.name << " {\npublic:\n";
+        oss << GeneratorUtilities::templateHeader(cl.templateSpec) << "class " << cl.name << " {\npublic:\n";
 
-        // Generate constructor declarations.
+        // The allocator alias comes first, as constructor declarations refer to it.
+        oss << AllocatorGenerator::generateAllocatorDeclarations(cl);
+
+        // Generate constructor declarations; noexcept is inferred from the members.
+        const auto members = GeneratorUtilities::allMembers(cl);
+        const bool defaulted = defaultsCopyAndMove(cl);
         for (const auto &ctor : cl.constructors)
         {
-            oss << SpecialMemberGenerator::generateConstructorDeclaration(cl.name, ctor);
+            oss << SpecialMemberGenerator::generateConstructorDeclaration(cl.name, ctor, members, defaulted,
+                                                                          isAllocatorExtended(cl));
+        }
+        if (cl.options.expected)
+        {
+            for (const auto &ctor : cl.constructors)
+            {
+                oss << SpecialMemberGenerator::generateFactoryDeclaration(cl.name, ctor);
+            }
         }
 
         // Generate destructor declaration if available.
@@ -80,23 +285,30 @@ namespace ClassGenerator
         // Generate copy assignment declaration if specified.
         if (cl.hasCopyAssignment)
         {
-            oss << SpecialMemberGenerator::generateCopyAssignmentDeclaration(cl.name) << "\n";
+            oss << SpecialMemberGenerator::generateCopyAssignmentDeclaration(cl.name, defaulted) << "\n";
         }
 
         // Generate move assignment declaration if specified.
         if (cl.hasMoveAssignment)
         {
-            oss << SpecialMemberGenerator::generateMoveAssignmentDeclaration(cl.name) << "\n";
+            oss << SpecialMemberGenerator::generateMoveAssignmentDeclaration(cl.name, members, defaulted) << "\n";
         }
 
         // Generate declarations for public methods.
         for (const auto &meth : cl.publicMethods)
         {
-            oss << CallableGenerator::generateMethodDeclaration(meth);
+            oss << methodDeclaration(meth);
         }
 
+        // Serialisation members, pooled operators, the reflection table and value operators follow the DSL methods.
+        oss << SerializationGenerator::generateSerializationDeclarations(cl);
+        oss << PoolGenerator::generatePoolDeclarations(cl);
+        oss << ReflectionGenerator::generateReflectionDeclarations(cl);
+        oss << ValueGenerator::generateValueDeclarations(cl);
+
         // Generate declarations for public members.
-        classMemberDeclaration(cl.publicMembers, oss);
+        bool lineBoundary = false;
+        classMemberDeclaration(cl.publicMembers, lineBoundary, oss);
 
         // Generate private section if necessary.
         if (!cl.privateMembers.empty() || !cl.privateMethods.empty())
@@ -104,10 +316,10 @@ namespace ClassGenerator
             oss << "private:\n";
             for (const auto &meth : cl.privateMethods)
             {
-                oss << CallableGenerator::generateMethodDeclaration(meth);
+                oss << methodDeclaration(meth);
             }
 
-            classMemberDeclaration(cl.privateMembers, oss);
+            classMemberDeclaration(cl.privateMembers, lineBoundary, oss);
         }
 
         // Generate protected section if necessary.
@@ -116,73 +328,202 @@ namespace ClassGenerator
             oss << "protected:\n";
             for (const auto &meth : cl.protectedMethods)
             {
-                oss << CallableGenerator::generateMethodDeclaration(meth);
+                oss << methodDeclaration(meth);
             }
 
-            classMemberDeclaration(cl.protectedMembers, oss);
+            classMemberDeclaration(cl.protectedMembers, lineBoundary, oss);
         }
 
         // End class declaration.
         oss << "};\n";
-        return oss.str();
-    }
 
-    std::string generateClassDefinition(const ClassModels::ClassModel &cl)
-    {
-        std::ostringstream oss;
-
-        // Generate definitions for constructors.
-        for (const auto &ctor : cl.constructors)
+        // Keep classes marked trivially copyable from silently losing the property.
+        if (cl.options.triviallyCopyable)
         {
-            // Generate out-of-line constructor definition.
-            std::string def = SpecialMemberGenerator::generateConstructorDefinition(cl.name, ctor,
-                                                                                    cl.publicMembers, cl.privateMembers, cl.protectedMembers);
-            if (!def.empty())
+            // A class template can only be checked for the arguments it is instantiated with.
+            std::vector<std::string> types = {cl.name};
+            if (cl.templateSpec.isTemplate())
+            {
+                types.clear();
+                for (const auto &arguments : cl.templateSpec.instantiations)
+                {
+                    types.push_back(cl.name + "<" + arguments + ">");
+                }
+            }
+            for (const auto &type : types)
             {
-                oss << def << "\n";
+                oss << "\nstatic_assert(std::is_trivially_copyable_v<" << type << ">, \""
+                    << type << " must be trivially copyable\");\n";
             }
         }
 
-        // Generate definition for copy assignment operator if specified.
-        if (cl.hasCopyAssignment)
+        // The struct-of-arrays companion is complete in-class, so it follows the class in every mode.
+        const std::string soa = SoaGenerator::generateSoaDeclaration(cl);
+        if (!soa.empty())
+            oss << "\n" << soa;
+
+        // Header-only classes carry their special member definitions inline after the class.
+        if (headerOnly)
         {
-            std::string def = SpecialMemberGenerator::generateCopyAssignmentDefinition(cl.name);
-            if (!def.empty())
+            std::ostringstream defs;
+            classSpecialMemberDefinitionGenerator(cl, true, defs);
+            if (!defs.str().empty())
             {
-                oss << def << "\n";
+                oss << "\n" << defs.str();
             }
         }
+        return oss.str();
+    }
+
+    std::set<std::string> requiredHeaders(const ClassModels::ClassModel &declared)
+    {
+        const ClassModels::ClassModel cl = AllocatorGenerator::applyAllocator(declared);
+        std::set<std::string> headers = AllocatorGenerator::requiredHeaders(cl);
+        // Every written header already opens with #include <string> (see DiskFileWriter::writeHeaderFile).
+        headers.erase("<string>");
+        headers.merge(SoaGenerator::requiredHeaders(cl));
+        headers.merge(SerializationGenerator::requiredHeaders(cl));
+        headers.merge(PoolGenerator::requiredHeaders(cl));
+        headers.merge(ReflectionGenerator::requiredHeaders(cl));
+        headers.merge(ValueGenerator::requiredHeaders(cl));
+        const auto members = GeneratorUtilities::allMembers(cl);
+        for (const auto &mem : members)
+        {
+            // std::hardware_destructive_interference_size
+            if (PropertiesModels::hasAnnotation(mem.annotations, PropertiesModels::Annotation::OWN_CACHELINE))
+                headers.insert("<new>");
+        }
 
-        // Generate definition for move assignment operator if specified.
+        // Types of non-type template parameters, e.g. std::size_t N.
+        headers.merge(GeneratorUtilities::templateParameterHeaders(cl.templateSpec));
+
+        if (cl.options.triviallyCopyable)
+            headers.insert("<type_traits>");
+
+        // Inferred noexcept is either conditional on type traits or unconditional with terminating stubs.
+        const bool defaulted = defaultsCopyAndMove(cl);
+        auto noteSpecifier = [&headers, &members](const std::string &trait, const bool hasStub)
+        {
+            std::string spec = SpecialMemberGenerator::generateNoexceptSpecifier(members, trait);
+            if (spec != " noexcept")
+                headers.insert("<type_traits>");
+            else if (hasStub)
+                headers.insert("<exception>");
+        };
+        for (const auto &ctor : cl.constructors)
+        {
+            using ClassModels::ConstructorType;
+            headers.merge(PropertiesGenerator::requiredHeaders(ctor.parameters));
+            // std::move in the member-initialiser list.
+            if (SpecialMemberGenerator::movesParameters(ctor, members))
+                headers.insert("<utility>");
+            const bool hasStub = ctor.type == ConstructorType::CUSTOM || (ctor.type != ConstructorType::DEFAULT && !defaulted);
+            if (ctor.isNoexcept)
+            {
+                if (*ctor.isNoexcept && hasStub)
+                    headers.insert("<exception>");
+            }
+            else if (ctor.type == ConstructorType::DEFAULT)
+                noteSpecifier("is_nothrow_default_constructible", false);
+            else if (ctor.type == ConstructorType::MOVE)
+                noteSpecifier("is_nothrow_move_constructible", hasStub);
+        }
         if (cl.hasMoveAssignment)
+            noteSpecifier("is_nothrow_move_assignable", !defaulted);
+        // Without exceptions, special member stubs terminate and create() factories build std::expected in place.
+        if (cl.options.expected)
         {
-            std::string def = SpecialMemberGenerator::generateMoveAssignmentDefinition(cl.name);
-            if (!def.empty())
+            headers.insert("<exception>");
+            const bool hasFactory = std::any_of(cl.constructors.begin(), cl.constructors.end(), [](const ClassModels::Constructor &ctor)
+                                                { return ctor.type == ClassModels::ConstructorType::CUSTOM; });
+            if (hasFactory)
             {
-                oss << def << "\n";
+                headers.merge(ErrorGenerator::requiredHeaders());
+                headers.insert("<utility>");
             }
         }
 
-        // Generate destructor definition if available.
-        if (cl.destructor)
+        for (const auto *methods : {&cl.publicMethods, &cl.privateMethods, &cl.protectedMethods})
         {
-            std::string def = SpecialMemberGenerator::generateDestructorDefinition(cl.name);
-            if (!def.empty())
+            for (const auto &meth : *methods)
             {
-                oss << def << "\n";
+                headers.merge(CallableGenerator::requiredHeaders(meth));
             }
         }
+        return headers;
+    }
+
+    std::string generateClassDefinition(const ClassModels::ClassModel &declared, const bool templates)
+    {
+        const ClassModels::ClassModel cl = AllocatorGenerator::applyAllocator(LayoutGenerator::orderMembers(declared));
+
+        std::ostringstream oss;
+
+        // Generate out-of-line definitions for constructors, assignment operators and destructor.
+        if (cl.templateSpec.isTemplate() == templates)
+            classSpecialMemberDefinitionGenerator(cl, false, oss);
 
         // Generate definitions for public methods.
-        classMethodDefinitionGenerator(cl.publicMethods, cl.name, oss);
+        classMethodDefinitionGenerator(cl, cl.publicMethods, templates, oss);
 
         // Generate definitions for private methods.
-        classMethodDefinitionGenerator(cl.privateMethods, cl.name, oss);
+        classMethodDefinitionGenerator(cl, cl.privateMethods, templates, oss);
 
         // Generate definitions for protected methods.
-        classMethodDefinitionGenerator(cl.protectedMethods, cl.name, oss);
+        classMethodDefinitionGenerator(cl, cl.protectedMethods, templates, oss);
 
         return oss.str();
     }
 
+    bool hasTemplates(const ClassModels::ClassModel &cl)
+    {
+        if (cl.templateSpec.isTemplate())
+            return true;
+        for (const auto *methods : {&cl.publicMethods, &cl.privateMethods, &cl.protectedMethods})
+        {
+            for (const auto &meth : *methods)
+            {
+                if (meth.templateSpec.isTemplate())
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    bool isDefaultConstructible(const ClassModels::ClassModel &cl)
+    {
+        if (cl.constructors.empty() || cl.options.allocator == ClassModels::AllocatorPolicy::PMR)
+            return true;
+        return std::any_of(cl.constructors.begin(), cl.constructors.end(), [](const ClassModels::Constructor &ctor)
+                           { return ctor.type == ClassModels::ConstructorType::DEFAULT; });
+    }
+
+    std::string generateExplicitInstantiations(const ClassModels::ClassModel &cl, const bool externDecl,
+                                               const std::string &scope)
+    {
+        const auto &spec = cl.templateSpec;
+        std::ostringstream oss;
+        for (const auto &arguments : spec.instantiations)
+        {
+            oss << (externDecl ? "extern template class " : "template class ") << scope << cl.name << "<"
+                << arguments << ">;\n";
+        }
+
+        // Instantiating a class does not instantiate its member templates; they are listed per class instantiation.
+        const std::vector<std::string> classArguments = spec.isTemplate() ? spec.instantiations : std::vector<std::string>{""};
+        for (const auto &arguments : classArguments)
+        {
+            std::string classScope = scope + cl.name + (spec.isTemplate() ? "<" + arguments + ">" : "") + "::";
+            for (const auto *methods : {&cl.publicMethods, &cl.privateMethods, &cl.protectedMethods})
+            {
+                for (const auto &meth : *methods)
+                {
+                    std::string lines = CallableGenerator::generateExplicitInstantiations(meth, externDecl, classScope);
+                    oss << (spec.isTemplate() ? GeneratorUtilities::substituteTemplateArguments(lines, spec, arguments) : lines);
+                }
+            }
+        }
+        return oss.str();
+    }
+
 } // namespace ClassGenerator
@@ -1,5 +1,18 @@
 #include "DirectoryTreeBuilder.h"
+#include "EnumGenerator.h"
+#include "ErrorGenerator.h"
+#include "GeneratorUtilities.h"
+#include "ParameterPassingGenerator.h"
+#include "PoolGenerator.h"
+#include "ProfilerGenerator.h"
+#include "ReflectionGenerator.h"
+#include "SerializationGenerator.h"
+#include "TracingGenerator.h"
+#include "ValueGenerator.h"
 
+#include <algorithm>
+#include <concepts>
+#include <numeric>
 #include <stdexcept>
 #include <iostream>
 
@@ -12,6 +25,471 @@
  */
 namespace
 {
+    /**
+     * @brief Collects the classes of a DSL object together with their namespace-qualified names.
+     *
+     * @param cl The class.
+     * @param scope The enclosing namespaces joined with "::", or empty at global scope.
+     * @param classes The list to append to.
+     */
+    void collectClasses(const ClassModels::ClassModel &cl, const std::string &scope,
+                        std::vector<std::pair<std::string, ClassModels::ClassModel>> &classes)
+    {
+        classes.emplace_back(scope.empty() ? cl.name : scope + "::" + cl.name, cl);
+    }
+
+    /// Collects the classes of a file of merged classes.
+    void collectClasses(const std::vector<ClassModels::ClassModel> &merged, const std::string &scope,
+                        std::vector<std::pair<std::string, ClassModels::ClassModel>> &classes)
+    {
+        for (const auto &cl : merged)
+        {
+            collectClasses(cl, scope, classes);
+        }
+    }
+
+    /// Collects the classes of a namespace and of its nested namespaces.
+    void collectClasses(const CodeGroupModels::NamespaceModel &ns, const std::string &scope,
+                        std::vector<std::pair<std::string, ClassModels::ClassModel>> &classes)
+    {
+        const std::string nested = scope.empty() ? ns.name : scope + "::" + ns.name;
+        collectClasses(ns.classes, nested, classes);
+        for (const auto &inner : ns.namespaces)
+        {
+            collectClasses(inner, nested, classes);
+        }
+    }
+
+    /// Files of free functions hold no classes.
+    void collectClasses(const std::vector<CallableModels::FunctionModel> &, const std::string &,
+                        std::vector<std::pair<std::string, ClassModels::ClassModel>> &)
+    {
+    }
+
+    /// Adds a support file to the project unless an earlier file already did.
+    void addSupportFile(const std::string &relativePath, const std::string &content, ProjectMetadata::ProjMetadata &metadata)
+    {
+        if (std::none_of(metadata.supportFiles.begin(), metadata.supportFiles.end(), [&relativePath](const auto &file)
+                         { return file.relativePath == relativePath; }))
+        {
+            metadata.supportFiles.push_back({relativePath, content});
+        }
+    }
+
+    /**
+     * @brief Adds a generated test or benchmark source and registers it with the build.
+     *
+     * @param name The executable name; the source is `tests/<name>.cpp` or `benchmarks/<name>.cpp`.
+     * @param content The source.
+     * @param isBenchmark True for a benchmark.
+     * @param lib The metadata of the library holding the tested file.
+     * @param metadata The project metadata receiving the source and test.
+     */
+    void addTest(const std::string &name, const std::string &content, const bool isBenchmark,
+                 const ProjectMetadata::LibraryMetadata &lib, ProjectMetadata::ProjMetadata &metadata)
+    {
+        const std::string source = (isBenchmark ? "benchmarks/" : "tests/") + name + ".cpp";
+        metadata.supportFiles.push_back({source, content});
+        metadata.tests.push_back({name, source, lib.name, lib.isProjLevel, isBenchmark});
+    }
+
+    /**
+     * @brief Records the support headers, tests and benchmarks generated for a file's classes.
+     *
+     * Serialisable classes need the binary serialisation header, pooled classes the object pool
+     * header, reflected classes the reflection header, value classes the hash header, enumerations
+     * the enum traits header, exception-free projects the error code header and instrumented
+     * callables the tracing header, each added once per project. Members annotated
+     * `@own_cacheline` make the build pin the cache line size. Classes that
+     * qualify also get a round-trip test, a serialisation benchmark, a pool benchmark, a value
+     * test and a hash benchmark.
+     *
+     * @tparam T The DSL object type stored in the file node.
+     * @param content The DSL object the file is generated from, with its instrumentation resolved.
+     * @param basePath The base path (no extension) of the file.
+     * @param lib The metadata of the library the file belongs to.
+     * @param metadata The project metadata receiving the support files and tests.
+     */
+    template <FileNodeGenerator::ValidFileNodeType T>
+    void registerSupport(const T &content, const std::string &basePath, const ProjectMetadata::LibraryMetadata &lib,
+                         ProjectMetadata::ProjMetadata &metadata)
+    {
+        if (TracingGenerator::hasTraceScopes(content))
+        {
+            addSupportFile(std::string("include/") + TracingGenerator::SUPPORT_HEADER,
+                           TracingGenerator::generateSupportHeader(metadata.libraries["proj"].name), metadata);
+            metadata.tracing = true;
+        }
+
+        if (metadata.options.errors == CodeGroupModels::ErrorHandling::EXPECTED)
+        {
+            // The error enumeration is generated like a DSL enum, so it needs the enum traits too.
+            addSupportFile(std::string("include/") + EnumGenerator::SUPPORT_HEADER,
+                           EnumGenerator::generateSupportHeader(), metadata);
+            addSupportFile(std::string("include/") + ErrorGenerator::SUPPORT_HEADER,
+                           ErrorGenerator::generateSupportHeader(), metadata);
+        }
+
+        if constexpr (std::same_as<T, CodeGroupModels::NamespaceModel>)
+        {
+            if (EnumGenerator::hasEnums(content))
+            {
+                addSupportFile(std::string("include/") + EnumGenerator::SUPPORT_HEADER,
+                               EnumGenerator::generateSupportHeader(), metadata);
+            }
+        }
+
+        std::vector<std::pair<std::string, ClassModels::ClassModel>> classes;
+        collectClasses(content, "", classes);
+
+        const std::string header = basePath.substr(basePath.rfind('/') + 1) + ".h";
+        for (const auto &[qualifiedName, cl] : classes)
+        {
+            const auto members = GeneratorUtilities::allMembers(cl);
+            if (std::any_of(members.begin(), members.end(), [](const PropertiesModels::Parameter &mem)
+                            { return PropertiesModels::hasAnnotation(mem.annotations, PropertiesModels::Annotation::OWN_CACHELINE); }))
+            {
+                metadata.ownCacheline = true;
+            }
+
+            if (SerializationGenerator::isSerializable(cl))
+            {
+                addSupportFile(std::string("include/") + SerializationGenerator::SUPPORT_HEADER,
+                               SerializationGenerator::generateSupportHeader(), metadata);
+                if (SerializationGenerator::hasRoundTripTest(cl))
+                {
+                    addTest(SerializationGenerator::testName(qualifiedName),
+                            SerializationGenerator::generateRoundTripTest(cl, qualifiedName, header), false, lib, metadata);
+                    addTest(SerializationGenerator::benchmarkName(qualifiedName),
+                            SerializationGenerator::generateBenchmark(qualifiedName, header), true, lib, metadata);
+                }
+            }
+
+            if (cl.options.reflect)
+            {
+                addSupportFile(std::string("include/") + ReflectionGenerator::SUPPORT_HEADER,
+                               ReflectionGenerator::generateSupportHeader(), metadata);
+            }
+
+            if (cl.options.pooled)
+            {
+                addSupportFile(std::string("include/") + PoolGenerator::SUPPORT_HEADER, PoolGenerator::generateSupportHeader(), metadata);
+                if (PoolGenerator::hasBenchmark(cl))
+                {
+                    addTest(PoolGenerator::benchmarkName(qualifiedName), PoolGenerator::generateBenchmark(qualifiedName, header),
+                            true, lib, metadata);
+                }
+            }
+
+            if (cl.options.value)
+            {
+                addSupportFile(std::string("include/") + ValueGenerator::SUPPORT_HEADER, ValueGenerator::generateSupportHeader(), metadata);
+                if (ValueGenerator::hasTest(cl))
+                {
+                    addTest(ValueGenerator::testName(qualifiedName), ValueGenerator::generateTest(cl, qualifiedName, header),
+                            false, lib, metadata);
+                }
+                if (ValueGenerator::hasBenchmark(cl))
+                {
+                    addTest(ValueGenerator::benchmarkName(qualifiedName), ValueGenerator::generateBenchmark(cl, qualifiedName, header),
+                            true, lib, metadata);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Creates a FileNode for a DSL object, attaches it to a directory and records its files.
+     *
+     * Every header, every file that produces a source file and every file with template definitions
+     * is recorded in the owning library's metadata so later stages (e.g., compilation database or
+     * Bazel generation) know each file without re-walking the tree. Classes needing support headers,
+     * tests or benchmarks register them with the project metadata.
+     *
+     * @tparam T The DSL object type stored in the file node.
+     * @param node The DirectoryNode that will own the file.
+     * @param fileName The base file name (without extension).
+     * @param content The DSL object used for code generation.
+     * @param lib The metadata of the library the file belongs to.
+     * @param metadata The project metadata; its passing convention, instrumentation and error handling are applied to the content's callables.
+     * @param siblingHeaders Optional headers of the same directory the file's header includes. Defaults to none.
+     */
+    template <FileNodeGenerator::ValidFileNodeType T>
+    void addFileNode(const std::shared_ptr<DirectoryTree::DirectoryNode> &node, const std::string &fileName,
+                     const T &content, ProjectMetadata::LibraryMetadata &lib,
+                     ProjectMetadata::ProjMetadata &metadata, const std::vector<std::string> &siblingHeaders = {})
+    {
+        // Instrumentation set on the project or library, and the project's error handling, reach every callable of the file.
+        const T generated = ParameterPassingGenerator::applyConvention(
+            ErrorGenerator::applyErrorHandling(
+                TracingGenerator::applyInstrumentation(content, metadata.options.instrument || lib.instrument),
+                metadata.options.errors),
+            metadata.options.passing, metadata.enums);
+        auto fileNode = std::make_unique<FileNodeGenerator::FileNode<T>>(node->relativePath, fileName, generated, lib.isHeaderOnly,
+                                                                          siblingHeaders);
+        const std::string basePath = node->relativePath + "/" + fileName;
+        lib.headers.emplace_back(basePath);
+        if (!lib.isHeaderOnly)
+        {
+            lib.translationUnits.emplace_back(basePath);
+            if (fileNode->hasTemplateFile())
+            {
+                lib.templateFiles.emplace_back(basePath);
+            }
+        }
+        registerSupport(generated, basePath, lib, metadata);
+        node->addFileNode(std::move(fileNode));
+    }
+
+    /**
+     * @brief Collects the names of the enums declared in a namespace and its nested namespaces.
+     */
+    void collectEnums(const CodeGroupModels::NamespaceModel &ns, std::set<std::string> &names)
+    {
+        for (const auto &en : ns.enums)
+        {
+            names.insert(en.name);
+        }
+        for (const auto &nested : ns.namespaces)
+        {
+            collectEnums(nested, names);
+        }
+    }
+
+    /**
+     * @brief Collects the names of the enums declared anywhere in a folder and its subfolders.
+     */
+    void collectEnums(const CodeGroupModels::FolderModel &folder, std::set<std::string> &names)
+    {
+        for (const auto &ns : folder.namespaceFiles)
+        {
+            collectEnums(ns, names);
+        }
+        for (const auto &sub : folder.subFolders)
+        {
+            collectEnums(sub, names);
+        }
+    }
+
+    /// Estimated cost every translation unit pays regardless of content (preamble includes, compiler start-up).
+    constexpr size_t TU_OVERHEAD = 4;
+
+    /**
+     * @brief Estimates the compile cost a class contributes to its translation unit.
+     *
+     * The estimate counts the class itself plus every definition emitted into the source file
+     * (methods, non-default constructors and assignment operators). It is only used to compare
+     * elements against each other, so the unit is arbitrary.
+     *
+     * @param cl The class to estimate.
+     * @return The estimated cost.
+     */
+    size_t estimateCost(const ClassModels::ClassModel &cl)
+    {
+        size_t cost = 1 + cl.publicMethods.size() + cl.privateMethods.size() + cl.protectedMethods.size();
+        for (const auto &ctor : cl.constructors)
+        {
+            if (ctor.type != ClassModels::ConstructorType::DEFAULT)
+            {
+                ++cost;
+            }
+        }
+        return cost + (cl.hasCopyAssignment ? 1 : 0) + (cl.hasMoveAssignment ? 1 : 0);
+    }
+
+    /**
+     * @brief Estimates the compile cost of a namespace, including nested content.
+     *
+     * @param ns The namespace to estimate.
+     * @return The estimated cost: the sum of its classes, one per function, and its nested namespaces.
+     */
+    size_t estimateCost(const CodeGroupModels::NamespaceModel &ns)
+    {
+        size_t cost = ns.functions.size();
+        for (const auto &cl : ns.classes)
+        {
+            cost += estimateCost(cl);
+        }
+        for (const auto &nested : ns.namespaces)
+        {
+            cost += estimateCost(nested);
+        }
+        return cost;
+    }
+
+    /**
+     * @brief Packs weighted items into as few bins as possible using first-fit decreasing.
+     *
+     * Items are placed heaviest first into the first bin with room left, which keeps the bins
+     * close to even. Items heavier than the capacity get a bin of their own. Indices within each
+     * bin are returned in ascending order so merged files keep the DSL declaration order.
+     *
+     * @param costs The cost of each item.
+     * @param capacity The maximum total cost of a bin.
+     * @return The bins, each holding indices into costs.
+     */
+    std::vector<std::vector<size_t>> packFirstFitDecreasing(const std::vector<size_t> &costs, const size_t capacity)
+    {
+        std::vector<size_t> order(costs.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&costs](size_t a, size_t b)
+                         { return costs[a] > costs[b]; });
+
+        std::vector<std::vector<size_t>> bins;
+        std::vector<size_t> binCosts;
+        for (const size_t item : order)
+        {
+            auto fit = std::find_if(binCosts.begin(), binCosts.end(), [&](size_t used)
+                                    { return used + costs[item] <= capacity; });
+            if (fit == binCosts.end())
+            {
+                bins.push_back({item});
+                binCosts.push_back(costs[item]);
+            }
+            else
+            {
+                const size_t bin = static_cast<size_t>(fit - binCosts.begin());
+                bins[bin].push_back(item);
+                *fit += costs[item];
+            }
+        }
+
+        for (auto &bin : bins)
+        {
+            std::sort(bin.begin(), bin.end());
+        }
+        return bins;
+    }
+
+    /**
+     * @brief Builds a file name for the n-th file of a group, leaving the first one unnumbered.
+     *
+     * @param baseName The name shared by the group.
+     * @param index Zero-based position within the group.
+     * @return baseName for the first file, baseName followed by index + 1 otherwise.
+     */
+    std::string numberedFileName(const std::string &baseName, const size_t index)
+    {
+        return index == 0 ? baseName : baseName + std::to_string(index + 1);
+    }
+
+    /**
+     * @brief Creates the file nodes for the classes, namespaces and free functions of a folder.
+     *
+     * The project's granularity policy decides how elements map onto translation units:
+     * - PER_ENTITY: one file per class, one per namespace and one for all free functions.
+     * - SPLIT: as PER_ENTITY, but namespaces holding classes get one file per class (the class
+     *   wrapped in its namespace); remaining enumerations, functions and nested namespaces stay in the
+     *   namespace file, which the class files include when it declares enumerations.
+     * - BALANCED: namespaces are only split when their estimated cost exceeds the target, classes
+     *   whose cost is at most a quarter of the target are merged with first-fit decreasing into
+     *   shared "<folder>Classes" files, and free functions are spread evenly over as many files
+     *   as the target requires.
+     * A cap on free functions per file applies under every policy.
+     *
+     * @param node The DirectoryNode that owns the files.
+     * @param folder The folder (or library/project) whose direct content is being converted.
+     * @param lib The metadata of the library the files belong to.
+     * @param metadata The project metadata holding the project-wide generation options.
+     */
+    void addFolderFiles(const std::shared_ptr<DirectoryTree::DirectoryNode> &node,
+                        const CodeGroupModels::FolderModel &folder,
+                        ProjectMetadata::LibraryMetadata &lib,
+                        ProjectMetadata::ProjMetadata &metadata)
+    {
+        const auto &options = metadata.options;
+        const bool balanced = options.granularity == CodeGroupModels::TuGranularity::BALANCED;
+        // The TU overhead is paid once per file, so it comes out of every file's budget.
+        const size_t capacity = options.targetTuCost > TU_OVERHEAD ? options.targetTuCost - TU_OVERHEAD : 1;
+
+        // Classes: each class forms a set of files (.h and .cpp), unless it is tiny and gets merged.
+        std::vector<ClassModels::ClassModel> tinyClasses;
+        std::vector<size_t> tinyCosts;
+        for (const auto &cl : folder.classFiles)
+        {
+            const size_t cost = estimateCost(cl);
+            if (balanced && cost <= options.targetTuCost / 4)
+            {
+                tinyClasses.push_back(cl);
+                tinyCosts.push_back(cost);
+                continue;
+            }
+            addFileNode(node, cl.name, cl, lib, metadata);
+        }
+        const auto bins = packFirstFitDecreasing(tinyCosts, capacity);
+        size_t mergedFiles = 0;
+        for (const auto &bin : bins)
+        {
+            if (bin.size() == 1)
+            {
+                addFileNode(node, tinyClasses[bin.front()].name, tinyClasses[bin.front()], lib, metadata);
+                continue;
+            }
+            std::vector<ClassModels::ClassModel> merged;
+            for (const size_t index : bin)
+            {
+                merged.push_back(tinyClasses[index]);
+            }
+            addFileNode(node, numberedFileName(node->folderName + "Classes", mergedFiles++), merged, lib, metadata);
+        }
+
+        // Namespaces: each namespace forms a set of files (.h and .cpp), unless the policy splits it.
+        for (const auto &ns : folder.namespaceFiles)
+        {
+            const bool split = !ns.classes.empty() &&
+                               (options.granularity == CodeGroupModels::TuGranularity::SPLIT ||
+                                (balanced && estimateCost(ns) > options.targetTuCost));
+            if (!split)
+            {
+                addFileNode(node, ns.name, ns, lib, metadata);
+                continue;
+            }
+            // The enumerations stay in the namespace's own header, which every class part then includes.
+            std::vector<std::string> siblingHeaders;
+            if (EnumGenerator::hasEnums(ns))
+            {
+                siblingHeaders.push_back(ns.name + ".h");
+            }
+            for (const auto &cl : ns.classes)
+            {
+                CodeGroupModels::NamespaceModel part{ns.name, ns.description, {cl}, {}, {}};
+                addFileNode(node, ns.name + cl.name, part, lib, metadata, siblingHeaders);
+            }
+            if (!ns.functions.empty() || !ns.namespaces.empty() || !ns.enums.empty())
+            {
+                CodeGroupModels::NamespaceModel rest = ns;
+                rest.classes.clear();
+                addFileNode(node, ns.name, rest, lib, metadata);
+            }
+        }
+
+        // Free functions: spread evenly over the fewest files that respect the cap and cost target.
+        const auto &functions = folder.functionFile;
+        if (functions.empty())
+        {
+            return;
+        }
+        size_t perFile = functions.size();
+        if (options.maxFunctionsPerFile > 0)
+        {
+            perFile = std::min(perFile, options.maxFunctionsPerFile);
+        }
+        if (balanced)
+        {
+            perFile = std::min(perFile, capacity);
+        }
+        const size_t fileCount = (functions.size() + perFile - 1) / perFile;
+        size_t begin = 0;
+        for (size_t i = 0; i < fileCount; ++i)
+        {
+            // The first (size % fileCount) files take one extra function.
+            const size_t count = functions.size() / fileCount + (i < functions.size() % fileCount ? 1 : 0);
+            std::vector<CallableModels::FunctionModel> chunk(functions.begin() + begin, functions.begin() + begin + count);
+            addFileNode(node, numberedFileName(node->folderName + "FreeFunctions", i), chunk, lib, metadata);
+            begin += count;
+        }
+    }
+
     /**
      * @brief Recursively converts a FolderModel into a DirectoryNode and registers its subdirectory path with the library metadata.
      *
@@ -38,6 +516,9 @@ namespace
         // Register this folder's relative path under the appropriate library key.
         metadata.libraries[libName].subDirectories.emplace_back(node->relativePath);
 
+        // Files inherit the packaging mode of the library they belong to.
+        auto &lib = metadata.libraries[libName];
+
         // Process each subfolder recursively.
         for (const auto &subFolder : folder.subFolders)
         {
@@ -45,29 +526,8 @@ namespace
             node->addSubDirectory(childNode);
         }
 
-        // Process each Class Model in folder: each class forms a set of files (.h and .cpp).
-        for (const auto &cl : folder.classFiles)
-        {
-            auto classNode = std::make_unique<FileNodeGenerator::FileNode<ClassModels::ClassModel>>(
-                node->relativePath, cl.name, cl);
-            node->addFileNode(std::move(classNode));
-        }
-
-        // Process each Namespace Model in folder: each namespace forms a set of files (.h and .cpp).
-        for (const auto &ns : folder.namespaceFiles)
-        {
-            auto namespaceNode = std::make_unique<FileNodeGenerator::FileNode<CodeGroupModels::NamespaceModel>>(
-                node->relativePath, ns.name, ns);
-            node->addFileNode(std::move(namespaceNode));
-        }
-
-        // Process function files: the entire vector forms a set of files (.h and .cpp).
-        if (folder.functionFile.size() > 0)
-        {
-            auto freeFunctionNode = std::make_unique<FileNodeGenerator::FileNode<std::vector<CallableModels::FunctionModel>>>(
-                node->relativePath, node->folderName + "FreeFunctions", folder.functionFile);
-            node->addFileNode(std::move(freeFunctionNode));
-        }
+        // Process the folder's classes, namespaces and free functions according to the granularity policy.
+        addFolderFiles(node, folder, lib, metadata);
 
         return node;
     }
@@ -77,7 +537,7 @@ namespace
      *
      * This function converts a CodeGroupModels::LibraryModel into a DirectoryNode using the folder
      * conversion logic provided by buildTreeImpl(), and registers library metadata for later use (e.g., during CMake generation).
-     * The metadata is updated to include the library's relative path and dependencies.
+     * The metadata is updated to include the library's relative path, dependencies, packaging mode and instrumentation.
      *
      * @param library The LibraryModel to convert.
      * @param metadata Reference to the ProjectMetadata where this library's metadata is stored.
@@ -97,7 +557,10 @@ namespace
                 "", // Temporary; will be set after full tree construction.
                 library.name,
                 false, // This is a library-level (not project-level) entry.
-                library.dependencies};
+                library.dependencies,
+                library.mode == CodeGroupModels::LibraryMode::HEADER_ONLY,
+                library.instrument,
+                library.version};
 
         // Convert the LibraryModel using folder logic.
         auto node = buildTreeImpl(static_cast<const CodeGroupModels::FolderModel &>(library), parentPath, parent, library.name, metadata);
@@ -115,10 +578,12 @@ namespace
      * It processes all top-level folders, libraries, class files, namespace files, and function files,
      * recursively building a hierarchical representation of the generated project structure.
      * The project itself is treated as a top-level library ("proj") for the purposes of metadata registration.
+     * Projects with the built-in profiler get its header and source as support files.
      *
      * @param project The ProjectModel to build from.
      * @param metadata A reference to the ProjectMetadata registry where project-level and library metadata is collected.
      * @return A shared_ptr to the root DirectoryNode representing the top-level project folder.
+     * @throws std::runtime_error if a top-level library or folder clashes with the profiling library.
      */
     std::shared_ptr<DirectoryTree::DirectoryNode> buildTreeImpl(const CodeGroupModels::ProjectModel &project,
                                                                 ProjectMetadata::ProjMetadata &metadata)
@@ -126,6 +591,31 @@ namespace
         // Create the root DirectoryNode for the project.
         auto root = std::make_shared<DirectoryTree::DirectoryNode>("ROOT");
 
+        // Carry project-wide options over for the build tool generators.
+        metadata.options = project.options;
+
+        // Enums are cheap to copy wherever they are declared, so every file passes them by value.
+        collectEnums(project, metadata.enums);
+        for (const auto &library : project.libraries)
+        {
+            collectEnums(library, metadata.enums);
+        }
+
+        if (project.options.profiler)
+        {
+            // The profiling library owns include/profiling and src/profiling.
+            const auto claimsFolder = [](const auto &folder)
+            { return folder.name == ProfilerGenerator::LIBRARY_NAME; };
+            if (std::any_of(project.libraries.begin(), project.libraries.end(), claimsFolder) ||
+                std::any_of(project.subFolders.begin(), project.subFolders.end(), claimsFolder))
+            {
+                throw std::runtime_error(std::string("A library or folder named '") + ProfilerGenerator::LIBRARY_NAME +
+                                         "' clashes with the generated profiling library");
+            }
+            addSupportFile(std::string("include/") + ProfilerGenerator::HEADER, ProfilerGenerator::generateHeader(), metadata);
+            addSupportFile(std::string("src/") + ProfilerGenerator::SOURCE, ProfilerGenerator::generateSource(), metadata);
+        }
+
         // Register project-level metadata using the special key "proj".
         metadata.libraries["proj"] =
             ProjectMetadata::LibraryMetadata{
@@ -148,29 +638,8 @@ namespace
             root->addSubDirectory(libNode);
         }
 
-        // Process each Class Model at the project level.
-        for (const auto &cl : project.classFiles)
-        {
-            auto classNode = std::make_unique<FileNodeGenerator::FileNode<ClassModels::ClassModel>>(
-                root->relativePath, cl.name, cl);
-            root->addFileNode(std::move(classNode));
-        }
-
-        // Process each Namespace Model at the project level.
-        for (const auto &ns : project.namespaceFiles)
-        {
-            auto namespaceNode = std::make_unique<FileNodeGenerator::FileNode<CodeGroupModels::NamespaceModel>>(
-                root->relativePath, ns.name, ns);
-            root->addFileNode(std::move(namespaceNode));
-        }
-
-        // Process project-level function files.
-        if (project.functionFile.size() > 0)
-        {
-            auto freeFunctionNode = std::make_unique<FileNodeGenerator::FileNode<std::vector<CallableModels::FunctionModel>>>(
-                root->relativePath, root->folderName + "FreeFunctions", project.functionFile);
-            root->addFileNode(std::move(freeFunctionNode));
-        }
+        // Process project-level classes, namespaces and free functions according to the granularity policy.
+        addFolderFiles(root, project, metadata.libraries["proj"], metadata);
 
         return root;
     }
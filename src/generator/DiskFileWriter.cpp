@@ -1,5 +1,7 @@
 #include "DiskFileWriter.h"
 #include "GeneratorUtilities.h"
+#include "ProfilerGenerator.h"
+#include "TracingGenerator.h"
 
 #include <filesystem>
 #include <fstream>
@@ -114,12 +116,13 @@ namespace GeneratedFileWriter
         // Construct full path for the header file under <outputFolder>/include/.
         std::filesystem::path fullPath = constructFullPath(this->outputFolder, "include", filePath, ".h");
 
-        writeToFile(fullPath, [&fullPath, &content](std::ofstream &file)
+        writeToFile(fullPath, [this, &fullPath, &content](std::ofstream &file)
                     {
             // Write file doxygen.
             writeFileDoxygen(file, fullPath.filename());
             // Write header file includes (TODO: Expand these in future features).
-            file << "#pragma once\n\n#include <string>\n#include <stdexcept>\n\n";
+            // Stubs of exception-free projects never throw, so they need no <stdexcept>.
+            file << "#pragma once\n\n#include <string>\n" << (exceptions ? "#include <stdexcept>\n" : "") << "\n";
             // Write the content to the file.
             file << content; });
     }
@@ -139,6 +142,23 @@ namespace GeneratedFileWriter
             file << content; });
     }
 
+    void DiskFileWriter::writeTemplateFile(const std::string &filePath, const std::string &content)
+    {
+        // Construct full path for the template definitions next to the header under <outputFolder>/include/.
+        std::filesystem::path fullPath = constructFullPath(this->outputFolder, "include", filePath, ".tpp");
+
+        writeToFile(fullPath, [&fullPath, &content](std::ofstream &file)
+                    {
+            // Write file doxygen.
+            writeFileDoxygen(file, fullPath.filename());
+            // Include the declarations being defined; the header includes this file at its end.
+            std::filesystem::path headerPath = fullPath;
+            headerPath.replace_extension(".h");
+            file << "#pragma once\n\n#include \"" << headerPath.filename().string() << "\"\n\n";
+            // Write the content to the file.
+            file << content; });
+    }
+
     void DiskFileWriter::writeCmakeLists(const std::string &cmakeListsTxt) const
     {
         // Construct full path for the CMakeLists.txt at root.
@@ -150,12 +170,69 @@ namespace GeneratedFileWriter
             file << cmakeListsTxt; });
     }
 
-    void DiskFileWriter::writeMain() const
+    void DiskFileWriter::writeLibraryCmakeLists(const std::string &libraryPath, const std::string &cmakeListsTxt) const
+    {
+        // Construct full path for the library's CMakeLists.txt within its source folder.
+        std::filesystem::path fullPath = std::filesystem::current_path() / this->outputFolder / "src" / libraryPath / "CMakeLists.txt";
+
+        writeToFile(fullPath, [&cmakeListsTxt](std::ofstream &file)
+                    {
+            // Write the content to the file.
+            file << cmakeListsTxt; });
+    }
+
+    void DiskFileWriter::writeCmakePresets(const std::string &cmakePresetsJson) const
+    {
+        // Construct full path for the CMakePresets.json at root.
+        std::filesystem::path fullPath = std::filesystem::current_path() / this->outputFolder / "CMakePresets.json";
+
+        writeToFile(fullPath, [&cmakePresetsJson](std::ofstream &file)
+                    {
+            // Write the content to the file.
+            file << cmakePresetsJson; });
+    }
+
+    void DiskFileWriter::writeBazelFiles(const std::pair<std::string, std::string> &bazelFiles) const
+    {
+        // Construct file path to BUILD.bazel.
+        std::filesystem::path buildPath = std::filesystem::current_path() / this->outputFolder / "BUILD.bazel";
+
+        writeToFile(buildPath, [&bazelFiles](std::ofstream &buildFile)
+                    {
+            // Write build file.
+            buildFile << bazelFiles.first; });
+
+        // Construct file path to MODULE.bazel.
+        std::filesystem::path modulePath = std::filesystem::current_path() / this->outputFolder / "MODULE.bazel";
+
+        writeToFile(modulePath, [&bazelFiles](std::ofstream &moduleFile)
+                    {
+            // Write module file.
+            moduleFile << bazelFiles.second; });
+    }
+
+    void DiskFileWriter::writeCompileCommands(const std::string &compileCommandsJson) const
+    {
+        // Construct full path for the compile_commands.json at root.
+        std::filesystem::path fullPath = std::filesystem::current_path() / this->outputFolder / "compile_commands.json";
+
+        writeToFile(fullPath, [&compileCommandsJson](std::ofstream &file)
+                    {
+            // Write the content to the file.
+            file << compileCommandsJson; });
+    }
+
+    void DiskFileWriter::writeMain(const ProjectMetadata::ProjMetadata &projMeta) const
     {
         // Construct file path to src/main.cpp.
         std::filesystem::path fullPath = std::filesystem::current_path() / this->outputFolder / "src" / "main.cpp";
 
-        writeToFile(fullPath, [](std::ofstream &file)
+        // The profiler is installed by the first statements of main().
+        const auto project = projMeta.libraries.find("proj");
+        const bool profiler = projMeta.options.profiler && project != projMeta.libraries.end();
+        const std::string profilerSetup = profiler ? ProfilerGenerator::generateMainSetup(project->second.name, projMeta.tracing) : "";
+
+        writeToFile(fullPath, [&projMeta, profiler, &profilerSetup](std::ofstream &file)
                     {
             // Barebones main.cpp.
             // Write the Doxygen file header.
@@ -163,6 +240,14 @@ namespace GeneratedFileWriter
             file << " * @file main.cpp\n";
             file << " * @brief Main point of entry for the scaffolded project.\n";
             file << " */\n\n";
+            if (profiler)
+            {
+                if (projMeta.tracing)
+                {
+                    file << "#include \"" << TracingGenerator::SUPPORT_HEADER << "\"\n";
+                }
+                file << "#include \"" << ProfilerGenerator::HEADER << "\"\n\n";
+            }
             file << "#include <iostream>\n\n";
             file << "/**\n";
             file << " * @brief Main.\n";
@@ -173,11 +258,26 @@ namespace GeneratedFileWriter
             // Write the main.cpp content and print a hello world message.
             file << "int main(int argc, char *argv[])\n";
             file << "{\n";
+            file << profilerSetup;
             file << "    std::cout << \"Hello, world!\" << std::endl;\n";
             file << "    return 0;\n";
             file << "}\n"; });
     }
 
+    void DiskFileWriter::writeSupportFiles(const std::vector<ProjectMetadata::SupportFile> &supportFiles) const
+    {
+        for (const auto &supportFile : supportFiles)
+        {
+            // Construct full path relative to the root of the output folder.
+            std::filesystem::path fullPath = std::filesystem::current_path() / this->outputFolder / supportFile.relativePath;
+
+            writeToFile(fullPath, [&supportFile](std::ofstream &file)
+                        {
+                // Write the content to the file.
+                file << supportFile.content; });
+        }
+    }
+
     void DiskFileWriter::writeVsCodeJsons(const std::pair<std::string, std::string> &jsonsFiles) const
     {
         // Construct file path to .vscode/launch.json.
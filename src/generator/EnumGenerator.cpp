@@ -0,0 +1,283 @@
+#include "EnumGenerator.h"
+
+#include <algorithm>
+#include <sstream>
+
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ */
+namespace
+{
+    /// Content of the support header, emitted verbatim.
+    constexpr const char *SUPPORT_HEADER_CONTENT = R"(/**
+ * @file EnumTraits.h
+ * @brief Traits and constant-time name lookup of generated enumerations.
+ *
+ * Every generated enumeration has a constexpr toString() indexing an array of its enumerator
+ * names, and a specialisation of enums::EnumTraits listing its values and names together with a
+ * perfect hash of the names built at compile time. enums::fromString() hashes a name once and
+ * compares it with the one enumerator name stored in its slot, however many enumerators there are.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace enums
+{
+    /**
+     * @brief Deliberately not constexpr: reaching it while building a PerfectHash stops compilation.
+     *
+     * This reports the failure without a throw, so the header also compiles with -fno-exceptions.
+     */
+    inline void perfectHashNotFound() noexcept {}
+
+    /**
+     * @brief Describes a generated enumeration; specialised for each one.
+     *
+     * Specialisations provide `count`, the `values` and `names` arrays indexed by enumerator value,
+     * and `lookup`, the PerfectHash of the names.
+     */
+    template <typename E>
+    struct EnumTraits;
+
+    /// Enumerations with an EnumTraits specialisation.
+    template <typename E>
+    concept GeneratedEnum = requires { EnumTraits<E>::count; };
+
+    /// 64-bit FNV-1a hash of a name.
+    constexpr std::uint64_t hashName(const std::string_view name) noexcept {
+        std::uint64_t hash = 0xcbf29ce484222325ULL;
+        for (const char c : name) {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001b3ULL;
+        }
+        return hash;
+    }
+
+    /// Scrambles a name hash with a seed through the splitmix64 finaliser, so every bit depends on both.
+    constexpr std::uint64_t displace(std::uint64_t hash, const std::uint64_t seed) noexcept {
+        hash ^= seed * 0x9e3779b97f4a7c15ULL;
+        hash ^= hash >> 30;
+        hash *= 0xbf58476d1ce4e5b9ULL;
+        hash ^= hash >> 27;
+        hash *= 0x94d049bb133111ebULL;
+        return hash ^ (hash >> 31);
+    }
+
+    /**
+     * @class PerfectHash
+     * @brief Maps each of N names to its own slot; built at compile time by hash and displace.
+     *
+     * The names are spread over N buckets by their hash. Starting with the largest bucket, each
+     * bucket takes the first seed that moves all of its names to free slots of a table of at least
+     * 2N slots. A lookup hashes the name once, displaces the hash by its bucket's seed and compares
+     * the name stored in the resulting slot.
+     *
+     * @tparam N The number of names.
+     */
+    template <std::size_t N>
+    class PerfectHash {
+    public:
+        /// Number of slots, a power of two so that a slot is selected with a mask.
+        static constexpr std::size_t SLOTS = std::bit_ceil(2 * N);
+
+        /**
+         * @brief Finds a seed for every bucket.
+         * @param names The distinct names, indexed by enumerator value.
+         * Fails to compile, through perfectHashNotFound(), if two names cannot be separated.
+         */
+        consteval explicit PerfectHash(const std::array<std::string_view, N>& names) {
+            std::array<std::uint64_t, N> hashes{};
+            std::array<std::size_t, N> bucketSizes{};
+            for (std::size_t i = 0; i < N; ++i) {
+                hashes[i] = hashName(names[i]);
+                ++bucketSizes[bucketOf(hashes[i])];
+            }
+
+            std::array<bool, N> done{};
+            for (std::size_t round = 0; round < N; ++round) {
+                // The largest bucket left is the hardest to fit, so it goes first.
+                std::size_t bucket = N;
+                for (std::size_t b = 0; b < N; ++b) {
+                    if (!done[b] && (bucket == N || bucketSizes[b] > bucketSizes[bucket]))
+                        bucket = b;
+                }
+                done[bucket] = true;
+                if (bucketSizes[bucket] == 0)
+                    break;
+
+                std::uint64_t seed = 1;
+                while (!tryPlace(hashes, bucket, seed)) {
+                    if (++seed > MAX_SEED)
+                        perfectHashNotFound();
+                }
+                seeds_[bucket] = seed;
+            }
+        }
+
+        /**
+         * @brief Looks a name up.
+         * @param names The names the hash was built from.
+         * @param name The name to find.
+         * @return The index of the name, or std::nullopt if it is not one of them.
+         */
+        constexpr std::optional<std::size_t> find(const std::array<std::string_view, N>& names,
+                                                  const std::string_view name) const noexcept {
+            const std::uint64_t hash = hashName(name);
+            const std::size_t entry = slots_[slotOf(hash, seeds_[bucketOf(hash)])];
+            if (entry == 0 || names[entry - 1] != name)
+                return std::nullopt;
+            return entry - 1;
+        }
+
+    private:
+        /// Number of seeds tried per bucket before giving up.
+        static constexpr std::uint64_t MAX_SEED = 1 << 16;
+
+        static constexpr std::size_t bucketOf(const std::uint64_t hash) noexcept {
+            return displace(hash, 0) % N;
+        }
+
+        static constexpr std::size_t slotOf(const std::uint64_t hash, const std::uint64_t seed) noexcept {
+            return displace(hash, seed) & (SLOTS - 1);
+        }
+
+        /// Places every name of a bucket with a seed, or places none and returns false.
+        constexpr bool tryPlace(const std::array<std::uint64_t, N>& hashes, const std::size_t bucket,
+                                const std::uint64_t seed) {
+            std::array<std::size_t, N> placed{};
+            std::size_t count = 0;
+            for (std::size_t i = 0; i < N; ++i) {
+                if (bucketOf(hashes[i]) != bucket)
+                    continue;
+                const std::size_t slot = slotOf(hashes[i], seed);
+                if (slots_[slot] != 0) {
+                    for (std::size_t j = 0; j < count; ++j)
+                        slots_[placed[j]] = 0;
+                    return false;
+                }
+                slots_[slot] = i + 1;
+                placed[count++] = slot;
+            }
+            return true;
+        }
+
+        std::array<std::uint64_t, N> seeds_{};   ///< Displacement seed of each bucket.
+        std::array<std::size_t, SLOTS> slots_{}; ///< One plus the index of the name in each slot, or zero if empty.
+    };
+
+    /**
+     * @brief Returns the enumerator with the given name, in constant time.
+     * @tparam E The generated enumeration.
+     * @param name The enumerator name, e.g. "BUY".
+     * @return The enumerator, or std::nullopt if no enumerator has that name.
+     */
+    template <GeneratedEnum E>
+    constexpr std::optional<E> fromString(const std::string_view name) noexcept {
+        using Traits = EnumTraits<E>;
+        const auto index = Traits::lookup.find(Traits::names, name);
+        if (!index)
+            return std::nullopt;
+        return Traits::values[*index];
+    }
+
+    /// Reports whether the name of every enumerator converts back to it, for a static_assert.
+    template <GeneratedEnum E>
+    consteval bool roundTrips() {
+        for (const E value : EnumTraits<E>::values) {
+            // toString() is found by argument-dependent lookup in the enumeration's namespace.
+            if (fromString<E>(toString(value)) != value)
+                return false;
+        }
+        return true;
+    }
+} // namespace enums
+)";
+
+    /**
+     * @brief Joins the enumerator names into a brace list of string literals.
+     */
+    std::string nameList(const EnumModels::EnumModel &en)
+    {
+        std::string list;
+        for (const auto &value : en.values)
+        {
+            list += (list.empty() ? "\"" : ", \"") + value + "\"";
+        }
+        return "{" + list + "}";
+    }
+
+} // end anonymous namespace
+
+namespace EnumGenerator
+{
+    std::string generateEnumDeclaration(const EnumModels::EnumModel &en)
+    {
+        const size_t count = en.values.size();
+        std::ostringstream oss;
+        if (!en.description.empty())
+        {
+            oss << "/**\n * @brief " << en.description << "\n */\n";
+        }
+        oss << "enum class " << en.name << (en.underlyingType.empty() ? "" : " : " + en.underlyingType) << " {\n";
+        for (size_t i = 0; i < count; ++i)
+        {
+            oss << "    " << en.values[i] << (i + 1 < count ? "," : "") << "\n";
+        }
+        oss << "};\n\n";
+        oss << "/// Returns the name of a " << en.name << " enumerator, or an empty view for a value out of range.\n"
+            << "constexpr std::string_view toString(const " << en.name << " value) noexcept {\n"
+            << "    constexpr std::array<std::string_view, " << count << "> names" << nameList(en) << ";\n"
+            << "    const auto index = static_cast<std::size_t>(value);\n"
+            << "    return index < names.size() ? names[index] : std::string_view{};\n"
+            << "}\n";
+        return oss.str();
+    }
+
+    std::string generateEnumTraits(const EnumModels::EnumModel &en, const std::string &scope)
+    {
+        const std::string qualifiedName = scope + en.name;
+        const size_t count = en.values.size();
+        std::string values;
+        for (const auto &value : en.values)
+        {
+            values += (values.empty() ? "" : ", ") + qualifiedName + "::" + value;
+        }
+
+        std::ostringstream oss;
+        oss << "\n/// Values and names of " << qualifiedName << ", with the perfect hash enums::fromString() looks names up in.\n"
+            << "template <>\n"
+            << "struct enums::EnumTraits<" << qualifiedName << "> {\n"
+            << "    static constexpr std::size_t count = " << count << ";\n"
+            << "    static constexpr std::array<" << qualifiedName << ", " << count << "> values{" << values << "};\n"
+            << "    static constexpr std::array<std::string_view, " << count << "> names" << nameList(en) << ";\n"
+            << "    static constexpr enums::PerfectHash<" << count << "> lookup{names};\n"
+            << "};\n"
+            << "static_assert(enums::roundTrips<" << qualifiedName << ">(), \"every " << qualifiedName
+            << " name converts back to its enumerator\");\n";
+        return oss.str();
+    }
+
+    std::set<std::string> requiredHeaders(const EnumModels::EnumModel &)
+    {
+        return {"<array>", "<cstddef>", "<cstdint>", "<string_view>", std::string("\"") + SUPPORT_HEADER + "\""};
+    }
+
+    bool hasEnums(const CodeGroupModels::NamespaceModel &ns)
+    {
+        return !ns.enums.empty() || std::any_of(ns.namespaces.begin(), ns.namespaces.end(), [](const CodeGroupModels::NamespaceModel &nested)
+                                                 { return hasEnums(nested); });
+    }
+
+    std::string generateSupportHeader()
+    {
+        return SUPPORT_HEADER_CONTENT;
+    }
+
+} // namespace EnumGenerator
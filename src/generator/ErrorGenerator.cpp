@@ -0,0 +1,137 @@
+#include "ErrorGenerator.h"
+#include "EnumGenerator.h"
+#include "GeneratorUtilities.h"
+
+#include <sstream>
+#include <stdexcept>
+
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ */
+namespace
+{
+    /// The error codes of generated callables; NOT_IMPLEMENTED is what the stubs return.
+    const EnumModels::EnumModel ERROR_ENUM{"Error",
+                                           "Error codes returned by generated callables through std::expected.",
+                                           {"NOT_IMPLEMENTED", "INVALID_ARGUMENT", "OUT_OF_RANGE", "UNAVAILABLE", "INTERNAL"},
+                                           ""};
+
+    /**
+     * @brief Marks every method in a list as reporting errors through std::expected.
+     */
+    void markMethods(std::vector<CallableModels::MethodModel> &methods)
+    {
+        for (auto &meth : methods)
+        {
+            meth.expected = true;
+        }
+    }
+
+} // end anonymous namespace
+
+namespace ErrorGenerator
+{
+    bool returnsExpected(const CallableModels::CallableModel &callable)
+    {
+        const auto &decl = callable.returnType.typeDecl;
+        return callable.expected && !decl.isLValReference && !decl.isRValReference &&
+               callable.returnType.type != PropertiesModels::Types::AUTO;
+    }
+
+    std::string returnType(const CallableModels::CallableModel &callable)
+    {
+        const std::string declared = GeneratorUtilities::dataTypeToString(callable.returnType);
+        return returnsExpected(callable) ? expectedType(declared) : declared;
+    }
+
+    std::string expectedType(const std::string &valueType)
+    {
+        return "std::expected<" + valueType + ", errors::Error>";
+    }
+
+    std::string notImplementedStatement()
+    {
+        return "return std::unexpected(errors::Error::NOT_IMPLEMENTED);";
+    }
+
+    ClassModels::ClassModel applyErrorHandling(const ClassModels::ClassModel &cl, const CodeGroupModels::ErrorHandling errors)
+    {
+        ClassModels::ClassModel resolved = cl;
+        if (errors != CodeGroupModels::ErrorHandling::EXPECTED)
+            return resolved;
+
+        if (cl.options.serialize != ClassModels::SerializationFormat::NONE)
+            throw std::runtime_error("Class " + cl.name + " is serialisable, which cannot be combined with errors = expected.");
+        resolved.options.expected = true;
+        markMethods(resolved.publicMethods);
+        markMethods(resolved.privateMethods);
+        markMethods(resolved.protectedMethods);
+        return resolved;
+    }
+
+    CodeGroupModels::NamespaceModel applyErrorHandling(const CodeGroupModels::NamespaceModel &ns,
+                                                       const CodeGroupModels::ErrorHandling errors)
+    {
+        CodeGroupModels::NamespaceModel resolved = ns;
+        resolved.classes = applyErrorHandling(ns.classes, errors);
+        resolved.functions = applyErrorHandling(ns.functions, errors);
+        for (auto &nested : resolved.namespaces)
+        {
+            nested = applyErrorHandling(nested, errors);
+        }
+        return resolved;
+    }
+
+    std::vector<CallableModels::FunctionModel> applyErrorHandling(const std::vector<CallableModels::FunctionModel> &functions,
+                                                                  const CodeGroupModels::ErrorHandling errors)
+    {
+        std::vector<CallableModels::FunctionModel> resolved = functions;
+        for (auto &func : resolved)
+        {
+            func.expected = errors == CodeGroupModels::ErrorHandling::EXPECTED;
+        }
+        return resolved;
+    }
+
+    std::vector<ClassModels::ClassModel> applyErrorHandling(const std::vector<ClassModels::ClassModel> &classes,
+                                                            const CodeGroupModels::ErrorHandling errors)
+    {
+        std::vector<ClassModels::ClassModel> resolved;
+        resolved.reserve(classes.size());
+        for (const auto &cl : classes)
+        {
+            resolved.push_back(applyErrorHandling(cl, errors));
+        }
+        return resolved;
+    }
+
+    std::set<std::string> requiredHeaders()
+    {
+        return {"<expected>", std::string("\"") + SUPPORT_HEADER + "\""};
+    }
+
+    std::string generateSupportHeader()
+    {
+        std::ostringstream oss;
+        oss << "/**\n"
+            << " * @file " << SUPPORT_HEADER << "\n"
+            << " * @brief Error codes of the project, returned by generated callables through std::expected.\n"
+            << " *\n"
+            << " * The project builds without exceptions: fallible callables return\n"
+            << " * std::expected<T, errors::Error>, and generated stubs return Error::NOT_IMPLEMENTED.\n"
+            << " */\n\n"
+            << "#pragma once\n\n";
+        std::set<std::string> headers = EnumGenerator::requiredHeaders(ERROR_ENUM);
+        headers.insert("<expected>");
+        for (const auto &header : headers)
+        {
+            oss << "#include " << header << "\n";
+        }
+        oss << "\nnamespace errors\n{\n"
+            << GeneratorUtilities::indentCode(EnumGenerator::generateEnumDeclaration(ERROR_ENUM))
+            << "} // namespace errors\n"
+            << EnumGenerator::generateEnumTraits(ERROR_ENUM, "errors::");
+        return oss.str();
+    }
+
+} // namespace ErrorGenerator
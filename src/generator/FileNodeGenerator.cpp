@@ -2,9 +2,37 @@
 #include "ClassGenerator.h"
 #include "NamespaceGenerator.h"
 #include "CallableGenerator.h"
+#include "ValueGenerator.h"
 
+#include <set>
 #include <sstream>
 
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ */
+namespace
+{
+    /**
+     * @brief Formats a set of headers as #include directives followed by a blank line.
+     *
+     * @param headers The headers in angle-bracket form.
+     * @return The directives, or an empty string if there are no headers.
+     */
+    std::string formatIncludes(const std::set<std::string> &headers)
+    {
+        if (headers.empty())
+            return "";
+
+        std::ostringstream oss;
+        for (const auto &header : headers)
+        {
+            oss << "#include " << header << "\n";
+        }
+        oss << "\n";
+        return oss.str();
+    }
+}
+
 namespace FileNodeGenerator
 {
 
@@ -28,6 +56,14 @@ namespace FileNodeGenerator
         return ClassGenerator::generateClassDefinition(cl);
     }
 
+    // Specialization for generating header-only content from a ClassModel.
+    // Methods are defined in-class and special members are defined inline after the class.
+    template <>
+    std::string generateHeaderOnlyContent<ClassModels::ClassModel>(const ClassModels::ClassModel &cl)
+    {
+        return ClassGenerator::generateClassDeclaration(cl, true);
+    }
+
     // Specialization for generating header content from a NamespaceModel.
     // Uses the NamespaceGenerator to emit the namespace declaration.
     template <>
@@ -44,6 +80,14 @@ namespace FileNodeGenerator
         return NamespaceGenerator::generateNamespaceDefinition(ns);
     }
 
+    // Specialization for generating header-only content from a NamespaceModel.
+    // Uses the NamespaceGenerator to emit the namespace with inline definitions.
+    template <>
+    std::string generateHeaderOnlyContent<CodeGroupModels::NamespaceModel>(const CodeGroupModels::NamespaceModel &ns)
+    {
+        return NamespaceGenerator::generateNamespaceDeclaration(ns, true);
+    }
+
     // Specialization for generating header content for a vector of free-standing functions.
     // Each function in the vector will be turned into a forward declaration.
     template <>
@@ -65,9 +109,214 @@ namespace FileNodeGenerator
         std::ostringstream oss;
         for (const auto &func : funcs)
         {
-            oss << CallableGenerator::generateFunctionDefinition(func) << "\n";
+            if (!func.templateSpec.isTemplate())
+                oss << CallableGenerator::generateFunctionDefinition(func) << "\n";
+        }
+        return oss.str();
+    }
+
+    // Specialization for generating header-only content for a vector of free-standing functions.
+    // Each function in the vector will be emitted as an inline definition.
+    template <>
+    std::string generateHeaderOnlyContent<std::vector<CallableModels::FunctionModel>>(const std::vector<CallableModels::FunctionModel> &funcs)
+    {
+        std::ostringstream oss;
+        for (const auto &func : funcs)
+        {
+            oss << CallableGenerator::generateInlineFunctionDeclaration(func) << "\n";
+        }
+        return oss.str();
+    }
+
+    // Specialization for generating header content for a group of merged classes.
+    // Each class declaration is emitted in turn, separated by a blank line.
+    template <>
+    std::string generateHeaderContent<std::vector<ClassModels::ClassModel>>(const std::vector<ClassModels::ClassModel> &classes)
+    {
+        std::ostringstream oss;
+        for (const auto &cl : classes)
+        {
+            oss << ClassGenerator::generateClassDeclaration(cl) << "\n";
+        }
+        return oss.str();
+    }
+
+    // Specialization for generating source content for a group of merged classes.
+    // All class definitions share a single translation unit.
+    template <>
+    std::string generateSourceContent<std::vector<ClassModels::ClassModel>>(const std::vector<ClassModels::ClassModel> &classes)
+    {
+        std::ostringstream oss;
+        for (const auto &cl : classes)
+        {
+            oss << ClassGenerator::generateClassDefinition(cl) << "\n";
+        }
+        return oss.str();
+    }
+
+    // Specialization for generating header-only content for a group of merged classes.
+    template <>
+    std::string generateHeaderOnlyContent<std::vector<ClassModels::ClassModel>>(const std::vector<ClassModels::ClassModel> &classes)
+    {
+        std::ostringstream oss;
+        for (const auto &cl : classes)
+        {
+            oss << ClassGenerator::generateClassDeclaration(cl, true) << "\n";
+        }
+        return oss.str();
+    }
+
+    // Specialization for generating the template definitions of a ClassModel.
+    // Covers every member of a class template and the member templates of other classes.
+    template <>
+    std::string generateTemplateContent<ClassModels::ClassModel>(const ClassModels::ClassModel &cl)
+    {
+        return ClassGenerator::hasTemplates(cl) ? ClassGenerator::generateClassDefinition(cl, true) : "";
+    }
+
+    // Specialization for generating the template definitions of a NamespaceModel.
+    // Namespaces without any templates produce no template file at all.
+    template <>
+    std::string generateTemplateContent<CodeGroupModels::NamespaceModel>(const CodeGroupModels::NamespaceModel &ns)
+    {
+        return NamespaceGenerator::hasTemplates(ns) ? NamespaceGenerator::generateNamespaceDefinition(ns, true) : "";
+    }
+
+    // Specialization for generating the template definitions of a vector of free-standing functions.
+    template <>
+    std::string generateTemplateContent<std::vector<CallableModels::FunctionModel>>(const std::vector<CallableModels::FunctionModel> &funcs)
+    {
+        std::ostringstream oss;
+        for (const auto &func : funcs)
+        {
+            if (func.templateSpec.isTemplate())
+                oss << CallableGenerator::generateFunctionDefinition(func) << "\n";
         }
         return oss.str();
     }
 
+    // Specialization for generating the template definitions of a group of merged classes.
+    template <>
+    std::string generateTemplateContent<std::vector<ClassModels::ClassModel>>(const std::vector<ClassModels::ClassModel> &classes)
+    {
+        std::ostringstream oss;
+        for (const auto &cl : classes)
+        {
+            if (ClassGenerator::hasTemplates(cl))
+                oss << ClassGenerator::generateClassDefinition(cl, true) << "\n";
+        }
+        return oss.str();
+    }
+
+    // Specialization for generating the explicit instantiations of a ClassModel.
+    template <>
+    std::string generateExplicitInstantiations<ClassModels::ClassModel>(const ClassModels::ClassModel &cl, const bool externDecl)
+    {
+        return ClassGenerator::generateExplicitInstantiations(cl, externDecl);
+    }
+
+    // Specialization for generating the explicit instantiations of a NamespaceModel, qualified with the namespace path.
+    template <>
+    std::string generateExplicitInstantiations<CodeGroupModels::NamespaceModel>(const CodeGroupModels::NamespaceModel &ns, const bool externDecl)
+    {
+        return NamespaceGenerator::generateExplicitInstantiations(ns, externDecl);
+    }
+
+    // Specialization for generating the explicit instantiations of a vector of free-standing functions.
+    template <>
+    std::string generateExplicitInstantiations<std::vector<CallableModels::FunctionModel>>(const std::vector<CallableModels::FunctionModel> &funcs,
+                                                                                           const bool externDecl)
+    {
+        std::string instantiations;
+        for (const auto &func : funcs)
+        {
+            instantiations += CallableGenerator::generateExplicitInstantiations(func, externDecl);
+        }
+        return instantiations;
+    }
+
+    // Specialization for generating the explicit instantiations of a group of merged classes.
+    template <>
+    std::string generateExplicitInstantiations<std::vector<ClassModels::ClassModel>>(const std::vector<ClassModels::ClassModel> &classes,
+                                                                                     const bool externDecl)
+    {
+        std::string instantiations;
+        for (const auto &cl : classes)
+        {
+            instantiations += ClassGenerator::generateExplicitInstantiations(cl, externDecl);
+        }
+        return instantiations;
+    }
+
+    // Specialization for generating the std::hash specialisation of a ClassModel.
+    template <>
+    std::string generateGlobalSpecializations<ClassModels::ClassModel>(const ClassModels::ClassModel &cl)
+    {
+        return ValueGenerator::generateHashSpecialization(cl);
+    }
+
+    // Specialization for generating the EnumTraits and std::hash specialisations of a NamespaceModel, qualified with the namespace path.
+    template <>
+    std::string generateGlobalSpecializations<CodeGroupModels::NamespaceModel>(const CodeGroupModels::NamespaceModel &ns)
+    {
+        return NamespaceGenerator::generateGlobalSpecializations(ns);
+    }
+
+    // Free functions have no global specialisations.
+    template <>
+    std::string generateGlobalSpecializations<std::vector<CallableModels::FunctionModel>>(const std::vector<CallableModels::FunctionModel> &)
+    {
+        return "";
+    }
+
+    // Specialization for generating the std::hash specialisations of a group of merged classes.
+    template <>
+    std::string generateGlobalSpecializations<std::vector<ClassModels::ClassModel>>(const std::vector<ClassModels::ClassModel> &classes)
+    {
+        std::string specializations;
+        for (const auto &cl : classes)
+        {
+            specializations += ValueGenerator::generateHashSpecialization(cl);
+        }
+        return specializations;
+    }
+
+    // Specialization for collecting the includes of a class header.
+    template <>
+    std::string generateIncludes<ClassModels::ClassModel>(const ClassModels::ClassModel &cl)
+    {
+        return formatIncludes(ClassGenerator::requiredHeaders(cl));
+    }
+
+    // Specialization for collecting the includes of a namespace header, including nested namespaces.
+    template <>
+    std::string generateIncludes<CodeGroupModels::NamespaceModel>(const CodeGroupModels::NamespaceModel &ns)
+    {
+        return formatIncludes(NamespaceGenerator::requiredHeaders(ns));
+    }
+
+    // Specialization for collecting the includes of a free function header.
+    template <>
+    std::string generateIncludes<std::vector<CallableModels::FunctionModel>>(const std::vector<CallableModels::FunctionModel> &funcs)
+    {
+        std::set<std::string> headers;
+        for (const auto &func : funcs)
+        {
+            headers.merge(CallableGenerator::requiredHeaders(func));
+        }
+        return formatIncludes(headers);
+    }
+
+    // Specialization for collecting the includes of a merged class header.
+    template <>
+    std::string generateIncludes<std::vector<ClassModels::ClassModel>>(const std::vector<ClassModels::ClassModel> &classes)
+    {
+        std::set<std::string> headers;
+        for (const auto &cl : classes)
+        {
+            headers.merge(ClassGenerator::requiredHeaders(cl));
+        }
+        return formatIncludes(headers);
+    }
+
 } // namespace FileNodeGenerator
@@ -1,9 +1,14 @@
 #include "GeneratorUtilities.h"
 
+#include <algorithm>
+#include <array>
+#include <cctype>
 #include <stdexcept>
 #include <string>
 #include <sstream>
 #include <format>
+#include <string_view>
+#include <utility>
 
 /**
  * @namespace
@@ -86,6 +91,67 @@ namespace
 
         return result;
     }
+
+    /**
+     * @brief Splits a template argument list at the commas that are not nested in brackets.
+     *
+     * @param arguments The comma-separated argument list, e.g. "std::map<int, char>, 4".
+     * @return The trimmed arguments.
+     */
+    std::vector<std::string> splitTemplateArguments(const std::string &arguments)
+    {
+        std::vector<std::string> result;
+        std::string current;
+        int depth = 0;
+        for (char c : arguments + ",")
+        {
+            if (c == '<' || c == '(' || c == '[')
+                ++depth;
+            else if (c == '>' || c == ')' || c == ']')
+                --depth;
+
+            if (c == ',' && depth == 0)
+            {
+                size_t first = current.find_first_not_of(' ');
+                size_t last = current.find_last_not_of(' ');
+                result.push_back(first == std::string::npos ? "" : current.substr(first, last - first + 1));
+                current.clear();
+            }
+            else
+            {
+                current += c;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Reports whether a character can be part of an identifier.
+     */
+    bool isIdentifierChar(const char c)
+    {
+        return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+    }
+
+    /// Standard types usable as non-type template parameters, with the headers declaring them.
+    constexpr std::array<std::pair<const char *, const char *>, 16> TEMPLATE_PARAMETER_TYPES = {{
+        {"std::size_t", "<cstddef>"},
+        {"std::ptrdiff_t", "<cstddef>"},
+        {"std::byte", "<cstddef>"},
+        {"std::nullptr_t", "<cstddef>"},
+        {"std::int8_t", "<cstdint>"},
+        {"std::int16_t", "<cstdint>"},
+        {"std::int32_t", "<cstdint>"},
+        {"std::int64_t", "<cstdint>"},
+        {"std::uint8_t", "<cstdint>"},
+        {"std::uint16_t", "<cstdint>"},
+        {"std::uint32_t", "<cstdint>"},
+        {"std::uint64_t", "<cstdint>"},
+        {"std::intmax_t", "<cstdint>"},
+        {"std::uintmax_t", "<cstdint>"},
+        {"std::intptr_t", "<cstdint>"},
+        {"std::uintptr_t", "<cstdint>"},
+    }};
 } // end anonymous namespace
 
 namespace GeneratorUtilities
@@ -180,4 +246,123 @@ namespace GeneratorUtilities
         return path;
     }
 
+    std::vector<std::string> templateParameterNames(const PropertiesModels::TemplateSpec &spec)
+    {
+        std::vector<std::string> names;
+        for (const auto &param : spec.parameters)
+        {
+            size_t end = param.find_last_not_of(' ') + 1;
+            size_t start = end;
+            while (start > 0 && isIdentifierChar(param[start - 1]))
+                --start;
+            names.push_back(param.substr(start, end - start));
+        }
+        return names;
+    }
+
+    std::set<std::string> templateParameterHeaders(const PropertiesModels::TemplateSpec &spec)
+    {
+        std::set<std::string> headers;
+        for (const auto &param : spec.parameters)
+        {
+            for (const auto &[type, header] : TEMPLATE_PARAMETER_TYPES)
+            {
+                // Match whole identifiers only, so std::int8_t does not match std::uint8_t.
+                const std::string_view name = type;
+                for (size_t pos = param.find(name); pos != std::string::npos; pos = param.find(name, pos + 1))
+                {
+                    const size_t end = pos + name.size();
+                    if ((pos == 0 || !isIdentifierChar(param[pos - 1])) && (end == param.size() || !isIdentifierChar(param[end])))
+                    {
+                        headers.insert(header);
+                        break;
+                    }
+                }
+            }
+        }
+        return headers;
+    }
+
+    std::string templateHeader(const PropertiesModels::TemplateSpec &spec)
+    {
+        if (!spec.isTemplate())
+            return "";
+
+        std::string header = "template <";
+        for (size_t i = 0; i < spec.parameters.size(); ++i)
+        {
+            header += (i == 0 ? "" : ", ") + spec.parameters[i];
+        }
+        return header + ">\n";
+    }
+
+    std::string templateArgumentList(const PropertiesModels::TemplateSpec &spec)
+    {
+        if (!spec.isTemplate())
+            return "";
+
+        std::string arguments = "<";
+        const auto names = templateParameterNames(spec);
+        for (size_t i = 0; i < names.size(); ++i)
+        {
+            arguments += (i == 0 ? "" : ", ") + names[i];
+        }
+        return arguments + ">";
+    }
+
+    std::string templateParameterDoxygen(const PropertiesModels::TemplateSpec &spec)
+    {
+        std::string doxygen;
+        for (const auto &name : templateParameterNames(spec))
+        {
+            doxygen += " * @tparam " + name + " \n";
+        }
+        return doxygen;
+    }
+
+    std::string substituteTemplateArguments(const std::string &code, const PropertiesModels::TemplateSpec &spec,
+                                            const std::string &arguments)
+    {
+        const auto names = templateParameterNames(spec);
+        const auto values = splitTemplateArguments(arguments);
+        if (names.size() != values.size())
+            throw std::runtime_error("Template arguments <" + arguments + "> do not match the template parameters.");
+
+        // Walk the code identifier by identifier, replacing parameter names.
+        std::string result;
+        size_t i = 0;
+        while (i < code.size())
+        {
+            if (!isIdentifierChar(code[i]))
+            {
+                result += code[i++];
+                continue;
+            }
+
+            size_t start = i;
+            while (i < code.size() && isIdentifierChar(code[i]))
+                ++i;
+            std::string identifier = code.substr(start, i - start);
+
+            auto it = std::find(names.begin(), names.end(), identifier);
+            result += it == names.end() ? identifier : values[it - names.begin()];
+        }
+        return result;
+    }
+
+    std::vector<PropertiesModels::Parameter> allMembers(const ClassModels::ClassModel &cl)
+    {
+        std::vector<PropertiesModels::Parameter> members = cl.publicMembers;
+        members.insert(members.end(), cl.privateMembers.begin(), cl.privateMembers.end());
+        members.insert(members.end(), cl.protectedMembers.begin(), cl.protectedMembers.end());
+        return members;
+    }
+
+    std::string executableName(const std::string &qualifiedName, const std::string &suffix)
+    {
+        std::string name = qualifiedName;
+        std::erase(name, ':');
+        return name + suffix;
+    }
+
 } // namespace GeneratorUtilities
@@ -0,0 +1,309 @@
+#include "LayoutGenerator.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <string>
+#include <string_view>
+#include <utility>
+
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ *
+ * These helpers simulate how a compiler places data members so that alternative member
+ * orders can be compared without compiling them.
+ */
+namespace
+{
+    using Members = std::vector<PropertiesModels::Parameter>;
+
+    using LayoutGenerator::POINTER_SIZE;
+
+    /// Standard aliases and library types spelled as custom types, with their layout on the assumed target.
+    constexpr std::array<std::pair<std::string_view, LayoutGenerator::TypeLayout>, 18> STANDARD_TYPES = {{
+        {"std::byte", {1, 1}},
+        {"std::int8_t", {1, 1}},
+        {"std::uint8_t", {1, 1}},
+        {"std::int16_t", {2, 2}},
+        {"std::uint16_t", {2, 2}},
+        {"std::int32_t", {4, 4}},
+        {"std::uint32_t", {4, 4}},
+        {"std::int64_t", {8, 8}},
+        {"std::uint64_t", {8, 8}},
+        {"std::intmax_t", {8, 8}},
+        {"std::uintmax_t", {8, 8}},
+        {"std::intptr_t", {POINTER_SIZE, POINTER_SIZE}},
+        {"std::uintptr_t", {POINTER_SIZE, POINTER_SIZE}},
+        {"std::size_t", {POINTER_SIZE, POINTER_SIZE}},
+        {"std::ptrdiff_t", {POINTER_SIZE, POINTER_SIZE}},
+        {"std::nullptr_t", {POINTER_SIZE, POINTER_SIZE}},
+        {"std::string_view", {2 * POINTER_SIZE, POINTER_SIZE}},
+        {"std::span<", {2 * POINTER_SIZE, POINTER_SIZE}},
+    }};
+
+    /**
+     * @brief Rounds an offset up to the next multiple of an alignment.
+     */
+    size_t alignUp(const size_t offset, const size_t alignment)
+    {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+
+    /**
+     * @brief Returns the layout a member takes in the class, including any cache-line alignment.
+     *
+     * @param member The data member.
+     * @param lineBoundary True if the previous member owns its cache line.
+     * @return The member's effective layout, or std::nullopt if its size is unknown.
+     */
+    std::optional<LayoutGenerator::TypeLayout> memberLayout(const PropertiesModels::Parameter &member, const bool lineBoundary)
+    {
+        auto layout = LayoutGenerator::typeLayout(member.type);
+        if (layout && LayoutGenerator::startsCacheLine(member, lineBoundary))
+            layout->alignment = std::max(layout->alignment, LayoutGenerator::CACHE_LINE_SIZE);
+        return layout;
+    }
+
+    /**
+     * @brief Places members starting at an offset.
+     *
+     * Members of unknown size are skipped.
+     *
+     * @param members The members in declaration order.
+     * @param offset The offset at which the first member may start.
+     * @param maxAlignment Updated with the largest alignment seen.
+     * @param lineBoundary True if the member before the first owns its cache line; updated for the last member.
+     * @return The offset just past the last member.
+     */
+    size_t placeMembers(const Members &members, size_t offset, size_t &maxAlignment, bool &lineBoundary)
+    {
+        for (const auto &member : members)
+        {
+            if (auto layout = memberLayout(member, lineBoundary))
+            {
+                offset = alignUp(offset, layout->alignment) + layout->size;
+                maxAlignment = std::max(maxAlignment, layout->alignment);
+            }
+            lineBoundary = PropertiesModels::hasAnnotation(member.annotations, PropertiesModels::Annotation::OWN_CACHELINE);
+        }
+        return offset;
+    }
+
+    /**
+     * @brief Estimates the size of an object whose members are declared in the given sections.
+     *
+     * @param sections The access sections in emission order.
+     * @return The estimated size, including tail padding.
+     */
+    size_t estimateSize(const std::array<const Members *, 3> &sections)
+    {
+        size_t offset = 0;
+        size_t maxAlignment = 1;
+        bool lineBoundary = false;
+        for (const auto *section : sections)
+        {
+            offset = placeMembers(*section, offset, maxAlignment, lineBoundary);
+        }
+        return alignUp(offset, maxAlignment);
+    }
+
+    /**
+     * @brief Stable-sorts members by alignment and size, with members of unknown size first.
+     *
+     * Members owning a cache line sort as if aligned to it.
+     *
+     * @param members The members in DSL order.
+     * @param descending True to place the most aligned members first, false for the least.
+     * @return The sorted members.
+     */
+    Members sortMembers(const Members &members, const bool descending)
+    {
+        Members sorted = members;
+        std::stable_sort(sorted.begin(), sorted.end(),
+                         [descending](const PropertiesModels::Parameter &a, const PropertiesModels::Parameter &b)
+                         {
+                             auto la = memberLayout(a, false);
+                             auto lb = memberLayout(b, false);
+                             if (!la || !lb)
+                                 return !la && lb;
+                             if (la->alignment != lb->alignment)
+                                 return descending ? la->alignment > lb->alignment : la->alignment < lb->alignment;
+                             return descending ? la->size > lb->size : la->size < lb->size;
+                         });
+        return sorted;
+    }
+
+    /**
+     * @brief Picks the member order that ends a group at the lowest offset.
+     *
+     * Ties prefer decreasing alignment, then increasing alignment, then DSL order.
+     *
+     * @param members The members in DSL order.
+     * @param offset The offset at which the group starts; advanced past the chosen order.
+     * @param maxAlignment Updated with the largest alignment seen.
+     * @param lineBoundary True if the preceding member owns its cache line; updated for the chosen order.
+     * @return The chosen order.
+     */
+    Members compactMembers(const Members &members, size_t &offset, size_t &maxAlignment, bool &lineBoundary)
+    {
+        std::array<Members, 3> candidates = {sortMembers(members, true), sortMembers(members, false), members};
+
+        size_t bestIndex = 0;
+        size_t bestEnd = 0;
+        for (size_t i = 0; i < candidates.size(); ++i)
+        {
+            size_t ignoredAlignment = 1;
+            bool ignoredBoundary = lineBoundary;
+            size_t end = placeMembers(candidates[i], offset, ignoredAlignment, ignoredBoundary);
+            if (i == 0 || end < bestEnd)
+            {
+                bestIndex = i;
+                bestEnd = end;
+            }
+        }
+
+        offset = placeMembers(candidates[bestIndex], offset, maxAlignment, lineBoundary);
+        return candidates[bestIndex];
+    }
+
+    /**
+     * @brief Orders one access section: hot members first, cold members last, each group
+     *        compacted under the compact policy.
+     *
+     * @param members The members in DSL order.
+     * @param policy The class's layout policy.
+     * @param offset The offset at which the section starts; advanced past it.
+     * @param maxAlignment Updated with the largest alignment seen.
+     * @param lineBoundary True if the preceding member owns its cache line; updated for the section.
+     * @return The members in emission order.
+     */
+    Members orderSection(const Members &members, const ClassModels::LayoutPolicy policy,
+                         size_t &offset, size_t &maxAlignment, bool &lineBoundary)
+    {
+        using PropertiesModels::Annotation;
+
+        Members ordered;
+        ordered.reserve(members.size());
+        for (int group = 0; group < 3; ++group)
+        {
+            Members groupMembers;
+            for (const auto &member : members)
+            {
+                bool hot = PropertiesModels::hasAnnotation(member.annotations, Annotation::HOT);
+                bool cold = PropertiesModels::hasAnnotation(member.annotations, Annotation::COLD);
+                int memberGroup = hot ? 0 : (cold ? 2 : 1);
+                if (memberGroup == group)
+                    groupMembers.push_back(member);
+            }
+
+            if (policy == ClassModels::LayoutPolicy::COMPACT)
+                groupMembers = compactMembers(groupMembers, offset, maxAlignment, lineBoundary);
+            else
+                offset = placeMembers(groupMembers, offset, maxAlignment, lineBoundary);
+
+            ordered.insert(ordered.end(), groupMembers.begin(), groupMembers.end());
+        }
+        return ordered;
+    }
+
+} // end anonymous namespace
+
+namespace LayoutGenerator
+{
+    std::optional<TypeLayout> typeLayout(const PropertiesModels::DataType &type)
+    {
+        using Type = PropertiesModels::Types;
+
+        TypeLayout element{};
+        if (type.typeDecl.ptrCount > 0 || type.typeDecl.isLValReference || type.typeDecl.isRValReference)
+        {
+            element = {POINTER_SIZE, POINTER_SIZE};
+        }
+        else
+        {
+            switch (type.type)
+            {
+            case Type::BOOL:
+            case Type::CHAR:
+                element = {1, 1};
+                break;
+            case Type::INT:
+            case Type::UINT:
+            case Type::FLOAT:
+                element = {4, 4};
+                break;
+            case Type::LONG:
+            case Type::ULONG:
+            case Type::LONGLONG:
+            case Type::ULONGLONG:
+            case Type::DOUBLE:
+                element = {8, 8};
+                break;
+            case Type::STRING:
+                // libstdc++ std::string: pointer, size and a 16-byte small-string buffer.
+                element = {4 * POINTER_SIZE, POINTER_SIZE};
+                break;
+            case Type::CUSTOM:
+            {
+                const std::string name = type.customType.value_or("");
+                const auto known = std::find_if(STANDARD_TYPES.begin(), STANDARD_TYPES.end(), [name](const auto &entry)
+                                                { return entry.first.ends_with('<') ? name.starts_with(entry.first) : name == entry.first; });
+                if (known == STANDARD_TYPES.end())
+                    return std::nullopt;
+                element = known->second;
+                break;
+            }
+            default:
+                return std::nullopt;
+            }
+        }
+
+        // Arrays repeat the element; dimensions given by name (e.g. constants) are unknown.
+        for (const auto &dim : type.typeDecl.arrayDimensions)
+        {
+            if (dim.empty() || !std::all_of(dim.begin(), dim.end(), [](unsigned char c) { return std::isdigit(c); }))
+                return std::nullopt;
+            element.size *= std::stoul(dim);
+        }
+        return element;
+    }
+
+    bool startsCacheLine(const PropertiesModels::Parameter &member, const bool previousOwnsLine)
+    {
+        return previousOwnsLine ||
+               PropertiesModels::hasAnnotation(member.annotations, PropertiesModels::Annotation::OWN_CACHELINE);
+    }
+
+    ClassModels::ClassModel orderMembers(const ClassModels::ClassModel &cl)
+    {
+        ClassModels::ClassModel ordered = cl;
+        const auto policy = cl.options.layout;
+
+        size_t offset = 0;
+        size_t maxAlignment = 1;
+        bool lineBoundary = false;
+        ordered.publicMembers = orderSection(cl.publicMembers, policy, offset, maxAlignment, lineBoundary);
+        ordered.privateMembers = orderSection(cl.privateMembers, policy, offset, maxAlignment, lineBoundary);
+        ordered.protectedMembers = orderSection(cl.protectedMembers, policy, offset, maxAlignment, lineBoundary);
+        return ordered;
+    }
+
+    LayoutReport estimateLayout(const ClassModels::ClassModel &cl)
+    {
+        const ClassModels::ClassModel ordered = orderMembers(cl);
+
+        bool isComplete = true;
+        for (const auto *section : {&cl.publicMembers, &cl.privateMembers, &cl.protectedMembers})
+        {
+            for (const auto &member : *section)
+            {
+                isComplete = isComplete && typeLayout(member.type).has_value();
+            }
+        }
+
+        return {estimateSize({&cl.publicMembers, &cl.privateMembers, &cl.protectedMembers}),
+                estimateSize({&ordered.publicMembers, &ordered.privateMembers, &ordered.protectedMembers}),
+                isComplete};
+    }
+
+} // namespace LayoutGenerator
@@ -1,14 +1,19 @@
 #include "NamespaceGenerator.h"
 #include "ClassGenerator.h"
 #include "CallableGenerator.h"
+#include "EnumGenerator.h"
 #include "GeneratorUtilities.h"
+#include "ValueGenerator.h"
 
 #include <sstream>
 
 namespace NamespaceGenerator
 {
-    std::string generateNamespaceDeclaration(const CodeGroupModels::NamespaceModel &ns)
+    std::string generateNamespaceDeclaration(const CodeGroupModels::NamespaceModel &ns, const bool headerOnly,
+                                             const std::string &scope)
     {
+        // Free functions are traced under their qualified name; anonymous namespaces add nothing.
+        const std::string nsScope = ns.name.empty() ? scope : scope + ns.name + "::";
         std::ostringstream oss;
 
         // If a description is provided, generate a Doxygen comment.
@@ -32,22 +37,30 @@ namespace NamespaceGenerator
 
         // Generate namespace declaration contents
         std::ostringstream innerOss;
+        // Enumerations come first so that classes and functions can use them.
+        for (const auto &en : ns.enums)
+        {
+            innerOss << EnumGenerator::generateEnumDeclaration(en) << "\n";
+        }
+
         // Generate declarations for nested classes.
         for (const auto &cls : ns.classes)
         {
-            innerOss << ClassGenerator::generateClassDeclaration(cls) << "\n";
+            innerOss << ClassGenerator::generateClassDeclaration(cls, headerOnly) << "\n";
         }
 
-        // Generate declarations for free functions.
+        // Generate declarations for free functions (inline definitions when header-only).
         for (const auto &fn : ns.functions)
         {
-            innerOss << CallableGenerator::generateFunctionDeclaration(fn) << "\n";
+            innerOss << (headerOnly ? CallableGenerator::generateInlineFunctionDeclaration(fn, nsScope)
+                                    : CallableGenerator::generateFunctionDeclaration(fn, nsScope))
+                     << "\n";
         }
 
         // Recursively generate declarations for nested namespaces.
         for (const auto &nestedNS : ns.namespaces)
         {
-            innerOss << generateNamespaceDeclaration(nestedNS) << "\n";
+            innerOss << generateNamespaceDeclaration(nestedNS, headerOnly, nsScope) << "\n";
         }
 
         // Indent the inner code
@@ -59,8 +72,10 @@ namespace NamespaceGenerator
         return oss.str();
     }
 
-    std::string generateNamespaceDefinition(const CodeGroupModels::NamespaceModel &ns)
+    std::string generateNamespaceDefinition(const CodeGroupModels::NamespaceModel &ns, const bool templates,
+                                            const std::string &scope)
     {
+        const std::string nsScope = ns.name.empty() ? scope : scope + ns.name + "::";
         std::ostringstream oss;
 
         // Start the namespace definition block.
@@ -77,19 +92,20 @@ namespace NamespaceGenerator
         std::ostringstream innerOss;
         for (const auto &cls : ns.classes)
         {
-            innerOss << ClassGenerator::generateClassDefinition(cls) << "\n";
+            innerOss << ClassGenerator::generateClassDefinition(cls, templates) << "\n";
         }
 
         // Generate definitions for free functions.
         for (const auto &fn : ns.functions)
         {
-            innerOss << CallableGenerator::generateFunctionDefinition(fn) << "\n";
+            if (fn.templateSpec.isTemplate() == templates)
+                innerOss << CallableGenerator::generateFunctionDefinition(fn, nsScope) << "\n";
         }
 
         // Recursively generate definitions for nested namespaces.
         for (const auto &nestedNS : ns.namespaces)
         {
-            innerOss << generateNamespaceDefinition(nestedNS) << "\n";
+            innerOss << generateNamespaceDefinition(nestedNS, templates, nsScope) << "\n";
         }
 
         // Indent the inner code
@@ -102,4 +118,88 @@ namespace NamespaceGenerator
         return oss.str();
     }
 
+    bool hasTemplates(const CodeGroupModels::NamespaceModel &ns)
+    {
+        for (const auto &fn : ns.functions)
+        {
+            if (fn.templateSpec.isTemplate())
+                return true;
+        }
+        for (const auto &cl : ns.classes)
+        {
+            if (ClassGenerator::hasTemplates(cl))
+                return true;
+        }
+        for (const auto &nested : ns.namespaces)
+        {
+            if (hasTemplates(nested))
+                return true;
+        }
+        return false;
+    }
+
+    std::string generateExplicitInstantiations(const CodeGroupModels::NamespaceModel &ns, const bool externDecl,
+                                               const std::string &scope)
+    {
+        if (ns.name.empty())
+            return "";
+
+        const std::string nsScope = scope + ns.name + "::";
+        std::ostringstream oss;
+        for (const auto &cl : ns.classes)
+        {
+            oss << ClassGenerator::generateExplicitInstantiations(cl, externDecl, nsScope);
+        }
+        for (const auto &fn : ns.functions)
+        {
+            oss << CallableGenerator::generateExplicitInstantiations(fn, externDecl, nsScope);
+        }
+        for (const auto &nested : ns.namespaces)
+        {
+            oss << generateExplicitInstantiations(nested, externDecl, nsScope);
+        }
+        return oss.str();
+    }
+
+    std::string generateGlobalSpecializations(const CodeGroupModels::NamespaceModel &ns, const std::string &scope)
+    {
+        const std::string nsScope = ns.name.empty() ? scope : scope + ns.name + "::";
+        std::ostringstream oss;
+        for (const auto &en : ns.enums)
+        {
+            oss << EnumGenerator::generateEnumTraits(en, nsScope);
+        }
+        for (const auto &cl : ns.classes)
+        {
+            oss << ValueGenerator::generateHashSpecialization(cl, nsScope);
+        }
+        for (const auto &nested : ns.namespaces)
+        {
+            oss << generateGlobalSpecializations(nested, nsScope);
+        }
+        return oss.str();
+    }
+
+    std::set<std::string> requiredHeaders(const CodeGroupModels::NamespaceModel &ns)
+    {
+        std::set<std::string> headers;
+        for (const auto &en : ns.enums)
+        {
+            headers.merge(EnumGenerator::requiredHeaders(en));
+        }
+        for (const auto &func : ns.functions)
+        {
+            headers.merge(CallableGenerator::requiredHeaders(func));
+        }
+        for (const auto &cl : ns.classes)
+        {
+            headers.merge(ClassGenerator::requiredHeaders(cl));
+        }
+        for (const auto &nested : ns.namespaces)
+        {
+            headers.merge(requiredHeaders(nested));
+        }
+        return headers;
+    }
+
 } // namespace NamespaceGenerator
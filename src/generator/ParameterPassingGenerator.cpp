@@ -0,0 +1,196 @@
+#include "ParameterPassingGenerator.h"
+#include "LayoutGenerator.h"
+
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ */
+namespace
+{
+    /**
+     * @brief Returns qualifiers with const removed.
+     */
+    PropertiesModels::TypeQualifier withoutConst(const PropertiesModels::TypeQualifier qualifiers)
+    {
+        using PropertiesModels::TypeQualifier;
+        return PropertiesModels::hasQualifier(qualifiers, TypeQualifier::VOLATILE) ? TypeQualifier::VOLATILE
+                                                                                  : TypeQualifier::NONE;
+    }
+
+    /**
+     * @brief Reports whether a custom type is cheap enough to copy that it stays by value.
+     *
+     * A type is cheap if its size is known to be at most two pointers, or if it names one of
+     * the given value types (e.g. a DSL enum), with or without its namespace qualification.
+     */
+    bool passedByValue(const PropertiesModels::DataType &type, const std::set<std::string> &valueTypes)
+    {
+        if (const auto layout = LayoutGenerator::typeLayout(type))
+            return layout->size <= 2 * LayoutGenerator::POINTER_SIZE;
+
+        const std::string name = type.customType.value_or("");
+        if (name.find('<') != std::string::npos)
+            return false;
+        const auto scope = name.rfind("::");
+        return valueTypes.contains(scope == std::string::npos ? name : name.substr(scope + 2));
+    }
+
+    /**
+     * @brief Collects the names of the enums declared in a namespace and its nested namespaces.
+     */
+    void collectEnums(const CodeGroupModels::NamespaceModel &ns, std::set<std::string> &names)
+    {
+        for (const auto &en : ns.enums)
+        {
+            names.insert(en.name);
+        }
+        for (const auto &nested : ns.namespaces)
+        {
+            collectEnums(nested, names);
+        }
+    }
+
+    /**
+     * @brief Reports whether a class has a data member with the given name.
+     */
+    bool initialisesMember(const ClassModels::ClassModel &cl, const std::string &name)
+    {
+        for (const auto *section : {&cl.publicMembers, &cl.privateMembers, &cl.protectedMembers})
+        {
+            for (const auto &mem : *section)
+            {
+                if (mem.name == name)
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Applies a convention to the parameters of every method in a list.
+     */
+    void applyToMethods(std::vector<CallableModels::MethodModel> &methods,
+                        const CodeGroupModels::PassingConvention convention,
+                        const std::set<std::string> &valueTypes)
+    {
+        for (auto &meth : methods)
+        {
+            meth.parameters = ParameterPassingGenerator::applyConvention(meth.parameters, convention, valueTypes);
+        }
+    }
+
+} // end anonymous namespace
+
+namespace ParameterPassingGenerator
+{
+    PropertiesModels::DataType passedType(const PropertiesModels::Parameter &param,
+                                          const CodeGroupModels::PassingConvention convention,
+                                          const std::set<std::string> &valueTypes)
+    {
+        using PropertiesModels::Types;
+        using PropertiesModels::TypeQualifier;
+
+        PropertiesModels::DataType type = param.type;
+        const auto &decl = type.typeDecl;
+
+        // Explicit declarators are a deliberate choice and are always kept.
+        if (convention == CodeGroupModels::PassingConvention::DECLARED || decl.ptrCount > 0 ||
+            decl.isLValReference || decl.isRValReference || !decl.arrayDimensions.empty())
+            return type;
+
+        // Sink parameters are moved from, which const would silently turn into a copy.
+        if (PropertiesModels::hasAnnotation(param.annotations, PropertiesModels::Annotation::SINK))
+        {
+            type.qualifiers = withoutConst(type.qualifiers);
+            return type;
+        }
+
+        if (type.type == Types::STRING && convention == CodeGroupModels::PassingConvention::STRING_VIEW)
+        {
+            // Top-level const on a by-value view only adds noise to the signature.
+            return PropertiesModels::DataType(Types::CUSTOM, "std::string_view", withoutConst(type.qualifiers));
+        }
+
+        if (type.type == Types::STRING || (type.type == Types::CUSTOM && !passedByValue(type, valueTypes)))
+        {
+            type.qualifiers = type.qualifiers | TypeQualifier::CONST;
+            type.typeDecl.isLValReference = true;
+        }
+        return type;
+    }
+
+    std::vector<PropertiesModels::Parameter> applyConvention(const std::vector<PropertiesModels::Parameter> &params,
+                                                             const CodeGroupModels::PassingConvention convention,
+                                                             const std::set<std::string> &valueTypes)
+    {
+        std::vector<PropertiesModels::Parameter> passed = params;
+        for (auto &param : passed)
+        {
+            param.type = passedType(param, convention, valueTypes);
+        }
+        return passed;
+    }
+
+    ClassModels::ClassModel applyConvention(const ClassModels::ClassModel &cl,
+                                            const CodeGroupModels::PassingConvention convention,
+                                            const std::set<std::string> &valueTypes)
+    {
+        ClassModels::ClassModel passed = cl;
+        for (auto &ctor : passed.constructors)
+        {
+            // Parameters that initialise a same-named member are moved into it, so they are sinks.
+            for (auto &param : ctor.parameters)
+            {
+                if (initialisesMember(cl, param.name))
+                    param.annotations = param.annotations | PropertiesModels::Annotation::SINK;
+            }
+            ctor.parameters = applyConvention(ctor.parameters, convention, valueTypes);
+        }
+        applyToMethods(passed.publicMethods, convention, valueTypes);
+        applyToMethods(passed.privateMethods, convention, valueTypes);
+        applyToMethods(passed.protectedMethods, convention, valueTypes);
+        return passed;
+    }
+
+    CodeGroupModels::NamespaceModel applyConvention(const CodeGroupModels::NamespaceModel &ns,
+                                                    const CodeGroupModels::PassingConvention convention,
+                                                    const std::set<std::string> &valueTypes)
+    {
+        std::set<std::string> enums = valueTypes;
+        collectEnums(ns, enums);
+
+        CodeGroupModels::NamespaceModel passed = ns;
+        passed.classes = applyConvention(ns.classes, convention, enums);
+        passed.functions = applyConvention(ns.functions, convention, enums);
+        for (auto &nested : passed.namespaces)
+        {
+            nested = applyConvention(nested, convention, enums);
+        }
+        return passed;
+    }
+
+    std::vector<CallableModels::FunctionModel> applyConvention(const std::vector<CallableModels::FunctionModel> &functions,
+                                                               const CodeGroupModels::PassingConvention convention,
+                                                               const std::set<std::string> &valueTypes)
+    {
+        std::vector<CallableModels::FunctionModel> passed = functions;
+        for (auto &func : passed)
+        {
+            func.parameters = applyConvention(func.parameters, convention, valueTypes);
+        }
+        return passed;
+    }
+
+    std::vector<ClassModels::ClassModel> applyConvention(const std::vector<ClassModels::ClassModel> &classes,
+                                                         const CodeGroupModels::PassingConvention convention,
+                                                         const std::set<std::string> &valueTypes)
+    {
+        std::vector<ClassModels::ClassModel> passed;
+        passed.reserve(classes.size());
+        for (const auto &cl : classes)
+        {
+            passed.push_back(applyConvention(cl, convention, valueTypes));
+        }
+        return passed;
+    }
+
+} // namespace ParameterPassingGenerator
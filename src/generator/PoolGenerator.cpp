@@ -0,0 +1,256 @@
+#include "PoolGenerator.h"
+#include "ClassGenerator.h"
+#include "GeneratorUtilities.h"
+
+#include <sstream>
+
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ */
+namespace
+{
+    /// Content of the support header declaring ObjectPool.
+    constexpr const char *SUPPORT_HEADER_CONTENT = R"(/**
+ * @file ObjectPool.h
+ * @brief Fixed-size block pools backing the operator new and operator delete of pooled classes.
+ *
+ * Each thread keeps its own free list of blocks, so allocating and freeing take no lock. Blocks
+ * are carved from slab pages requested from the global allocator whenever a free list runs dry,
+ * and slabs are kept for the life of the program. A block freed on another thread joins that
+ * thread's free list, and the free list of an exiting thread is shared with the next thread that
+ * runs out of blocks.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+/**
+ * @class ObjectPool
+ * @brief Pool of blocks for objects of one size and alignment, shared by every class of that shape.
+ * @tparam Size The size of the pooled objects.
+ * @tparam Align The alignment of the pooled objects.
+ */
+template <std::size_t Size, std::size_t Align>
+class ObjectPool {
+public:
+    /// Alignment of each block; a free block also holds the link to the next one.
+    static constexpr std::size_t BLOCK_ALIGN = std::max(Align, alignof(void*));
+    /// Size of each block, rounded up so that every block in a slab stays aligned.
+    static constexpr std::size_t BLOCK_SIZE = (std::max(Size, sizeof(void*)) + BLOCK_ALIGN - 1) / BLOCK_ALIGN * BLOCK_ALIGN;
+    /// Number of blocks carved from each slab of about 64 KiB.
+    static constexpr std::size_t BLOCKS_PER_SLAB = std::max<std::size_t>(64 * 1024 / BLOCK_SIZE, 1);
+
+    /**
+     * @brief Takes a block from the calling thread's free list.
+     * @return Uninitialised storage for one object.
+     * @throws std::bad_alloc If a new slab cannot be allocated.
+     */
+    static void* allocate() {
+        Block* block = freeList;
+        if (block == nullptr) [[unlikely]]
+            block = refill();
+        freeList = block->next;
+        return block;
+    }
+
+    /**
+     * @brief Returns a block to the calling thread's free list.
+     * @param ptr A block from allocate(), or nullptr.
+     */
+    static void deallocate(void* ptr) noexcept {
+        if (ptr == nullptr)
+            return;
+        if (exited) [[unlikely]] {
+            // Objects freed after the thread's cleanup go straight to the shared list.
+            share(::new (ptr) Block{nullptr});
+            return;
+        }
+        if (freeList == nullptr)
+            registerCleanup();
+        freeList = ::new (ptr) Block{freeList};
+    }
+
+private:
+    /// Link to the next free block, stored in the free block itself.
+    struct Block {
+        Block* next;
+    };
+
+    /// Shares the calling thread's free list when the thread exits.
+    struct ThreadCleanup {
+        ~ThreadCleanup() {
+            exited = true;
+            if (freeList != nullptr)
+                share(std::exchange(freeList, nullptr));
+        }
+    };
+
+    /// Ensures the calling thread's free list is shared when the thread exits.
+    static void registerCleanup() noexcept {
+        thread_local ThreadCleanup cleanup;
+        (void)cleanup;
+    }
+
+    /**
+     * @brief Adopts the blocks shared by exited threads, or carves a new slab if there are none.
+     * @return The new free list, with at least one block.
+     */
+    static Block* refill() {
+        Block* blocks = shared.load(std::memory_order_relaxed) == nullptr ? nullptr : shared.exchange(nullptr, std::memory_order_acquire);
+        if (blocks == nullptr)
+            blocks = carveSlab();
+        if (exited) [[unlikely]] {
+            // Keep nothing on a thread whose cleanup has already run.
+            if (blocks->next != nullptr)
+                share(blocks->next);
+            blocks->next = nullptr;
+            return blocks;
+        }
+        registerCleanup();
+        return blocks;
+    }
+
+    /**
+     * @brief Allocates a slab and links its blocks in address order, so consecutive objects are adjacent.
+     * @return The first block of the slab.
+     */
+    static Block* carveSlab() {
+        auto* slab = static_cast<std::byte*>(::operator new(BLOCK_SIZE * BLOCKS_PER_SLAB, std::align_val_t{BLOCK_ALIGN}));
+        Block* head = nullptr;
+        for (std::size_t i = BLOCKS_PER_SLAB; i-- > 0;)
+            head = ::new (slab + i * BLOCK_SIZE) Block{head};
+        return head;
+    }
+
+    /**
+     * @brief Pushes a list of blocks onto the shared list.
+     *
+     * Lists are only ever taken from the shared list whole, so a compare-and-swap push cannot
+     * suffer from the ABA problem.
+     */
+    static void share(Block* list) noexcept {
+        Block* tail = list;
+        while (tail->next != nullptr)
+            tail = tail->next;
+        Block* head = shared.load(std::memory_order_relaxed);
+        do {
+            tail->next = head;
+        } while (!shared.compare_exchange_weak(head, list, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    inline static thread_local constinit Block* freeList = nullptr; ///< The calling thread's free blocks.
+    inline static thread_local constinit bool exited = false;       ///< Set once the calling thread's cleanup has run.
+    inline static constinit std::atomic<Block*> shared{nullptr};    ///< Free blocks shared by exited threads.
+};
+)";
+
+} // end anonymous namespace
+
+namespace PoolGenerator
+{
+    std::string generatePoolDeclarations(const ClassModels::ClassModel &cl)
+    {
+        if (!cl.options.pooled)
+            return "";
+
+        const std::string &name = cl.name;
+        const std::string pool = "ObjectPool<sizeof(" + name + "), alignof(" + name + ")>";
+        const std::string fallbackAlign = "std::align_val_t{alignof(" + name + ")}";
+
+        std::ostringstream oss;
+        oss << "    /**\n     * @brief Allocates storage for an object from the " << name << " pool.\n"
+            << "     * @param size The size of the object; derived classes of another size use the global allocator.\n"
+            << "     * @return Uninitialised storage for the object.\n     */\n"
+            << "    static void* operator new(const std::size_t size) {\n"
+            << "        if (size != sizeof(" << name << ")) [[unlikely]]\n"
+            << "            return ::operator new(size, " << fallbackAlign << ");\n"
+            << "        return " << pool << "::allocate();\n"
+            << "    }\n\n";
+        oss << "    /**\n     * @brief Returns an object's storage to the " << name << " pool.\n"
+            << "     * @param ptr The storage of the object.\n"
+            << "     * @param size The size of the object.\n     */\n"
+            << "    static void operator delete(void* ptr, const std::size_t size) noexcept {\n"
+            << "        if (size != sizeof(" << name << ")) [[unlikely]] {\n"
+            << "            ::operator delete(ptr, size, " << fallbackAlign << ");\n"
+            << "            return;\n"
+            << "        }\n"
+            << "        " << pool << "::deallocate(ptr);\n"
+            << "    }\n\n";
+        return oss.str();
+    }
+
+    std::set<std::string> requiredHeaders(const ClassModels::ClassModel &cl)
+    {
+        if (!cl.options.pooled)
+            return {};
+        return {"<cstddef>", "<new>", std::string("\"") + SUPPORT_HEADER + "\""};
+    }
+
+    std::string generateSupportHeader()
+    {
+        return SUPPORT_HEADER_CONTENT;
+    }
+
+    bool hasBenchmark(const ClassModels::ClassModel &cl)
+    {
+        return cl.options.pooled && !cl.templateSpec.isTemplate() && ClassGenerator::isDefaultConstructible(cl);
+    }
+
+    std::string benchmarkName(const std::string &qualifiedName)
+    {
+        return GeneratorUtilities::executableName(qualifiedName, "PoolBenchmark");
+    }
+
+    std::string generateBenchmark(const std::string &qualifiedName, const std::string &header)
+    {
+        std::ostringstream oss;
+        oss << "/**\n * @file " << benchmarkName(qualifiedName) << ".cpp\n"
+            << " * @brief Compares allocating " << qualifiedName << " from its pool with the global allocator.\n */\n\n";
+        oss << "#include \"" << header << "\"\n\n";
+        oss << "#include <chrono>\n#include <cstddef>\n#include <cstdint>\n#include <iostream>\n#include <vector>\n\n";
+        oss << "namespace\n{\n"
+            << "    constexpr std::size_t BATCH = 1024;\n"
+            << "    constexpr std::size_t ROUNDS = 1000;\n\n"
+            << "    /// Checksum of the allocated addresses, so the allocations cannot be optimised away.\n"
+            << "    volatile std::uintptr_t sink = 0;\n\n"
+            << "    /**\n     * @brief Times allocating BATCH objects and freeing them again, ROUNDS times.\n"
+            << "     * @return Nanoseconds per allocation and free.\n     */\n"
+            << "    template <typename Allocate, typename Free>\n"
+            << "    double churn(Allocate allocate, Free free)\n    {\n"
+            << "        std::vector<" << qualifiedName << "*> objects(BATCH);\n"
+            << "        const auto start = std::chrono::steady_clock::now();\n"
+            << "        for (std::size_t round = 0; round < ROUNDS; ++round)\n        {\n"
+            << "            for (auto& object : objects)\n"
+            << "                object = allocate();\n"
+            << "            for (auto* object : objects)\n            {\n"
+            << "                sink = sink ^ reinterpret_cast<std::uintptr_t>(object);\n"
+            << "                free(object);\n"
+            << "            }\n        }\n"
+            << "        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;\n"
+            << "        return elapsed.count() / (BATCH * ROUNDS);\n"
+            << "    }\n"
+            << "} // namespace\n\n";
+        oss << "int main()\n{\n"
+            << "    // The class's operators use the pool; the global scope operators bypass it.\n"
+            << "    const auto pooledNew = [] { return new " << qualifiedName << "(); };\n"
+            << "    const auto pooledDelete = [](" << qualifiedName << "* object) { delete object; };\n"
+            << "    const auto globalNew = [] { return ::new " << qualifiedName << "(); };\n"
+            << "    const auto globalDelete = [](" << qualifiedName << "* object) { ::delete object; };\n\n"
+            << "    // Warm up both allocators so that neither page faults nor slab carving are timed.\n"
+            << "    churn(pooledNew, pooledDelete);\n"
+            << "    churn(globalNew, globalDelete);\n\n"
+            << "    const double pooled = churn(pooledNew, pooledDelete);\n"
+            << "    const double global = churn(globalNew, globalDelete);\n"
+            << "    std::cout << \"" << qualifiedName << ": \" << sizeof(" << qualifiedName << ") << \" bytes per object\\n\"\n"
+            << "              << \"pooled: \" << pooled << \" ns/object\\n\"\n"
+            << "              << \"global: \" << global << \" ns/object\\n\";\n"
+            << "    return 0;\n}\n";
+        return oss.str();
+    }
+
+} // namespace PoolGenerator
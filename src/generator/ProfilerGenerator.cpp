@@ -0,0 +1,526 @@
+#include "ProfilerGenerator.h"
+#include "TracingGenerator.h"
+
+#include <sstream>
+
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ */
+namespace
+{
+    /// Content of include/profiling/Profiler.h.
+    constexpr const char *HEADER_CONTENT = R"PROFILER(/**
+ * @file Profiler.h
+ * @brief Built-in profiler collecting scopes, counters and histograms into a Chrome trace.
+ *
+ * Completed scopes are recorded into a fixed-size ring buffer owned by the recording thread, so
+ * recording takes no lock and never blocks; when a buffer is full, new scopes are dropped and
+ * counted. While a Session is open, a background thread drains the buffers and streams the scopes
+ * to a JSON file that chrome://tracing and https://ui.perfetto.dev open directly. Counters are
+ * sampled into the trace whenever they change, and histogram summaries are written when the
+ * session closes.
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace profiling
+{
+    /**
+     * @brief Records a completed scope in the calling thread's ring buffer.
+     *
+     * The signature matches tracing::TraceHandler, so `tracing::setTraceHandler(&profiling::recordScope)`
+     * routes every TRACE_SCOPE to the profiler. Scopes recorded without an open session stay buffered
+     * until the next session drains them.
+     *
+     * @param name The scope name; must outlive the session, e.g. a string literal.
+     * @param startNs The start of the scope, in nanoseconds since the std::chrono::steady_clock epoch.
+     * @param durationNs The duration of the scope in nanoseconds.
+     */
+    void recordScope(const char* name, std::int64_t startNs, std::int64_t durationNs) noexcept;
+
+    /**
+     * @class Counter
+     * @brief A named running total, sampled into the trace whenever it changes.
+     */
+    class alignas(64) Counter {
+    public:
+        /**
+         * @brief Adds to the counter.
+         * @param delta The amount to add, which may be negative.
+         */
+        void add(const std::int64_t delta = 1) noexcept {
+            value_.fetch_add(delta, std::memory_order_relaxed);
+        }
+
+        /// Returns the current total.
+        std::int64_t value() const noexcept {
+            return value_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<std::int64_t> value_{0}; ///< The running total.
+    };
+
+    /**
+     * @class Histogram
+     * @brief A named distribution of values in power-of-two buckets, summarised when the session closes.
+     */
+    class Histogram {
+    public:
+        /// Bucket 0 holds zero; bucket b holds values in [2^(b-1), 2^b).
+        static constexpr std::size_t BUCKETS = 65;
+
+        /**
+         * @brief Records a value, e.g. a latency in nanoseconds or a batch size.
+         * @param value The value to record.
+         */
+        void record(std::uint64_t value) noexcept;
+
+        /// Returns the number of values recorded.
+        std::uint64_t count() const noexcept { return count_.load(std::memory_order_relaxed); }
+
+        /// Returns the sum of the values recorded.
+        std::uint64_t sum() const noexcept { return sum_.load(std::memory_order_relaxed); }
+
+        /// Returns the largest value recorded.
+        std::uint64_t max() const noexcept { return max_.load(std::memory_order_relaxed); }
+
+        /**
+         * @brief Estimates a quantile of the values recorded.
+         * @param q The quantile, from 0 to 1, e.g. 0.99.
+         * @return The upper bound of the bucket holding the quantile, at most twice the true value.
+         */
+        std::uint64_t quantile(double q) const noexcept;
+
+    private:
+        std::array<std::atomic<std::uint64_t>, BUCKETS> buckets_{}; ///< Number of values in each bucket.
+        std::atomic<std::uint64_t> count_{0};                       ///< Number of values recorded.
+        std::atomic<std::uint64_t> sum_{0};                         ///< Sum of the values recorded.
+        std::atomic<std::uint64_t> max_{0};                         ///< Largest value recorded.
+    };
+
+    /**
+     * @brief Returns the counter with the given name, creating it on first use.
+     *
+     * The lookup takes a lock, so keep the reference, e.g. `static auto& requests = profiling::counter("requests");`.
+     *
+     * @param name The counter name.
+     * @return The counter, valid for the rest of the program.
+     */
+    Counter& counter(const std::string& name);
+
+    /**
+     * @brief Returns the histogram with the given name, creating it on first use.
+     *
+     * The lookup takes a lock, so keep the reference as for counter().
+     *
+     * @param name The histogram name.
+     * @return The histogram, valid for the rest of the program.
+     */
+    Histogram& histogram(const std::string& name);
+
+    /**
+     * @class Session
+     * @brief Streams recorded scopes and counter samples to a Chrome trace file while it is open.
+     *
+     * Only one session may be open at a time. The file is written in the JSON array format, so it
+     * stays readable even if the program ends without closing the session.
+     */
+    class Session {
+    public:
+        /**
+         * @brief Opens the trace file and starts draining the ring buffers in the background.
+         * @param path The trace file to write.
+         * @param flushInterval How often the ring buffers are drained; each holds 16384 scopes per thread.
+         * @throws std::runtime_error If another session is open or the file cannot be opened.
+         */
+        explicit Session(const std::string& path, std::chrono::milliseconds flushInterval = std::chrono::milliseconds(100));
+
+        /// Drains the ring buffers a last time, writes the histogram summaries and closes the file.
+        ~Session();
+
+        Session(const Session&) = delete;
+        Session& operator=(const Session&) = delete;
+
+    private:
+        class Writer;
+        std::unique_ptr<Writer> writer_; ///< The trace file and its background flusher.
+    };
+} // namespace profiling
+)PROFILER";
+
+    /// Content of src/profiling/Profiler.cpp.
+    constexpr const char *SOURCE_CONTENT = R"PROFILER(#include "profiling/Profiler.h"
+
+#include <algorithm>
+#include <bit>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace profiling
+{
+    namespace
+    {
+        /// A completed scope, as passed to recordScope().
+        struct ScopeEvent {
+            const char* name;
+            std::int64_t startNs;
+            std::int64_t durationNs;
+        };
+
+        /**
+         * @class RingBuffer
+         * @brief Single-producer single-consumer ring of scopes: its thread pushes, the session drains.
+         */
+        class RingBuffer {
+        public:
+            /// Number of scopes held between two drains; a power of two.
+            static constexpr std::uint64_t CAPACITY = 1 << 14;
+
+            explicit RingBuffer(const std::uint32_t threadId) noexcept : threadId_(threadId) {}
+
+            /**
+             * @brief Appends a scope, or drops it if the buffer is full.
+             * @return False if the scope was dropped.
+             */
+            bool push(const ScopeEvent& event) noexcept {
+                const std::uint64_t head = head_.load(std::memory_order_relaxed);
+                if (head - cachedTail_ == CAPACITY) {
+                    // Only look at the consumer's position when the buffer seems full.
+                    cachedTail_ = tail_.load(std::memory_order_acquire);
+                    if (head - cachedTail_ == CAPACITY)
+                        return false;
+                }
+                events_[head & (CAPACITY - 1)] = event;
+                head_.store(head + 1, std::memory_order_release);
+                return true;
+            }
+
+            /// Passes every buffered scope to a visitor and frees its slot.
+            void drain(const std::function<void(const ScopeEvent&)>& visit) {
+                const std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+                const std::uint64_t head = head_.load(std::memory_order_acquire);
+                for (std::uint64_t i = tail; i != head; ++i)
+                    visit(events_[i & (CAPACITY - 1)]);
+                tail_.store(head, std::memory_order_release);
+            }
+
+            /// Returns true if nothing is waiting to be drained.
+            bool empty() const noexcept {
+                return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_relaxed);
+            }
+
+            /// Returns the trace thread id of the owning thread.
+            std::uint32_t threadId() const noexcept { return threadId_; }
+
+            std::atomic<bool> retired{false}; ///< Set once the owning thread has exited.
+
+        private:
+            alignas(64) std::atomic<std::uint64_t> head_{0}; ///< Next slot to write; written by the owning thread.
+            std::uint64_t cachedTail_ = 0;                    ///< The owning thread's last view of tail_.
+            alignas(64) std::atomic<std::uint64_t> tail_{0}; ///< Next slot to read; written by the session.
+            const std::uint32_t threadId_;                    ///< Trace thread id of the owning thread.
+            std::array<ScopeEvent, CAPACITY> events_;         ///< The slots.
+        };
+
+        /// Everything shared between recording threads and the session.
+        struct Registry {
+            std::mutex mutex;                                            ///< Guards everything but the atomics.
+            std::vector<std::shared_ptr<RingBuffer>> buffers;            ///< Buffers of every recording thread.
+            std::map<std::string, Counter, std::less<>> counters;        ///< Counters by name.
+            std::map<std::string, Histogram, std::less<>> histograms;    ///< Histograms by name.
+            std::uint32_t nextThreadId = 1;                              ///< Trace thread id of the next thread.
+            std::atomic<std::uint64_t> dropped{0};                       ///< Scopes dropped by full buffers.
+            std::atomic<bool> sessionOpen{false};                        ///< Set while a session is open.
+        };
+
+        /// Returns the registry, which is never destroyed so that threads outliving main() can still record.
+        Registry& registry() {
+            static Registry* const instance = new Registry;
+            return *instance;
+        }
+
+        thread_local constinit RingBuffer* currentBuffer = nullptr; ///< The calling thread's buffer.
+        thread_local constinit bool threadExited = false;          ///< Set once the calling thread's buffer is retired.
+
+        /// Retires the calling thread's buffer when the thread exits, once the session has drained it.
+        struct ThreadBuffer {
+            std::shared_ptr<RingBuffer> buffer;
+
+            ~ThreadBuffer() {
+                threadExited = true;
+                currentBuffer = nullptr;
+                if (buffer != nullptr)
+                    buffer->retired.store(true, std::memory_order_release);
+            }
+        };
+
+        /// Creates and registers the calling thread's buffer.
+        RingBuffer* registerThread() {
+            thread_local ThreadBuffer owner;
+            Registry& reg = registry();
+            std::lock_guard lock(reg.mutex);
+            owner.buffer = std::make_shared<RingBuffer>(reg.nextThreadId++);
+            reg.buffers.push_back(owner.buffer);
+            return owner.buffer.get();
+        }
+
+        /// Returns the current std::chrono::steady_clock time in nanoseconds, the clock TRACE_SCOPE uses.
+        std::int64_t nowNs() noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        /// Writes a string as a JSON string literal.
+        void writeString(std::ostream& out, const std::string_view value) {
+            out << '"';
+            for (const char c : value) {
+                if (c == '"' || c == '\\')
+                    out << '\\' << c;
+                else if (static_cast<unsigned char>(c) < 0x20)
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+                else
+                    out << c;
+            }
+            out << '"';
+        }
+
+        /// Writes nanoseconds as the fractional microseconds Chrome traces use.
+        void writeMicros(std::ostream& out, std::int64_t ns) {
+            if (ns < 0) {
+                out << '-';
+                ns = -ns;
+            }
+            out << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000;
+        }
+    } // namespace
+
+    void recordScope(const char* name, const std::int64_t startNs, const std::int64_t durationNs) noexcept {
+        RingBuffer* buffer = currentBuffer;
+        if (buffer == nullptr) [[unlikely]] {
+            if (threadExited)
+                return;
+            try {
+                buffer = currentBuffer = registerThread();
+            } catch (...) {
+                return;
+            }
+        }
+        if (!buffer->push({name, startNs, durationNs})) [[unlikely]]
+            registry().dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Histogram::record(const std::uint64_t value) noexcept {
+        buckets_[std::bit_width(value)].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+        std::uint64_t largest = max_.load(std::memory_order_relaxed);
+        while (value > largest && !max_.compare_exchange_weak(largest, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::uint64_t Histogram::quantile(const double q) const noexcept {
+        const std::uint64_t total = count();
+        if (total == 0)
+            return 0;
+        // Rank of the quantile among the values, counting from 1.
+        const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::clamp(q, 0.0, 1.0) * static_cast<double>(total) + 0.5));
+        std::uint64_t seen = 0;
+        for (std::size_t bucket = 0; bucket < BUCKETS; ++bucket) {
+            seen += buckets_[bucket].load(std::memory_order_relaxed);
+            if (seen >= rank) {
+                const std::uint64_t upper = bucket == 0 ? 0 : bucket == BUCKETS - 1 ? UINT64_MAX : (std::uint64_t{1} << bucket) - 1;
+                return std::min(upper, max());
+            }
+        }
+        return max();
+    }
+
+    Counter& counter(const std::string& name) {
+        Registry& reg = registry();
+        std::lock_guard lock(reg.mutex);
+        return reg.counters.try_emplace(name).first->second;
+    }
+
+    Histogram& histogram(const std::string& name) {
+        Registry& reg = registry();
+        std::lock_guard lock(reg.mutex);
+        return reg.histograms.try_emplace(name).first->second;
+    }
+
+    /**
+     * @class Session::Writer
+     * @brief Owns the trace file and the thread that drains the ring buffers into it.
+     */
+    class Session::Writer {
+    public:
+        Writer(const std::string& path, const std::chrono::milliseconds flushInterval) : out_(path) {
+            if (!out_)
+                throw std::runtime_error("Cannot open trace file: " + path);
+            out_ << "[";
+            flusher_ = std::jthread([this, flushInterval](const std::stop_token stop) {
+                std::mutex mutex;
+                std::condition_variable_any wake;
+                std::unique_lock lock(mutex);
+                while (!wake.wait_for(lock, stop, flushInterval, [] { return false; }) && !stop.stop_requested())
+                    flush();
+            });
+        }
+
+        /// Stops the flusher, then drains the ring buffers a last time and writes the histogram summaries.
+        ~Writer() {
+            flusher_.request_stop();
+            flusher_.join();
+            flush();
+            writeSummaries();
+            out_ << "\n]\n";
+        }
+
+    private:
+        /// Starts a new event in the trace array.
+        std::ostream& beginEvent() {
+            out_ << (first_ ? "\n" : ",\n");
+            first_ = false;
+            return out_;
+        }
+
+        /// Drains every ring buffer into the trace, then samples the counters that changed.
+        void flush() {
+            Registry& reg = registry();
+            std::vector<std::shared_ptr<RingBuffer>> buffers;
+            {
+                std::lock_guard lock(reg.mutex);
+                buffers = reg.buffers;
+            }
+
+            for (const auto& buffer : buffers) {
+                buffer->drain([this, tid = buffer->threadId()](const ScopeEvent& event) {
+                    beginEvent() << "{\"name\":";
+                    writeString(out_, event.name);
+                    out_ << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << tid << ",\"ts\":";
+                    writeMicros(out_, event.startNs);
+                    out_ << ",\"dur\":";
+                    writeMicros(out_, event.durationNs);
+                    out_ << '}';
+                });
+            }
+
+            const std::int64_t now = nowNs();
+            std::lock_guard lock(reg.mutex);
+            // Buffers of exited threads are released once nothing is left in them.
+            std::erase_if(reg.buffers, [](const std::shared_ptr<RingBuffer>& buffer) {
+                return buffer->retired.load(std::memory_order_acquire) && buffer->empty();
+            });
+            for (const auto& [name, counter] : reg.counters) {
+                const std::int64_t value = counter.value();
+                const auto [sample, added] = samples_.try_emplace(name, value);
+                if (!added && sample->second == value)
+                    continue;
+                sample->second = value;
+                beginEvent() << "{\"name\":";
+                writeString(out_, name);
+                out_ << ",\"ph\":\"C\",\"pid\":1,\"ts\":";
+                writeMicros(out_, now);
+                out_ << ",\"args\":{\"value\":" << value << "}}";
+            }
+            out_.flush();
+        }
+
+        /// Writes each histogram, and the number of dropped scopes, as a global instant event.
+        void writeSummaries() {
+            Registry& reg = registry();
+            const std::int64_t now = nowNs();
+            std::lock_guard lock(reg.mutex);
+            for (const auto& [name, histogram] : reg.histograms) {
+                const std::uint64_t count = histogram.count();
+                beginEvent() << "{\"name\":";
+                writeString(out_, name);
+                out_ << ",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":";
+                writeMicros(out_, now);
+                out_ << ",\"args\":{\"count\":" << count << ",\"mean\":" << (count == 0 ? 0 : histogram.sum() / count)
+                     << ",\"p50\":" << histogram.quantile(0.5) << ",\"p90\":" << histogram.quantile(0.9)
+                     << ",\"p99\":" << histogram.quantile(0.99) << ",\"max\":" << histogram.max() << "}}";
+            }
+            if (const std::uint64_t dropped = reg.dropped.load(std::memory_order_relaxed); dropped > 0) {
+                beginEvent() << "{\"name\":\"profiling.dropped_scopes\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":";
+                writeMicros(out_, now);
+                out_ << ",\"args\":{\"count\":" << dropped << "}}";
+            }
+        }
+
+        std::ofstream out_;                            ///< The trace file.
+        bool first_ = true;                            ///< True until the first event is written.
+        std::map<std::string, std::int64_t> samples_;  ///< Last value written for each counter.
+        std::jthread flusher_;                         ///< Drains the ring buffers every flush interval.
+    };
+
+    Session::Session(const std::string& path, const std::chrono::milliseconds flushInterval) {
+        if (registry().sessionOpen.exchange(true))
+            throw std::runtime_error("A profiling session is already open");
+        try {
+            writer_ = std::make_unique<Writer>(path, flushInterval);
+        } catch (...) {
+            registry().sessionOpen.store(false);
+            throw;
+        }
+    }
+
+    Session::~Session() {
+        writer_.reset();
+        registry().sessionOpen.store(false);
+    }
+} // namespace profiling
+)PROFILER";
+
+} // end anonymous namespace
+
+namespace ProfilerGenerator
+{
+    std::string traceFileName(const std::string &projectName)
+    {
+        return projectName + ".trace.json";
+    }
+
+    std::string generateHeader()
+    {
+        return HEADER_CONTENT;
+    }
+
+    std::string generateSource()
+    {
+        return SOURCE_CONTENT;
+    }
+
+    std::string generateMainSetup(const std::string &projectName, const bool tracing)
+    {
+        std::ostringstream oss;
+        oss << "    // Streams scopes, counters and histograms to " << traceFileName(projectName) << " until main returns.\n"
+            << "    const profiling::Session profilingSession(\"" << traceFileName(projectName) << "\");\n";
+        if (tracing)
+        {
+            // Trace scopes only exist when the project's tracing macro is defined.
+            const std::string option = TracingGenerator::optionName(projectName);
+            oss << "#if defined(" << option << ")\n"
+                << "    tracing::setTraceHandler(&profiling::recordScope);\n"
+                << "#endif\n";
+        }
+        return oss.str();
+    }
+
+} // namespace ProfilerGenerator
@@ -68,4 +68,14 @@ namespace PropertiesGenerator
         return concatenated + " ";
     }
 
+    std::set<std::string> requiredHeaders(const std::vector<PropertiesModels::Parameter> &params)
+    {
+        for (const auto &param : params)
+        {
+            if (param.type.type == PropertiesModels::Types::CUSTOM && param.type.customType == "std::string_view")
+                return {"<string_view>"};
+        }
+        return {};
+    }
+
 } // namespace PropertiesGenerator
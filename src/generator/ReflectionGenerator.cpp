@@ -0,0 +1,170 @@
+#include "ReflectionGenerator.h"
+#include "GeneratorUtilities.h"
+
+#include <sstream>
+#include <vector>
+
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ */
+namespace
+{
+    /// Content of the support header declaring FieldDescriptor.
+    constexpr const char *SUPPORT_HEADER_CONTENT = R"(/**
+ * @file Reflection.h
+ * @brief Compile-time descriptors of the data members of reflected classes.
+ *
+ * Every class generated with `reflect = true` has a `static constexpr auto fields()` returning a
+ * std::tuple of FieldDescriptor, one per data member in declaration order. The helpers below
+ * iterate that tuple with a fold expression, so visiting the members of an object compiles down
+ * to direct member accesses with no lookup at run time.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace reflection
+{
+    /// Access of a data member.
+    enum class Access {
+        PUBLIC,
+        PROTECTED,
+        PRIVATE
+    };
+
+    /**
+     * @struct FieldDescriptor
+     * @brief Describes one data member of a reflected class.
+     * @tparam Class The reflected class.
+     * @tparam T The type of the member.
+     */
+    template <typename Class, typename T>
+    struct FieldDescriptor {
+        using class_type = Class; ///< The reflected class.
+        using value_type = T;     ///< The type of the member.
+
+        std::string_view name; ///< The member name.
+        std::string_view type; ///< The member type as written in the class.
+        T Class::*pointer;     ///< Pointer to the member, usable whatever its access.
+        Access access;         ///< The member's access.
+
+        /// Returns the member of an object.
+        constexpr T& get(Class& object) const noexcept { return object.*pointer; }
+
+        /// Returns the member of a const object.
+        constexpr const T& get(const Class& object) const noexcept { return object.*pointer; }
+    };
+
+    template <typename Class, typename T>
+    FieldDescriptor(std::string_view, std::string_view, T Class::*, Access) -> FieldDescriptor<Class, T>;
+
+    /// Number of data members of a reflected class.
+    template <typename Class>
+    inline constexpr std::size_t fieldCount = std::tuple_size_v<decltype(Class::fields())>;
+
+    /**
+     * @brief Calls a visitor with the descriptor and value of every data member of an object.
+     * @param object The object, const or not.
+     * @param visit Called as visit(descriptor, member) for each member in declaration order.
+     */
+    template <typename Object, typename Visitor>
+    constexpr void forEachField(Object& object, Visitor&& visit) {
+        std::apply([&](const auto&... field) { (visit(field, object.*field.pointer), ...); },
+                   std::remove_const_t<Object>::fields());
+    }
+
+    /**
+     * @brief Calls a visitor with the descriptor of every data member of a class.
+     * @tparam Class The reflected class.
+     * @param visit Called as visit(descriptor) for each member in declaration order.
+     */
+    template <typename Class, typename Visitor>
+    constexpr void forEachField(Visitor&& visit) {
+        std::apply([&](const auto&... field) { (visit(field), ...); }, Class::fields());
+    }
+
+    /**
+     * @brief Finds a data member by name.
+     * @tparam Class The reflected class.
+     * @param name The member name.
+     * @return The member's index in fields(), or fieldCount<Class> if there is none.
+     */
+    template <typename Class>
+    constexpr std::size_t fieldIndex(const std::string_view name) {
+        std::size_t index = 0;
+        std::size_t found = fieldCount<Class>;
+        forEachField<Class>([&](const auto& field) {
+            if (found == fieldCount<Class> && field.name == name)
+                found = index;
+            ++index;
+        });
+        return found;
+    }
+} // namespace reflection
+)";
+
+    /**
+     * @brief Appends the descriptors of one access section.
+     *
+     * @param className The name of the class the members belong to.
+     * @param members The members of the section, in emission order.
+     * @param access The enumerator naming the section's access.
+     * @param descriptors The descriptors collected so far.
+     */
+    void addDescriptors(const std::string &className, const std::vector<PropertiesModels::Parameter> &members,
+                        const std::string &access, std::vector<std::string> &descriptors)
+    {
+        for (const auto &mem : members)
+        {
+            descriptors.push_back("reflection::FieldDescriptor{\"" + mem.name + "\", \"" +
+                                  GeneratorUtilities::dataTypeToString(mem.type) + "\", &" + className + "::" + mem.name +
+                                  ", reflection::Access::" + access + "}");
+        }
+    }
+
+} // end anonymous namespace
+
+namespace ReflectionGenerator
+{
+    std::string generateReflectionDeclarations(const ClassModels::ClassModel &cl)
+    {
+        if (!cl.options.reflect)
+            return "";
+
+        // Sections are listed in the order the class declares them.
+        std::vector<std::string> descriptors;
+        addDescriptors(cl.name, cl.publicMembers, "PUBLIC", descriptors);
+        addDescriptors(cl.name, cl.privateMembers, "PRIVATE", descriptors);
+        addDescriptors(cl.name, cl.protectedMembers, "PROTECTED", descriptors);
+
+        std::ostringstream oss;
+        oss << "    /**\n     * @brief Describes the data members of " << cl.name << " in declaration order.\n"
+            << "     * @return A tuple with one reflection::FieldDescriptor per member.\n     */\n"
+            << "    static constexpr auto fields() {\n"
+            << "        return std::make_tuple(";
+        for (size_t i = 0; i < descriptors.size(); ++i)
+        {
+            oss << "\n            " << descriptors[i] << (i + 1 < descriptors.size() ? "," : "");
+        }
+        oss << ");\n    }\n\n";
+        return oss.str();
+    }
+
+    std::set<std::string> requiredHeaders(const ClassModels::ClassModel &cl)
+    {
+        if (!cl.options.reflect)
+            return {};
+        return {"<tuple>", std::string("\"") + SUPPORT_HEADER + "\""};
+    }
+
+    std::string generateSupportHeader()
+    {
+        return SUPPORT_HEADER_CONTENT;
+    }
+
+} // namespace ReflectionGenerator
@@ -0,0 +1,605 @@
+#include "SerializationGenerator.h"
+#include "AllocatorGenerator.h"
+#include "ClassGenerator.h"
+#include "GeneratorUtilities.h"
+#include "LayoutGenerator.h"
+
+#include <algorithm>
+#include <format>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ */
+namespace
+{
+    /**
+     * @brief How a data member is written to the stream.
+     */
+    enum class Encoding
+    {
+        RUN,    ///< Builtin arithmetic value or array, copied with neighbouring ones in one block.
+        VALUE,  ///< Written on its own through BinaryWriter::write().
+        SKIPPED ///< Pointer, whose address is meaningless once read back.
+    };
+
+    /**
+     * @brief Returns how a data member is written to the stream.
+     */
+    Encoding encoding(const PropertiesModels::Parameter &mem)
+    {
+        using PropertiesModels::Types;
+        if (mem.type.typeDecl.ptrCount > 0)
+            return Encoding::SKIPPED;
+        switch (mem.type.type)
+        {
+        case Types::STRING:
+        case Types::CUSTOM:
+        case Types::AUTO:
+        case Types::VOID:
+            return Encoding::VALUE;
+        default:
+            return Encoding::RUN;
+        }
+    }
+
+    /**
+     * @brief Generates the statements writing or reading every member, one per line.
+     *
+     * Runs of RUN members, adjacent once pointers are left out, become a single
+     * writeFields()/readFields() call; other members get a write()/read() call each. The
+     * serialising body ends with a note on every pointer left out.
+     *
+     * @param members The data members in emission order.
+     * @param object The BinaryWriter or BinaryReader variable.
+     * @param reading True for the deserialising body.
+     * @return The indented statements.
+     */
+    std::string memberStatements(const std::vector<PropertiesModels::Parameter> &members, const std::string &object,
+                                 const bool reading)
+    {
+        const std::string fields = reading ? "readFields" : "writeFields";
+        const std::string single = reading ? "read" : "write";
+
+        std::ostringstream oss;
+        std::string run;
+        std::string skipped;
+        auto flushRun = [&]()
+        {
+            if (!run.empty())
+                oss << "    " << object << "." << fields << "(" << run << ");\n";
+            run.clear();
+        };
+        for (const auto &mem : members)
+        {
+            switch (encoding(mem))
+            {
+            case Encoding::RUN:
+                run += (run.empty() ? "" : ", ") + mem.name;
+                break;
+            case Encoding::VALUE:
+                flushRun();
+                oss << "    " << object << "." << single << "(" << mem.name << ");\n";
+                break;
+            case Encoding::SKIPPED:
+                skipped += "    // " + mem.name + " is a pointer and is not serialized.\n";
+                break;
+            }
+        }
+        flushRun();
+        if (!reading)
+            oss << skipped;
+        return oss.str();
+    }
+
+    /**
+     * @brief Generates an expression of a member's type holding a value distinct from its neighbours'.
+     *
+     * Arithmetic members (and the first element of arithmetic arrays) take their one-based position,
+     * strings take the member name and custom types are value-initialised.
+     *
+     * @param mem The data member, after applyAllocator().
+     * @param position The one-based position of the member in the stream.
+     * @return The expression, e.g. `std::type_identity_t<float[4]>{static_cast<float>(2)}`.
+     */
+    std::string sampleValue(const PropertiesModels::Parameter &mem, const size_t position)
+    {
+        PropertiesModels::DataType element = mem.type;
+        element.typeDecl.arrayDimensions.clear();
+
+        std::string initialiser;
+        if (encoding(mem) == Encoding::RUN)
+            initialiser = std::format("static_cast<{}>({})", GeneratorUtilities::dataTypeToString(element), position);
+        else if (mem.type.type == PropertiesModels::Types::STRING)
+            initialiser = "\"" + mem.name + "\"";
+        return "std::type_identity_t<" + GeneratorUtilities::dataTypeToString(mem.type) + ">{" + initialiser + "}";
+    }
+
+    /**
+     * @brief Returns the class with its members in emission order and their emitted types.
+     */
+    ClassModels::ClassModel emitted(const ClassModels::ClassModel &cl)
+    {
+        return AllocatorGenerator::applyAllocator(LayoutGenerator::orderMembers(cl));
+    }
+
+    /// Content of the support header, emitted verbatim.
+    constexpr const char *SUPPORT_HEADER_CONTENT = R"(/**
+ * @file BinarySerialization.h
+ * @brief Binary writer and reader used by the generated serialize() and deserialize() members.
+ *
+ * Values are stored in native byte order without padding. Trivially copyable values are copied
+ * with std::memcpy, strings and containers are prefixed with their element count as a
+ * std::uint64_t, and classes with serialize() and deserialize() members are nested. Every
+ * serialised class starts with its layout version, so data written by another layout is rejected
+ * rather than misread.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class BinaryWriter;
+class BinaryReader;
+
+/// Classes with serialize() and deserialize() members.
+template <typename T>
+concept BinarySerializable = requires(const T &value, T &target, BinaryWriter &writer, BinaryReader &reader) {
+    value.serialize(writer);
+    target.deserialize(reader);
+};
+
+/// Values copied byte for byte. Pointers are excluded, as addresses do not survive a round trip.
+template <typename T>
+concept BinaryTrivial = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && !BinarySerializable<T>;
+
+/// Pairs, such as the elements of associative containers.
+template <typename T>
+concept BinaryPair = requires(T &pair) {
+    pair.first;
+    pair.second;
+};
+
+/// The type an element is read into before it is inserted into its container.
+template <typename T>
+struct BinaryStored
+{
+    using type = T;
+};
+
+/// Map keys are const in the container but assigned while reading.
+template <typename Key, typename Value>
+struct BinaryStored<std::pair<const Key, Value>>
+{
+    using type = std::pair<Key, Value>;
+};
+
+/**
+ * @class BinaryWriter
+ * @brief Appends values to a growing byte buffer.
+ */
+class BinaryWriter {
+public:
+    /**
+     * @brief Reserves room for at least capacity bytes.
+     * @param capacity The number of bytes to reserve.
+     */
+    void reserve(const std::size_t capacity) { buffer_.reserve(capacity); }
+
+    /**
+     * @brief Discards the written bytes, keeping the capacity for reuse.
+     */
+    void clear() noexcept { buffer_.clear(); }
+
+    /**
+     * @brief Returns the number of bytes written.
+     */
+    std::size_t size() const noexcept { return buffer_.size(); }
+
+    /**
+     * @brief Returns the written bytes, valid until the next write.
+     */
+    std::span<const std::byte> bytes() const noexcept { return buffer_; }
+
+    /**
+     * @brief Extends the buffer by size bytes.
+     * @param size The number of bytes to add.
+     * @return A pointer to the first new byte, valid until the next write.
+     */
+    std::byte *allocate(const std::size_t size)
+    {
+        const std::size_t offset = buffer_.size();
+        buffer_.resize(offset + size);
+        return buffer_.data() + offset;
+    }
+
+    /**
+     * @brief Writes trivially copyable fields back to back with a single allocation.
+     * @param fields The fields to write.
+     */
+    template <BinaryTrivial... Fields>
+    void writeFields(const Fields &...fields)
+    {
+        std::byte *out = allocate((sizeof(Fields) + ... + 0));
+        ((std::memcpy(out, std::addressof(fields), sizeof(Fields)), out += sizeof(Fields)), ...);
+    }
+
+    /**
+     * @brief Writes a value: serialisable classes nest, trivially copyable values are copied and
+     *        ranges are prefixed with their element count.
+     * @param value The value to write.
+     */
+    template <typename T>
+    void write(const T &value)
+    {
+        if constexpr (BinarySerializable<T>)
+            value.serialize(*this);
+        else if constexpr (BinaryTrivial<T>)
+            writeFields(value);
+        else if constexpr (BinaryPair<T>)
+        {
+            write(value.first);
+            write(value.second);
+        }
+        else if constexpr (std::ranges::sized_range<const T>)
+        {
+            using Element = std::ranges::range_value_t<const T>;
+            const auto count = static_cast<std::uint64_t>(std::ranges::size(value));
+            writeFields(count);
+            if constexpr (std::ranges::contiguous_range<const T> && BinaryTrivial<Element>)
+            {
+                // Contiguous trivially copyable elements are copied in one block.
+                if (count > 0)
+                    std::memcpy(allocate(count * sizeof(Element)), std::ranges::data(value), count * sizeof(Element));
+            }
+            else
+            {
+                for (const auto &element : value)
+                    write(element);
+            }
+        }
+        else
+            static_assert(sizeof(T) == 0, "BinaryWriter cannot write this type");
+    }
+
+private:
+    std::vector<std::byte> buffer_; ///< The written bytes.
+};
+
+/**
+ * @class BinaryReader
+ * @brief Reads values back from bytes written by BinaryWriter, checking every read against the input size.
+ */
+class BinaryReader {
+public:
+    /**
+     * @brief Constructs a reader over bytes that must outlive it.
+     * @param bytes The bytes to read.
+     */
+    explicit BinaryReader(const std::span<const std::byte> bytes) noexcept : bytes_(bytes) {}
+
+    /**
+     * @brief Returns the number of bytes not read yet.
+     */
+    std::size_t remaining() const noexcept { return bytes_.size() - offset_; }
+
+    /**
+     * @brief Consumes size bytes.
+     * @param size The number of bytes to consume.
+     * @return A pointer to the first consumed byte.
+     * @throws std::runtime_error if fewer than size bytes remain.
+     */
+    const std::byte *consume(const std::size_t size)
+    {
+        if (size > remaining())
+            throw std::runtime_error("BinaryReader: unexpected end of input");
+        const std::byte *in = bytes_.data() + offset_;
+        offset_ += size;
+        return in;
+    }
+
+    /**
+     * @brief Reads trivially copyable fields written back to back by BinaryWriter::writeFields().
+     * @param fields The fields to assign.
+     * @throws std::runtime_error if the input ends early.
+     */
+    template <BinaryTrivial... Fields>
+    void readFields(Fields &...fields)
+    {
+        const std::byte *in = consume((sizeof(Fields) + ... + 0));
+        ((std::memcpy(std::addressof(fields), in, sizeof(Fields)), in += sizeof(Fields)), ...);
+    }
+
+    /**
+     * @brief Reads a layout version and checks it against the expected one.
+     * @param expected The layout version of the class being read.
+     * @param type The class name, for the error message.
+     * @throws std::runtime_error if the data was written with another layout.
+     */
+    void readVersion(const std::uint32_t expected, const char *type)
+    {
+        std::uint32_t version = 0;
+        readFields(version);
+        if (version != expected)
+            throw std::runtime_error(std::string("BinaryReader: ") + type + " data has layout version " +
+                                     std::to_string(version) + ", expected " + std::to_string(expected));
+    }
+
+    /**
+     * @brief Reads a value written by BinaryWriter::write().
+     * @param value The value to assign.
+     * @throws std::runtime_error if the input ends early or holds an impossible element count.
+     */
+    template <typename T>
+    void read(T &value)
+    {
+        if constexpr (BinarySerializable<T>)
+            value.deserialize(*this);
+        else if constexpr (BinaryTrivial<T>)
+            readFields(value);
+        else if constexpr (BinaryPair<T>)
+        {
+            read(value.first);
+            read(value.second);
+        }
+        else if constexpr (std::ranges::sized_range<T>)
+        {
+            using Element = std::ranges::range_value_t<T>;
+            using Stored = typename BinaryStored<Element>::type;
+            std::uint64_t count = 0;
+            readFields(count);
+            // Every element takes at least one byte, which bounds the count before anything is allocated.
+            if (count > remaining())
+                throw std::runtime_error("BinaryReader: element count exceeds the input");
+            const auto size = static_cast<std::size_t>(count);
+            if constexpr (std::ranges::contiguous_range<T> && BinaryTrivial<Element> &&
+                          requires { value.resize(size); })
+            {
+                if (size > remaining() / sizeof(Element))
+                    throw std::runtime_error("BinaryReader: element count exceeds the input");
+                value.resize(size);
+                if (size > 0)
+                    std::memcpy(std::ranges::data(value), consume(size * sizeof(Element)), size * sizeof(Element));
+            }
+            else if constexpr (requires(Stored &&stored) { value.clear(); value.insert(value.end(), std::move(stored)); })
+            {
+                value.clear();
+                if constexpr (requires { value.reserve(size); })
+                    value.reserve(size);
+                for (std::size_t i = 0; i < size; ++i)
+                {
+                    Stored element{};
+                    read(element);
+                    value.insert(value.end(), std::move(element));
+                }
+            }
+            else
+            {
+                // Fixed-size ranges such as arrays keep their extent.
+                if (size != std::ranges::size(value))
+                    throw std::runtime_error("BinaryReader: element count does not match the fixed size");
+                for (auto &element : value)
+                    read(element);
+            }
+        }
+        else
+            static_assert(sizeof(T) == 0, "BinaryReader cannot read this type");
+    }
+
+private:
+    std::span<const std::byte> bytes_; ///< The bytes being read.
+    std::size_t offset_ = 0;           ///< The number of bytes already read.
+};
+)";
+
+} // end anonymous namespace
+
+namespace SerializationGenerator
+{
+    bool isSerializable(const ClassModels::ClassModel &cl)
+    {
+        return cl.options.serialize == ClassModels::SerializationFormat::BINARY;
+    }
+
+    std::uint32_t layoutVersion(const ClassModels::ClassModel &cl)
+    {
+        std::uint32_t hash = 2166136261u;
+        for (const auto &mem : GeneratorUtilities::allMembers(cl))
+        {
+            if (encoding(mem) == Encoding::SKIPPED)
+                continue;
+            for (const char c : GeneratorUtilities::dataTypeToString(mem.type) + " " + mem.name + ";")
+            {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 16777619u;
+            }
+        }
+        return hash;
+    }
+
+    std::string generateSerializationDeclarations(const ClassModels::ClassModel &cl)
+    {
+        if (!isSerializable(cl))
+            return "";
+
+        std::ostringstream oss;
+        oss << "    /// Layout version written ahead of the members; changes with the name, type or order of any serialized member.\n"
+            << "    static constexpr std::uint32_t serializationVersion = 0x" << std::hex << std::setw(8) << std::setfill('0')
+            << layoutVersion(cl) << std::dec << ";\n\n";
+        oss << "    /**\n     * @brief Appends the members to a binary stream.\n"
+            << "     * @param writer The writer receiving the bytes.\n     */\n"
+            << "    void serialize(BinaryWriter& writer) const;\n\n";
+        oss << "    /**\n     * @brief Restores the members from a binary stream written by serialize().\n"
+            << "     * @param reader The reader supplying the bytes.\n"
+            << "     * @throws std::runtime_error if the stream ends early or has another layout version.\n     */\n"
+            << "    void deserialize(BinaryReader& reader);\n\n";
+        return oss.str();
+    }
+
+    std::string generateSerializationDefinitions(const ClassModels::ClassModel &cl, const std::string &className,
+                                                 const bool inlineDef, const std::string &prefix)
+    {
+        if (!isSerializable(cl))
+            return "";
+
+        const auto members = GeneratorUtilities::allMembers(cl);
+        const std::string head = prefix + (inlineDef ? "inline " : "") + "void " + className + "::";
+
+        std::ostringstream oss;
+        oss << head << "serialize(BinaryWriter& writer) const\n{\n"
+            << "    writer.write(serializationVersion);\n"
+            << memberStatements(members, "writer", false) << "}\n\n";
+        oss << head << "deserialize(BinaryReader& reader)\n{\n"
+            << "    reader.readVersion(serializationVersion, \"" << cl.name << "\");\n"
+            << memberStatements(members, "reader", true) << "}\n\n";
+        return oss.str();
+    }
+
+    std::set<std::string> requiredHeaders(const ClassModels::ClassModel &cl)
+    {
+        if (!isSerializable(cl))
+            return {};
+        return {"<cstdint>", "\"" + std::string(SUPPORT_HEADER) + "\""};
+    }
+
+    std::string generateSupportHeader()
+    {
+        return SUPPORT_HEADER_CONTENT;
+    }
+
+    bool hasRoundTripTest(const ClassModels::ClassModel &cl)
+    {
+        return isSerializable(cl) && !cl.templateSpec.isTemplate() && ClassGenerator::isDefaultConstructible(cl);
+    }
+
+    std::string testName(const std::string &qualifiedName)
+    {
+        return GeneratorUtilities::executableName(qualifiedName, "SerializationTest");
+    }
+
+    std::string benchmarkName(const std::string &qualifiedName)
+    {
+        return GeneratorUtilities::executableName(qualifiedName, "SerializationBenchmark");
+    }
+
+    std::string generateRoundTripTest(const ClassModels::ClassModel &cl, const std::string &qualifiedName,
+                                      const std::string &header)
+    {
+        const auto members = GeneratorUtilities::allMembers(emitted(cl));
+        // The helpers are declared in the class's namespace, where its member types resolve unqualified.
+        const size_t scopeEnd = qualifiedName.rfind("::");
+        const std::string scope = scopeEnd == std::string::npos ? "" : qualifiedName.substr(0, scopeEnd);
+        const std::string helperScope = scope.empty() ? "" : scope + "::";
+
+        std::ostringstream oss;
+        oss << "/**\n * @file " << testName(qualifiedName) << ".cpp\n"
+            << " * @brief Round-trip test of the generated " << qualifiedName << " binary serialization.\n */\n\n";
+        oss << "#include \"" << header << "\"\n\n";
+        oss << "#include <algorithm>\n#include <cstddef>\n#include <iostream>\n#include <span>\n"
+            << "#include <stdexcept>\n#include <string>\n#include <type_traits>\n#include <vector>\n\n";
+        if (!scope.empty())
+            oss << "namespace " << scope << "\n{\n";
+        oss << "namespace\n{\n";
+        oss << "    /**\n     * @brief Builds the stream " << qualifiedName
+            << "::serialize() must produce, writing one member at a time.\n     */\n"
+            << "    std::vector<std::byte> expectedStream()\n    {\n"
+            << "        BinaryWriter writer;\n"
+            << "        writer.write(" << qualifiedName << "::serializationVersion);\n";
+        size_t position = 0;
+        for (const auto &mem : members)
+        {
+            if (encoding(mem) == Encoding::SKIPPED)
+                continue;
+            oss << "        writer.write(" << sampleValue(mem, ++position) << "); // " << mem.name << "\n";
+        }
+        oss << "        const auto bytes = writer.bytes();\n"
+            << "        return {bytes.begin(), bytes.end()};\n    }\n\n";
+        oss << "    /**\n     * @brief Reports whether deserializing the bytes throws std::runtime_error.\n     */\n"
+            << "    bool rejects(const std::span<const std::byte> bytes)\n    {\n"
+            << "        try\n        {\n"
+            << "            " << qualifiedName << " object{};\n"
+            << "            BinaryReader reader(bytes);\n"
+            << "            object.deserialize(reader);\n"
+            << "        }\n"
+            << "        catch (const std::runtime_error &)\n        {\n            return true;\n        }\n"
+            << "        return false;\n    }\n";
+        oss << "} // namespace\n";
+        if (!scope.empty())
+            oss << "} // namespace " << scope << "\n";
+        oss << "\n";
+        oss << "int main()\n{\n"
+            << "    int failures = 0;\n"
+            << "    auto check = [&failures](const bool passed, const char *what)\n    {\n"
+            << "        if (!passed)\n        {\n"
+            << "            std::cerr << \"FAILED: \" << what << '\\n';\n"
+            << "            ++failures;\n        }\n    };\n\n"
+            << "    const std::vector<std::byte> expected = " << helperScope << "expectedStream();\n\n"
+            << "    " << qualifiedName << " object{};\n"
+            << "    BinaryReader reader(expected);\n"
+            << "    object.deserialize(reader);\n"
+            << "    check(reader.remaining() == 0, \"deserialize() consumes the whole stream\");\n\n"
+            << "    BinaryWriter writer;\n"
+            << "    object.serialize(writer);\n"
+            << "    check(std::ranges::equal(writer.bytes(), expected), \"serialize() reproduces the stream\");\n\n"
+            << "    check(" << helperScope << "rejects(std::span(expected).first(expected.size() - 1)), \"a truncated stream is rejected\");\n\n"
+            << "    std::vector<std::byte> otherVersion = expected;\n"
+            << "    otherVersion[0] ^= std::byte{0xFF};\n"
+            << "    check(" << helperScope << "rejects(otherVersion), \"another layout version is rejected\");\n\n"
+            << "    if (failures == 0)\n"
+            << "        std::cout << \"" << qualifiedName << " serialization round trip passed\\n\";\n"
+            << "    return failures == 0 ? 0 : 1;\n}\n";
+        return oss.str();
+    }
+
+    std::string generateBenchmark(const std::string &qualifiedName, const std::string &header)
+    {
+        std::ostringstream oss;
+        oss << "/**\n * @file " << benchmarkName(qualifiedName) << ".cpp\n"
+            << " * @brief Measures the throughput of the generated " << qualifiedName << " binary serialization.\n */\n\n";
+        oss << "#include \"" << header << "\"\n\n";
+        oss << "#include <chrono>\n#include <cstddef>\n#include <iostream>\n\n";
+        oss << "int main()\n{\n"
+            << "    constexpr std::size_t ITERATIONS = 100000;\n"
+            << "    using Clock = std::chrono::steady_clock;\n\n"
+            << "    " << qualifiedName << " object{};\n"
+            << "    BinaryWriter writer;\n"
+            << "    object.serialize(writer);\n"
+            << "    const std::size_t bytesPerObject = writer.size();\n\n"
+            << "    // Fill the buffer once so that neither its growth nor its page faults are timed.\n"
+            << "    for (std::size_t i = 1; i < ITERATIONS; ++i)\n"
+            << "        object.serialize(writer);\n"
+            << "    writer.clear();\n\n"
+            << "    // Serialize a batch of objects into one buffer, then read them all back.\n"
+            << "    const auto serializeStart = Clock::now();\n"
+            << "    for (std::size_t i = 0; i < ITERATIONS; ++i)\n"
+            << "        object.serialize(writer);\n"
+            << "    const std::chrono::duration<double, std::nano> serializeTime = Clock::now() - serializeStart;\n\n"
+            << "    BinaryReader reader(writer.bytes());\n"
+            << "    const auto deserializeStart = Clock::now();\n"
+            << "    for (std::size_t i = 0; i < ITERATIONS; ++i)\n"
+            << "        object.deserialize(reader);\n"
+            << "    const std::chrono::duration<double, std::nano> deserializeTime = Clock::now() - deserializeStart;\n\n"
+            << "    // Bytes per nanosecond are gigabytes per second.\n"
+            << "    const double bytes = static_cast<double>(writer.size());\n"
+            << "    std::cout << \"" << qualifiedName << ": \" << bytesPerObject << \" bytes per object\\n\"\n"
+            << "              << \"serialize:   \" << serializeTime.count() / ITERATIONS << \" ns/object, \"\n"
+            << "              << bytes / serializeTime.count() << \" GB/s\\n\"\n"
+            << "              << \"deserialize: \" << deserializeTime.count() / ITERATIONS << \" ns/object, \"\n"
+            << "              << bytes / deserializeTime.count() << \" GB/s\\n\";\n"
+            << "    return reader.remaining() == 0 ? 0 : 1;\n}\n";
+        return oss.str();
+    }
+
+} // namespace SerializationGenerator
@@ -0,0 +1,166 @@
+#include "SoaGenerator.h"
+#include "GeneratorUtilities.h"
+
+#include <format>
+#include <functional>
+#include <sstream>
+
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ */
+namespace
+{
+    /**
+     * @brief Returns the name of the column storing a member.
+     */
+    std::string columnName(const PropertiesModels::Parameter &mem)
+    {
+        return mem.name + "_";
+    }
+
+    /**
+     * @brief Returns the const-qualified form of a member's type.
+     *
+     * Pointers are qualified on the right, so that the pointer rather than its target is const.
+     */
+    std::string constType(const PropertiesModels::Parameter &mem)
+    {
+        const std::string type = GeneratorUtilities::dataTypeToString(mem.type);
+        return mem.type.typeDecl.ptrCount > 0 ? type + " const" : "const " + type;
+    }
+
+    /**
+     * @brief Generates a proxy struct holding a reference to each member of one element.
+     *
+     * @param members The public members of the class.
+     * @param isConst True for the read-only proxy.
+     * @param oss The output stream to append the struct to.
+     */
+    void proxyDeclaration(const std::vector<PropertiesModels::Parameter> &members, const bool isConst,
+                          std::ostringstream &oss)
+    {
+        oss << "    /**\n     * @brief " << (isConst ? "Read-only proxy" : "Proxy")
+            << " referring to the members of one element.\n     */\n";
+        oss << "    struct " << (isConst ? "ConstReference" : "Reference") << " {\n";
+        for (const auto &mem : members)
+        {
+            std::string type = isConst ? constType(mem) : GeneratorUtilities::dataTypeToString(mem.type);
+            oss << std::format("        {}& {}; ///< \n", type, mem.name);
+        }
+        oss << "    };\n\n";
+    }
+
+    /**
+     * @brief Generates a statement applied to every column, one line each.
+     *
+     * @param members The public members of the class.
+     * @param statement Returns the statement for a column, given its name and the member's name.
+     * @return The indented statements.
+     */
+    std::string forEachColumn(const std::vector<PropertiesModels::Parameter> &members,
+                              const std::function<std::string(const std::string &, const std::string &)> &statement)
+    {
+        std::string lines;
+        for (const auto &mem : members)
+        {
+            lines += "        " + statement(columnName(mem), mem.name) + "\n";
+        }
+        return lines;
+    }
+
+    /**
+     * @brief Joins the element at `index` of every column into a proxy initialiser.
+     */
+    std::string proxyInitialiser(const std::vector<PropertiesModels::Parameter> &members)
+    {
+        std::string list;
+        for (const auto &mem : members)
+        {
+            list += (list.empty() ? "" : ", ") + columnName(mem) + "[index]";
+        }
+        return "{" + list + "}";
+    }
+
+} // end anonymous namespace
+
+namespace SoaGenerator
+{
+    std::string soaName(const ClassModels::ClassModel &cl)
+    {
+        return cl.name + "SoA";
+    }
+
+    std::string generateSoaDeclaration(const ClassModels::ClassModel &cl)
+    {
+        if (!cl.options.soa || cl.publicMembers.empty())
+            return "";
+
+        const auto &members = cl.publicMembers;
+        const std::string name = soaName(cl);
+        const std::string valueType = cl.name + GeneratorUtilities::templateArgumentList(cl.templateSpec);
+        const std::string first = columnName(members.front());
+
+        std::ostringstream oss;
+        oss << "/**\n * @class " << name << "\n * @brief Struct-of-arrays container of " << cl.name
+            << ", storing each public member contiguously.\n"
+            << GeneratorUtilities::templateParameterDoxygen(cl.templateSpec) << " */\n";
+        oss << GeneratorUtilities::templateHeader(cl.templateSpec) << "class " << name << " {\npublic:\n";
+
+        proxyDeclaration(members, false, oss);
+        proxyDeclaration(members, true, oss);
+
+        oss << "    /**\n     * @brief Returns the number of elements.\n     */\n"
+            << "    std::size_t size() const noexcept { return " << first << ".size(); }\n\n";
+        oss << "    /**\n     * @brief Reports whether the container has no elements.\n     */\n"
+            << "    bool empty() const noexcept { return " << first << ".empty(); }\n\n";
+        oss << "    /**\n     * @brief Reserves storage for at least capacity elements in every column.\n"
+            << "     * @param capacity The number of elements to reserve.\n     */\n"
+            << "    void reserve(const std::size_t capacity) {\n"
+            << forEachColumn(members, [](const std::string &column, const std::string &)
+                             { return column + ".reserve(capacity);"; }) << "    }\n\n";
+        oss << "    /**\n     * @brief Removes all elements.\n     */\n"
+            << "    void clear() noexcept {\n" << forEachColumn(members, [](const std::string &column, const std::string &)
+                                                                    { return column + ".clear();"; }) << "    }\n\n";
+        oss << "    /**\n     * @brief Appends the public members of a " << cl.name << ".\n"
+            << "     * @param value The object to append.\n"
+            << "     * @note If copying a member throws, the columns are left with different sizes.\n     */\n"
+            << "    void push_back(const " << valueType << "& value) {\n"
+            << forEachColumn(members, [](const std::string &column, const std::string &member)
+                             { return column + ".push_back(value." + member + ");"; }) << "    }\n\n";
+        oss << "    /**\n     * @brief Removes an element, keeping the order of the others.\n"
+            << "     * @param index The position of the element to remove.\n     */\n"
+            << "    void erase(const std::size_t index) {\n"
+            << forEachColumn(members, [](const std::string &column, const std::string &)
+                             { return column + ".erase(" + column + ".begin() + static_cast<std::ptrdiff_t>(index));"; }) << "    }\n\n";
+        oss << "    /**\n     * @brief Returns a proxy referring to the members of an element.\n"
+            << "     * @param index The position of the element.\n     */\n"
+            << "    Reference operator[](const std::size_t index) noexcept { return " << proxyInitialiser(members) << "; }\n\n"
+            << "    /**\n     * @brief Returns a read-only proxy referring to the members of an element.\n"
+            << "     * @param index The position of the element.\n     */\n"
+            << "    ConstReference operator[](const std::size_t index) const noexcept { return " << proxyInitialiser(members) << "; }\n\n";
+
+        for (const auto &mem : members)
+        {
+            oss << "    /**\n     * @brief Returns the contiguous " << mem.name << " member of every element.\n     */\n";
+            oss << std::format("    std::span<{}> {}() noexcept {{ return {}; }}\n", GeneratorUtilities::dataTypeToString(mem.type),
+                               mem.name, columnName(mem));
+            oss << std::format("    std::span<{}> {}() const noexcept {{ return {}; }}\n\n", constType(mem), mem.name, columnName(mem));
+        }
+
+        oss << "private:\n";
+        for (const auto &mem : members)
+        {
+            oss << std::format("    std::vector<{}> {}; ///< \n", GeneratorUtilities::dataTypeToString(mem.type), columnName(mem));
+        }
+        oss << "};\n";
+        return oss.str();
+    }
+
+    std::set<std::string> requiredHeaders(const ClassModels::ClassModel &cl)
+    {
+        if (!cl.options.soa || cl.publicMembers.empty())
+            return {};
+        return {"<cstddef>", "<span>", "<vector>"};
+    }
+
+} // namespace SoaGenerator
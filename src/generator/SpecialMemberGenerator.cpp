@@ -1,6 +1,9 @@
 #include "SpecialMemberGenerator.h"
+#include "AllocatorGenerator.h"
+#include "ErrorGenerator.h"
 #include "PropertiesGenerator.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <sstream>
 
@@ -89,12 +92,171 @@ namespace
         oss << "     */\n";
     }
 
+    /**
+     * @brief Resolves the exception specification of a constructor.
+     *
+     * An explicit `noexcept` property wins. Otherwise default and move constructors infer it
+     * from the member types, and all other constructors are left without one.
+     *
+     * @param ctor The constructor model.
+     * @param members All data members of the class.
+     * @return The specification with a leading space, or an empty string.
+     */
+    std::string constructorNoexcept(const ClassModels::Constructor &ctor,
+                                    const std::vector<PropertiesModels::Parameter> &members)
+    {
+        if (ctor.isNoexcept)
+            return *ctor.isNoexcept ? " noexcept" : "";
+        if (ctor.type == ClassModels::ConstructorType::DEFAULT)
+            return SpecialMemberGenerator::generateNoexceptSpecifier(members, "is_nothrow_default_constructible");
+        if (ctor.type == ClassModels::ConstructorType::MOVE)
+            return SpecialMemberGenerator::generateNoexceptSpecifier(members, "is_nothrow_move_constructible");
+        return "";
+    }
+
+    /**
+     * @brief Generates the placeholder statement ending an unimplemented special member.
+     *
+     * Throwing from an unconditionally noexcept function would terminate anyway (and GCC warns
+     * about it), so those stubs terminate explicitly, as do all stubs of projects built without
+     * exceptions.
+     *
+     * @param noexceptSpec The function's exception specification.
+     * @param exceptionFree True if the project reports errors through std::expected.
+     * @return The indented statement followed by a newline.
+     */
+    std::string notImplementedStatement(const std::string &noexceptSpec, const bool exceptionFree)
+    {
+        if (noexceptSpec == " noexcept" || exceptionFree)
+            return "    std::terminate(); // Not implemented\n";
+        return "    throw std::runtime_error(\"Not implemented\");\n";
+    }
+
+    /**
+     * @brief Finds the parameter with the given name.
+     *
+     * @return The parameter, or nullptr if there is none.
+     */
+    const PropertiesModels::Parameter *findParameter(const std::vector<PropertiesModels::Parameter> &params,
+                                                     const std::string &name)
+    {
+        auto it = std::find_if(params.begin(), params.end(),
+                               [&name](const PropertiesModels::Parameter &param)
+                               { return param.name == name; });
+        return it != params.end() ? &*it : nullptr;
+    }
+
+    /**
+     * @brief Returns the trailing allocator parameter of an allocator-extended custom constructor.
+     *
+     * Constructors without parameters are not extended, as they would clash with the
+     * allocator-extended default constructor.
+     *
+     * @param ctor The constructor model.
+     * @param allocatorExtended True if the class is allocator-aware.
+     * @param defaultArgument True to default the allocator, as in the declaration.
+     * @return The parameter with a leading comma, or an empty string.
+     */
+    std::string allocatorParameter(const ClassModels::Constructor &ctor, const bool allocatorExtended,
+                                   const bool defaultArgument)
+    {
+        if (!allocatorExtended || ctor.type != ClassModels::ConstructorType::CUSTOM || ctor.parameters.empty())
+            return "";
+        return defaultArgument ? ", const allocator_type& alloc = {}" : ", const allocator_type& alloc";
+    }
+
+    /**
+     * @brief Reports whether a constructor parameter is moved into its member.
+     *
+     * Only non-const by-value strings and custom types own resources worth moving; builtins,
+     * pointers and references are copied.
+     */
+    bool isMovedFrom(const PropertiesModels::Parameter &param)
+    {
+        const auto &type = param.type;
+        const auto &decl = type.typeDecl;
+        if (decl.ptrCount > 0 || decl.isLValReference || decl.isRValReference || !decl.arrayDimensions.empty() ||
+            PropertiesModels::hasQualifier(type.qualifiers, PropertiesModels::TypeQualifier::CONST))
+            return false;
+        return type.type == PropertiesModels::Types::STRING || type.type == PropertiesModels::Types::CUSTOM;
+    }
+
+    /**
+     * @brief Returns the argument passing a parameter on to the constructor it was declared for.
+     *
+     * Parameters the constructor moves from, and rvalue references, are passed with std::move.
+     */
+    std::string forwardedArgument(const PropertiesModels::Parameter &param)
+    {
+        if (isMovedFrom(param) || param.type.typeDecl.isRValReference)
+            return "std::move(" + param.name + ")";
+        return param.name;
+    }
+
 } // end anonymous namespace
 
 namespace SpecialMemberGenerator
 {
-    std::string generateConstructorDeclaration(const std::string &className, const ClassModels::Constructor &ctor)
+    std::string generateNoexceptSpecifier(const std::vector<PropertiesModels::Parameter> &members, const std::string &trait)
+    {
+        // Builtin types, std::string, pointers and references never throw when default constructed or moved.
+        std::vector<std::string> customTypes;
+        for (const auto &mem : members)
+        {
+            const auto &decl = mem.type.typeDecl;
+            if (mem.type.type != PropertiesModels::Types::CUSTOM || !mem.type.customType ||
+                decl.ptrCount > 0 || decl.isLValReference || decl.isRValReference)
+                continue;
+            if (std::find(customTypes.begin(), customTypes.end(), *mem.type.customType) == customTypes.end())
+                customTypes.push_back(*mem.type.customType);
+        }
+
+        if (customTypes.empty())
+            return " noexcept";
+
+        std::string condition;
+        for (const auto &type : customTypes)
+        {
+            if (!condition.empty())
+                condition += " && ";
+            condition += "std::" + trait + "_v<" + type + ">";
+        }
+        return " noexcept(" + condition + ")";
+    }
+
+    bool movesParameters(const ClassModels::Constructor &ctor, const std::vector<PropertiesModels::Parameter> &members)
+    {
+        if (ctor.type != ClassModels::ConstructorType::CUSTOM)
+            return false;
+        return std::any_of(members.begin(), members.end(), [&ctor](const PropertiesModels::Parameter &mem)
+                           {
+                               const auto *param = findParameter(ctor.parameters, mem.name);
+                               return param && isMovedFrom(*param);
+                           });
+    }
+
+    bool isMemberwise(const std::vector<PropertiesModels::Parameter> &members)
     {
+        // Raw pointers may own what they point to, and reference members cannot be reassigned.
+        return std::none_of(members.begin(), members.end(), [](const PropertiesModels::Parameter &mem)
+                            {
+                                const auto &decl = mem.type.typeDecl;
+                                return decl.ptrCount > 0 || decl.isLValReference || decl.isRValReference;
+                            });
+    }
+
+    std::string generateConstructorDeclaration(const std::string &className, const ClassModels::Constructor &ctor,
+                                               const std::vector<PropertiesModels::Parameter> &members,
+                                               const bool defaulted, const bool allocatorExtended)
+    {
+        const std::string noexceptSpec = constructorNoexcept(ctor, members);
+
+        // Defaulted copy and move constructors need neither documentation nor a parameter name.
+        if (defaulted && ctor.type == ClassModels::ConstructorType::COPY)
+            return "    " + className + "(const " + className + "&)" + noexceptSpec + " = default;\n\n";
+        if (defaulted && ctor.type == ClassModels::ConstructorType::MOVE)
+            return "    " + className + "(" + className + "&&)" + noexceptSpec + " = default;\n\n";
+
         // Create an output string stream to build the constructor declaration.
         std::ostringstream oss;
 
@@ -108,22 +270,23 @@ namespace SpecialMemberGenerator
         if (ctor.type == ClassModels::ConstructorType::CUSTOM)
         {
             // For custom constructors, generate the parameter list and close the declaration.
-            oss << PropertiesGenerator::generateParameterList(ctor.parameters) << ");\n";
+            oss << PropertiesGenerator::generateParameterList(ctor.parameters)
+                << allocatorParameter(ctor, allocatorExtended, true) << ")" << noexceptSpec << ";\n";
         }
         else if (ctor.type == ClassModels::ConstructorType::COPY)
         {
             // For copy constructors, use a const reference to another instance.
-            oss << "const " << className << "& other);\n";
+            oss << "const " << className << "& other)" << noexceptSpec << ";\n";
         }
         else if (ctor.type == ClassModels::ConstructorType::MOVE)
         {
-            // For move constructors, use an rvalue reference and mark the constructor as noexcept.
-            oss << className << "&& other) noexcept;\n";
+            // For move constructors, use an rvalue reference; noexcept lets containers move on reallocation.
+            oss << className << "&& other)" << noexceptSpec << ";\n";
         }
         else if (ctor.type == ClassModels::ConstructorType::DEFAULT)
         {
             // For default constructors, close the declaration with a default specifier.
-            oss << ") = default;\n";
+            oss << ")" << noexceptSpec << " = default;\n";
         }
         else
         {
@@ -139,7 +302,9 @@ namespace SpecialMemberGenerator
     std::string generateConstructorDefinition(const std::string &className, const ClassModels::Constructor &ctor,
                                               const std::vector<PropertiesModels::Parameter> publicMembers,
                                               const std::vector<PropertiesModels::Parameter> privateMembers,
-                                              const std::vector<PropertiesModels::Parameter> protectedMembers)
+                                              const std::vector<PropertiesModels::Parameter> protectedMembers,
+                                              const bool inlineDef, const bool allocatorExtended,
+                                              const bool exceptionFree)
     {
         // For DEFAULT constructor, no out-of-line definition is needed.
         if (ctor.type == ClassModels::ConstructorType::DEFAULT)
@@ -147,29 +312,40 @@ namespace SpecialMemberGenerator
             return ""; // or a comment string if you prefer to generate something
         }
 
+        std::vector<PropertiesModels::Parameter> members = publicMembers;
+        members.insert(members.end(), privateMembers.begin(), privateMembers.end());
+        members.insert(members.end(), protectedMembers.begin(), protectedMembers.end());
+        const std::string noexceptSpec = constructorNoexcept(ctor, members);
+
         std::ostringstream oss;
-        oss << className << "::" << className << "(";
+        // Header-only definitions must be inline to avoid ODR violations.
+        if (inlineDef)
+            oss << "inline ";
+        // A class template is qualified with its arguments (Buffer<T>::), but its constructor is named without them.
+        oss << className << "::" << className.substr(0, className.find('<')) << "(";
 
         if (ctor.type == ClassModels::ConstructorType::CUSTOM)
         {
-            oss << PropertiesGenerator::generateParameterList(ctor.parameters) << ")";
+            oss << PropertiesGenerator::generateParameterList(ctor.parameters)
+                << allocatorParameter(ctor, allocatorExtended, false) << ")" << noexceptSpec;
         }
         else if (ctor.type == ClassModels::ConstructorType::COPY)
         {
-            oss << "const " << className << "& other)";
+            oss << "const " << className << "& other)" << noexceptSpec;
         }
         else if (ctor.type == ClassModels::ConstructorType::MOVE)
         {
-            oss << className << "&& other) noexcept";
+            oss << className << "&& other)" << noexceptSpec;
         }
         else
         {
             throw std::runtime_error("Unrecognised constructor type!");
         }
 
-        // Begin the initializer list.
+        // Begin the initializer list. Custom constructors initialise members from same-named parameters.
         std::ostringstream initList;
         bool firstInit = true;
+        size_t consumedParams = 0;
         std::vector<std::vector<PropertiesModels::Parameter>> memberScopes = {publicMembers, privateMembers, protectedMembers};
         for (const auto &scope : memberScopes)
         {
@@ -179,16 +355,35 @@ namespace SpecialMemberGenerator
                     initList << ", ";
                 else
                     firstInit = false;
-                initList << p.name << "()";
+
+                const PropertiesModels::Parameter *source = nullptr;
+                if (ctor.type == ClassModels::ConstructorType::CUSTOM)
+                    source = findParameter(ctor.parameters, p.name);
+                std::string argument;
+                if (source)
+                    argument = isMovedFrom(*source) ? "std::move(" + p.name + ")" : p.name;
+                if (!allocatorParameter(ctor, allocatorExtended, false).empty())
+                    initList << AllocatorGenerator::memberInitialiser(p, argument);
+                else
+                    initList << p.name << "(" << argument << ")";
+                consumedParams += source ? 1 : 0;
             }
         }
 
         if (!firstInit)
             oss << " : " << initList.str();
 
-        // Append an empty body for the constructor definition.
+        // A custom constructor whose parameters all went into members is complete.
+        if (ctor.type == ClassModels::ConstructorType::CUSTOM && !ctor.parameters.empty() &&
+            consumedParams == ctor.parameters.size())
+        {
+            oss << "\n{\n}\n";
+            return oss.str();
+        }
+
+        // Append a placeholder body for the constructor definition.
         oss << "\n{\n    // TODO: Implement " + className + " construtor logic.\n";
-        oss << "    throw std::runtime_error(\"Not implemented\");\n}\n";
+        oss << notImplementedStatement(noexceptSpec, exceptionFree) << "}\n";
 
         return oss.str();
     }
@@ -210,34 +405,50 @@ namespace SpecialMemberGenerator
         return "";
     }
 
-    std::string generateMoveAssignmentDeclaration(const std::string &className)
+    std::string generateMoveAssignmentDeclaration(const std::string &className,
+                                                  const std::vector<PropertiesModels::Parameter> &members,
+                                                  const bool defaulted)
     {
+        if (defaulted)
+            return "    " + className + "& operator=(" + className + "&&)" +
+                   generateNoexceptSpecifier(members, "is_nothrow_move_assignable") + " = default;\n";
+
         std::ostringstream oss;
         // Generate the docstring
         generateCopyAndMoveAssingmentDoxygen(className, oss, false);
         // Build move assignment operator declaration.
         // This creates a declaration of the form:
         // MyClass& operator=(MyClass&& other) noexcept;
-        oss << "    " << className << "& operator=(" << className << "&& other) noexcept;\n";
+        oss << "    " << className << "& operator=(" << className << "&& other)"
+            << generateNoexceptSpecifier(members, "is_nothrow_move_assignable") << ";\n";
         return oss.str();
     }
 
-    std::string generateMoveAssignmentDefinition(const std::string &className)
+    std::string generateMoveAssignmentDefinition(const std::string &className, const bool inlineDef,
+                                                 const std::vector<PropertiesModels::Parameter> &members,
+                                                 const bool exceptionFree)
     {
+        const std::string noexceptSpec = generateNoexceptSpecifier(members, "is_nothrow_move_assignable");
         std::ostringstream oss;
+        // Header-only definitions must be inline to avoid ODR violations.
+        if (inlineDef)
+            oss << "inline ";
         // Start constructing the move assignment operator definition.
         // The generated signature will be:
         // MyClass& MyClass::operator=(MyClass&& other) noexcept {
-        oss << className << "& " << className << "::operator=(" << className << "&& other) noexcept {\n";
+        oss << className << "& " << className << "::operator=(" << className << "&& other)" << noexceptSpec << " {\n";
         // Insert a placeholder body that indicates the method is not yet implemented.
         oss << "    // TODO: Implement " + className + " move assignment logic.\n";
-        oss << "    throw std::runtime_error(\"Not implemented\");\n";
+        oss << notImplementedStatement(noexceptSpec, exceptionFree);
         oss << "}\n";
         return oss.str();
     }
 
-    std::string generateCopyAssignmentDeclaration(const std::string &className)
+    std::string generateCopyAssignmentDeclaration(const std::string &className, const bool defaulted)
     {
+        if (defaulted)
+            return "    " + className + "& operator=(const " + className + "&) = default;\n";
+
         std::ostringstream oss;
         // Generate the docstring
         generateCopyAndMoveAssingmentDoxygen(className, oss, false);
@@ -248,16 +459,62 @@ namespace SpecialMemberGenerator
         return oss.str();
     }
 
-    std::string generateCopyAssignmentDefinition(const std::string &className)
+    std::string generateCopyAssignmentDefinition(const std::string &className, const bool inlineDef,
+                                                 const bool exceptionFree)
     {
         std::ostringstream oss;
+        // Header-only definitions must be inline to avoid ODR violations.
+        if (inlineDef)
+            oss << "inline ";
         // Start constructing the copy assignment operator definition.
         // The generated signature will be:
         // MyClass& MyClass::operator=(const MyClass& other) {
         oss << className << "& " << className << "::operator=(const " << className << "& other) {\n";
         // Insert a placeholder body that indicates the method is not yet implemented.
         oss << "    // TODO: Implement " + className + " copy assignment logic.\n";
-        oss << "    throw std::runtime_error(\"Not implemented\");\n";
+        oss << notImplementedStatement("", exceptionFree);
+        oss << "}\n";
+        return oss.str();
+    }
+
+    std::string generateFactoryDeclaration(const std::string &className, const ClassModels::Constructor &ctor)
+    {
+        if (ctor.type != ClassModels::ConstructorType::CUSTOM)
+            return "";
+
+        std::ostringstream oss;
+        oss << "    /**\n     * @brief Constructs a " << className << ", reporting invalid arguments without exceptions.\n";
+        for (const auto &param : ctor.parameters)
+        {
+            oss << "     * @param " << param.name << " \n";
+        }
+        oss << "     * @return The object, or the error that prevented its construction.\n     */\n";
+        oss << "    static " << ErrorGenerator::expectedType(className) << " create("
+            << PropertiesGenerator::generateParameterList(ctor.parameters) << ");\n\n";
+        return oss.str();
+    }
+
+    std::string generateFactoryDefinition(const std::string &className, const ClassModels::Constructor &ctor,
+                                          const bool inlineDef)
+    {
+        if (ctor.type != ClassModels::ConstructorType::CUSTOM)
+            return "";
+
+        std::string arguments;
+        for (const auto &param : ctor.parameters)
+        {
+            arguments += ", " + forwardedArgument(param);
+        }
+
+        const std::string resultType = ErrorGenerator::expectedType(className);
+        std::ostringstream oss;
+        // Header-only definitions must be inline to avoid ODR violations.
+        if (inlineDef)
+            oss << "inline ";
+        oss << resultType << " " << className << "::create("
+            << PropertiesGenerator::generateParameterList(ctor.parameters) << ") {\n";
+        oss << "    // TODO: Validate the arguments, returning std::unexpected for those " << className << " rejects.\n";
+        oss << "    return " << resultType << "(std::in_place" << arguments << ");\n";
         oss << "}\n";
         return oss.str();
     }
@@ -0,0 +1,235 @@
+#include "TracingGenerator.h"
+
+#include <algorithm>
+#include <cctype>
+
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ */
+namespace
+{
+    /// Content of the tracing support header; every "PROJECT_ENABLE_TRACING" is replaced by the project's macro.
+    constexpr const char *SUPPORT_HEADER_CONTENT = R"(/**
+ * @file Tracing.h
+ * @brief Scoped trace macro opening the body of every instrumented method and function.
+ *
+ * TRACE_SCOPE(name) expands to nothing unless PROJECT_ENABLE_TRACING is defined, which the
+ * PROJECT_ENABLE_TRACING CMake option does, so instrumentation costs nothing when it is off.
+ * When it is on, each scope times its own lifetime with std::chrono::steady_clock and reports it
+ * to the trace handler, which writes to std::clog unless replaced with tracing::setTraceHandler().
+ */
+
+#pragma once
+
+#if defined(PROJECT_ENABLE_TRACING)
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+namespace tracing
+{
+    /**
+     * @brief Receives one completed scope.
+     *
+     * Handlers are called from every thread that runs instrumented code, so they must be thread safe.
+     *
+     * @param name The scope name, e.g. "Order::submit".
+     * @param startNs The start of the scope, in nanoseconds since the std::chrono::steady_clock epoch.
+     * @param durationNs The duration of the scope in nanoseconds.
+     */
+    using TraceHandler = void (*)(const char* name, std::int64_t startNs, std::int64_t durationNs);
+
+    /// Default handler, writing one line per scope to std::clog.
+    inline void logScope(const char* name, std::int64_t, std::int64_t durationNs) {
+        std::clog << "[trace] " << name << ' ' << durationNs << " ns\n";
+    }
+
+    /// The handler every scope reports to.
+    inline std::atomic<TraceHandler> traceHandler{&logScope};
+
+    /**
+     * @brief Replaces the handler every scope reports to.
+     * @param handler The new handler.
+     */
+    inline void setTraceHandler(const TraceHandler handler) noexcept {
+        traceHandler.store(handler, std::memory_order_release);
+    }
+
+    /**
+     * @class TraceScope
+     * @brief Times its own lifetime and reports it to the trace handler.
+     */
+    class TraceScope {
+    public:
+        /**
+         * @brief Starts timing a scope.
+         * @param name The scope name; must outlive the scope, e.g. a string literal.
+         */
+        explicit TraceScope(const char* name) noexcept : name_(name), startNs_(now()) {}
+
+        /// Reports the scope to the trace handler.
+        ~TraceScope() {
+            const std::int64_t endNs = now();
+            traceHandler.load(std::memory_order_acquire)(name_, startNs_, endNs - startNs_);
+        }
+
+        TraceScope(const TraceScope&) = delete;
+        TraceScope& operator=(const TraceScope&) = delete;
+
+    private:
+        /// Returns the current std::chrono::steady_clock time in nanoseconds.
+        static std::int64_t now() noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        const char* name_;     ///< The scope name.
+        std::int64_t startNs_; ///< The start of the scope.
+    };
+} // namespace tracing
+
+#define TRACE_SCOPE_CONCAT_IMPL(a, b) a##b
+#define TRACE_SCOPE_CONCAT(a, b) TRACE_SCOPE_CONCAT_IMPL(a, b)
+/// Times the enclosing scope under the given name.
+#define TRACE_SCOPE(name) const ::tracing::TraceScope TRACE_SCOPE_CONCAT(traceScope_, __LINE__)(name)
+
+#else
+
+/// Tracing is compiled out; define PROJECT_ENABLE_TRACING to time instrumented scopes.
+#define TRACE_SCOPE(name) static_cast<void>(0)
+
+#endif
+)";
+
+    /**
+     * @brief Marks every method in a list as instrumented.
+     */
+    void instrumentMethods(std::vector<CallableModels::MethodModel> &methods)
+    {
+        for (auto &meth : methods)
+        {
+            meth.instrument = true;
+        }
+    }
+
+    /**
+     * @brief Reports whether any callable in a list is instrumented.
+     */
+    template <typename Callable>
+    bool anyInstrumented(const std::vector<Callable> &callables)
+    {
+        return std::any_of(callables.begin(), callables.end(), [](const Callable &callable)
+                           { return TracingGenerator::isInstrumented(callable); });
+    }
+
+} // end anonymous namespace
+
+namespace TracingGenerator
+{
+    std::string optionName(const std::string &projectName)
+    {
+        // Macro names are upper case, with anything but letters and digits folded into underscores.
+        std::string name;
+        for (const unsigned char c : projectName)
+        {
+            name += std::isalnum(c) ? static_cast<char>(std::toupper(c)) : '_';
+        }
+        return name + "_ENABLE_TRACING";
+    }
+
+    bool isInstrumented(const CallableModels::CallableModel &callable)
+    {
+        return callable.instrument && !callable.declSpec.isConstexpr;
+    }
+
+    std::string traceStatement(const CallableModels::CallableModel &callable, const std::string &scopeName)
+    {
+        if (!isInstrumented(callable))
+            return "";
+        return "TRACE_SCOPE(\"" + scopeName + "\");";
+    }
+
+    ClassModels::ClassModel applyInstrumentation(const ClassModels::ClassModel &cl, const bool inherited)
+    {
+        ClassModels::ClassModel instrumented = cl;
+        if (inherited || cl.options.instrument)
+        {
+            instrumentMethods(instrumented.publicMethods);
+            instrumentMethods(instrumented.privateMethods);
+            instrumentMethods(instrumented.protectedMethods);
+        }
+        return instrumented;
+    }
+
+    CodeGroupModels::NamespaceModel applyInstrumentation(const CodeGroupModels::NamespaceModel &ns, const bool inherited)
+    {
+        CodeGroupModels::NamespaceModel instrumented = ns;
+        instrumented.classes = applyInstrumentation(ns.classes, inherited);
+        instrumented.functions = applyInstrumentation(ns.functions, inherited);
+        for (auto &nested : instrumented.namespaces)
+        {
+            nested = applyInstrumentation(nested, inherited);
+        }
+        return instrumented;
+    }
+
+    std::vector<CallableModels::FunctionModel> applyInstrumentation(const std::vector<CallableModels::FunctionModel> &functions,
+                                                                    const bool inherited)
+    {
+        std::vector<CallableModels::FunctionModel> instrumented = functions;
+        for (auto &func : instrumented)
+        {
+            func.instrument = func.instrument || inherited;
+        }
+        return instrumented;
+    }
+
+    std::vector<ClassModels::ClassModel> applyInstrumentation(const std::vector<ClassModels::ClassModel> &classes,
+                                                              const bool inherited)
+    {
+        std::vector<ClassModels::ClassModel> instrumented;
+        instrumented.reserve(classes.size());
+        for (const auto &cl : classes)
+        {
+            instrumented.push_back(applyInstrumentation(cl, inherited));
+        }
+        return instrumented;
+    }
+
+    bool hasTraceScopes(const ClassModels::ClassModel &cl)
+    {
+        return anyInstrumented(cl.publicMethods) || anyInstrumented(cl.privateMethods) || anyInstrumented(cl.protectedMethods);
+    }
+
+    bool hasTraceScopes(const CodeGroupModels::NamespaceModel &ns)
+    {
+        return hasTraceScopes(ns.classes) || hasTraceScopes(ns.functions) ||
+               std::any_of(ns.namespaces.begin(), ns.namespaces.end(), [](const CodeGroupModels::NamespaceModel &nested)
+                           { return hasTraceScopes(nested); });
+    }
+
+    bool hasTraceScopes(const std::vector<CallableModels::FunctionModel> &functions)
+    {
+        return anyInstrumented(functions);
+    }
+
+    bool hasTraceScopes(const std::vector<ClassModels::ClassModel> &classes)
+    {
+        return std::any_of(classes.begin(), classes.end(), [](const ClassModels::ClassModel &cl)
+                           { return hasTraceScopes(cl); });
+    }
+
+    std::string generateSupportHeader(const std::string &projectName)
+    {
+        const std::string placeholder = "PROJECT_ENABLE_TRACING";
+        const std::string macro = optionName(projectName);
+        std::string header = SUPPORT_HEADER_CONTENT;
+        for (size_t pos = header.find(placeholder); pos != std::string::npos; pos = header.find(placeholder, pos + macro.size()))
+        {
+            header.replace(pos, placeholder.size(), macro);
+        }
+        return header;
+    }
+
+} // namespace TracingGenerator
@@ -16,8 +16,17 @@ namespace FileGeneration
             // The generated.baseFilePath starts with "ROOT/", but the writer cleans this.
             writer.writeHeaderFile(generated.baseFilePath, generated.headerContent);
 
-            // Write the source file.
-            writer.writeSourceFile(generated.baseFilePath, generated.sourceContent);
+            // Write the source file; header-only files have no source counterpart.
+            if (!generated.headerOnly)
+            {
+                writer.writeSourceFile(generated.baseFilePath, generated.sourceContent);
+            }
+
+            // Write the template definitions included by the header, if there are any.
+            if (!generated.templateContent.empty())
+            {
+                writer.writeTemplateFile(generated.baseFilePath, generated.templateContent);
+            }
         }
 
         // Recursively traverse each subdirectory in a depth-first manner.
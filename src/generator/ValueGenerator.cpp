@@ -0,0 +1,384 @@
+#include "ValueGenerator.h"
+#include "ClassGenerator.h"
+#include "GeneratorUtilities.h"
+
+#include <algorithm>
+#include <optional>
+#include <sstream>
+#include <vector>
+
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ */
+namespace
+{
+    /// Content of the support header, emitted verbatim.
+    constexpr const char *SUPPORT_HEADER_CONTENT = R"(/**
+ * @file ValueHash.h
+ * @brief Hash mixer used by the generated hash() members of value classes.
+ *
+ * Standard library hashes of integers are often the identity, so sequential keys fill a table
+ * indexed by the high bits of the hash very unevenly. hash() therefore folds the hash of every
+ * member into a seed with combine(), which runs the sum through the splitmix64 finaliser: each
+ * input bit flips each output bit with probability close to one half, whichever bits index the table.
+ */
+
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <tuple>
+
+namespace hashing
+{
+    /// Seed of every combined hash, the fractional digits of pi.
+    inline constexpr std::uint64_t SEED = 0x243f6a8885a308d3ULL;
+
+    /// splitmix64 finaliser; a bijection in which every input bit affects every output bit.
+    constexpr std::uint64_t mix(std::uint64_t x) noexcept {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+    /**
+     * @brief Folds one hash into a seed.
+     * @param seed The hash of the values folded so far.
+     * @param value The hash of the next value.
+     * @return The mixed hash of both, which depends on the order the values are folded in.
+     */
+    constexpr std::uint64_t combine(const std::uint64_t seed, const std::uint64_t value) noexcept {
+        // The golden ratio offset keeps a zero seed and value from mixing to zero.
+        return mix(seed + 0x9e3779b97f4a7c15ULL + value);
+    }
+
+    /// Types with a hash() member, such as other value classes.
+    template <typename T>
+    concept MemberHashable = requires(const T& value) {
+        { value.hash() } -> std::convertible_to<std::size_t>;
+    };
+
+    /// Types with an enabled std::hash specialisation.
+    template <typename T>
+    concept StdHashable = requires(const T& value) {
+        { std::hash<T>{}(value) } -> std::convertible_to<std::size_t>;
+    };
+
+    /// Types with a std::tuple_size, such as std::pair and std::tuple.
+    template <typename T>
+    concept TupleLike = requires { std::tuple_size<T>::value; };
+
+    /**
+     * @brief Hashes one member.
+     *
+     * Classes with a hash() member use it, then types with std::hash. Ranges such as standard
+     * containers and fixed arrays combine the hashes of their elements followed by their count,
+     * and tuple-like types combine the hashes of their elements.
+     *
+     * @param value The member.
+     * @return Its hash.
+     */
+    template <typename T>
+    constexpr std::uint64_t hashValue(const T& value) {
+        if constexpr (MemberHashable<T>) {
+            return value.hash();
+        } else if constexpr (StdHashable<T>) {
+            return std::hash<T>{}(value);
+        } else if constexpr (std::ranges::input_range<const T>) {
+            std::uint64_t seed = SEED;
+            std::uint64_t count = 0;
+            for (const auto& element : value) {
+                seed = combine(seed, hashValue(element));
+                ++count;
+            }
+            return combine(seed, count);
+        } else if constexpr (TupleLike<T>) {
+            return std::apply([](const auto&... elements) {
+                std::uint64_t seed = SEED;
+                ((seed = combine(seed, hashValue(elements))), ...);
+                return seed;
+            }, value);
+        } else {
+            static_assert(sizeof(T) == 0, "hashValue needs a hash() member, a std::hash specialisation, a range or a tuple-like type");
+        }
+    }
+} // namespace hashing
+)";
+
+    /**
+     * @brief Reports whether a test can assign a distinct value to a member.
+     *
+     * Only single values of builtin or string type that are neither const, pointers nor references qualify.
+     */
+    bool isAssignable(const PropertiesModels::Parameter &mem)
+    {
+        using PropertiesModels::Types;
+        const auto &type = mem.type;
+        if (type.typeDecl.ptrCount > 0 || type.typeDecl.isLValReference || type.typeDecl.isRValReference ||
+            !type.typeDecl.arrayDimensions.empty() ||
+            PropertiesModels::hasQualifier(type.qualifiers, PropertiesModels::TypeQualifier::CONST))
+            return false;
+        return type.type != Types::CUSTOM && type.type != Types::AUTO && type.type != Types::VOID;
+    }
+
+    /**
+     * @brief Reports whether a member is an assignable integral value, able to key the benchmark.
+     */
+    bool isIntegralKey(const PropertiesModels::Parameter &mem)
+    {
+        using PropertiesModels::Types;
+        switch (mem.type.type)
+        {
+        case Types::INT:
+        case Types::UINT:
+        case Types::LONG:
+        case Types::ULONG:
+        case Types::LONGLONG:
+        case Types::ULONGLONG:
+        case Types::CHAR:
+            return isAssignable(mem);
+        default:
+            return false;
+        }
+    }
+
+    /**
+     * @brief Returns the first public member able to key the benchmark, if any.
+     */
+    std::optional<PropertiesModels::Parameter> benchmarkKey(const ClassModels::ClassModel &cl)
+    {
+        const auto it = std::find_if(cl.publicMembers.begin(), cl.publicMembers.end(), isIntegralKey);
+        if (it == cl.publicMembers.end())
+            return std::nullopt;
+        return *it;
+    }
+
+} // end anonymous namespace
+
+namespace ValueGenerator
+{
+    std::string generateValueDeclarations(const ClassModels::ClassModel &cl)
+    {
+        if (!cl.options.value)
+            return "";
+
+        std::ostringstream oss;
+        oss << "    /// Compares the data members in declaration order; deleted if one of them has no operator<=>.\n"
+            << "    auto operator<=>(const " << cl.name << "&) const = default;\n\n";
+        oss << "    /// Compares every data member for equality.\n"
+            << "    bool operator==(const " << cl.name << "&) const = default;\n\n";
+        oss << "    /**\n     * @brief Hashes the data members compared by operator==, for std::hash.\n"
+            << "     * @return Their hashes folded in declaration order with hashing::combine().\n     */\n"
+            << "    std::size_t hash() const noexcept {\n"
+            << "        std::uint64_t seed = hashing::SEED;\n";
+        for (const auto &mem : GeneratorUtilities::allMembers(cl))
+        {
+            oss << "        seed = hashing::combine(seed, hashing::hashValue(" << mem.name << "));\n";
+        }
+        oss << "        return static_cast<std::size_t>(seed);\n    }\n\n";
+        return oss.str();
+    }
+
+    std::string generateHashSpecialization(const ClassModels::ClassModel &cl, const std::string &scope)
+    {
+        if (!cl.options.value)
+            return "";
+
+        const std::string qualifiedName = scope + cl.name + GeneratorUtilities::templateArgumentList(cl.templateSpec);
+        std::ostringstream oss;
+        oss << "\n/// Hashes " << qualifiedName << " with its hash() member, so it can key unordered containers.\n"
+            << (cl.templateSpec.isTemplate() ? GeneratorUtilities::templateHeader(cl.templateSpec) : "template <>\n")
+            << "struct std::hash<" << qualifiedName << "> {\n"
+            << "    std::size_t operator()(const " << qualifiedName << "& value) const noexcept { return value.hash(); }\n"
+            << "};\n";
+        return oss.str();
+    }
+
+    std::set<std::string> requiredHeaders(const ClassModels::ClassModel &cl)
+    {
+        if (!cl.options.value)
+            return {};
+        return {"<compare>", "<cstddef>", "<cstdint>", "<functional>", std::string("\"") + SUPPORT_HEADER + "\""};
+    }
+
+    std::string generateSupportHeader()
+    {
+        return SUPPORT_HEADER_CONTENT;
+    }
+
+    bool hasTest(const ClassModels::ClassModel &cl)
+    {
+        return cl.options.value && !cl.templateSpec.isTemplate() && ClassGenerator::isDefaultConstructible(cl);
+    }
+
+    bool hasBenchmark(const ClassModels::ClassModel &cl)
+    {
+        return hasTest(cl) && benchmarkKey(cl).has_value();
+    }
+
+    std::string testName(const std::string &qualifiedName)
+    {
+        return GeneratorUtilities::executableName(qualifiedName, "ValueTest");
+    }
+
+    std::string benchmarkName(const std::string &qualifiedName)
+    {
+        return GeneratorUtilities::executableName(qualifiedName, "HashBenchmark");
+    }
+
+    std::string generateTest(const ClassModels::ClassModel &cl, const std::string &qualifiedName, const std::string &header)
+    {
+        std::ostringstream oss;
+        oss << "/**\n * @file " << testName(qualifiedName) << ".cpp\n"
+            << " * @brief Test of the generated " << qualifiedName << " comparison operators and hash.\n */\n\n";
+        oss << "#include \"" << header << "\"\n\n";
+        oss << "#include <compare>\n#include <cstddef>\n#include <functional>\n#include <iostream>\n"
+            << "#include <unordered_set>\n\n";
+        oss << "namespace\n{\n"
+            << "    /// Hashes an object through std::hash, as unordered containers do.\n"
+            << "    std::size_t hashOf(const " << qualifiedName << " &value)\n    {\n"
+            << "        return std::hash<" << qualifiedName << ">{}(value);\n    }\n"
+            << "} // namespace\n\n";
+        oss << "int main()\n{\n"
+            << "    int failures = 0;\n"
+            << "    auto check = [&failures](const bool passed, const char *what)\n    {\n"
+            << "        if (!passed)\n        {\n"
+            << "            std::cerr << \"FAILED: \" << what << '\\n';\n"
+            << "            ++failures;\n        }\n    };\n\n"
+            << "    const " << qualifiedName << " object{};\n"
+            << "    const " << qualifiedName << " copy = object;\n"
+            << "    check(copy == object && !(copy != object), \"a copy compares equal\");\n"
+            << "    check(hashOf(copy) == hashOf(object), \"equal objects hash equal\");\n"
+            << "    check(hashOf(object) == object.hash(), \"std::hash calls hash()\");\n"
+            << "    if constexpr (std::three_way_comparable<" << qualifiedName << ">)\n"
+            << "        check((copy <=> object) == 0, \"a copy is equivalent under <=>\");\n\n";
+
+        size_t position = 0;
+        for (const auto &mem : cl.publicMembers)
+        {
+            if (!isAssignable(mem))
+                continue;
+            const std::string sample = mem.type.type == PropertiesModels::Types::STRING
+                                           ? "\"" + mem.name + "\""
+                                           : "static_cast<decltype(changed." + mem.name + ")>(" + std::to_string(++position) + ")";
+            oss << "    {\n"
+                << "        " << qualifiedName << " changed = object;\n"
+                << "        changed." << mem.name << " = " << sample << ";\n"
+                << "        if (!(changed." << mem.name << " == object." << mem.name << "))\n        {\n"
+                << "            check(changed != object, \"changing " << mem.name << " breaks equality\");\n"
+                << "            check(hashOf(changed) != hashOf(object), \"changing " << mem.name << " changes the hash\");\n"
+                << "            if constexpr (std::three_way_comparable<" << qualifiedName << ">)\n"
+                << "                check((changed <=> object) != 0, \"changing " << mem.name << " breaks equivalence under <=>\");\n"
+                << "        }\n    }\n\n";
+        }
+
+        oss << "    const std::unordered_set<" << qualifiedName << "> set{object, copy};\n"
+            << "    check(set.size() == 1, \"an unordered_set keeps one of two equal objects\");\n\n"
+            << "    if (failures == 0)\n"
+            << "        std::cout << \"" << qualifiedName << " comparison and hash passed\\n\";\n"
+            << "    return failures == 0 ? 0 : 1;\n}\n";
+        return oss.str();
+    }
+
+    std::string generateBenchmark(const ClassModels::ClassModel &cl, const std::string &qualifiedName,
+                                  const std::string &header)
+    {
+        const std::string key = benchmarkKey(cl).value().name;
+
+        std::ostringstream oss;
+        oss << "/**\n * @file " << benchmarkName(qualifiedName) << ".cpp\n"
+            << " * @brief Measures the distribution and speed of the generated " << qualifiedName << " hash.\n */\n\n";
+        oss << "#include \"" << header << "\"\n\n";
+        oss << "#include <algorithm>\n#include <bit>\n#include <chrono>\n#include <cmath>\n#include <cstddef>\n"
+            << "#include <cstdint>\n#include <functional>\n#include <iostream>\n#include <limits>\n#include <vector>\n\n";
+        oss << "namespace\n{\n"
+            << "    using Value = ::" << qualifiedName << ";\n"
+            << "    using Key = decltype(Value::" << key << ");\n\n"
+            << "    /// Number of bits of a hash.\n"
+            << "    constexpr int HASH_BITS = std::numeric_limits<std::size_t>::digits;\n\n"
+            << "    /// Number of value bits of the key, each flipped in turn to measure the avalanche.\n"
+            << "    constexpr int KEY_BITS = std::numeric_limits<Key>::digits;\n\n"
+            << "    /// Number of distinct objects hashed, limited by the values the key can take.\n"
+            << "    constexpr std::uint64_t COUNT = std::min<std::uint64_t>(std::uint64_t{1} << 16, std::numeric_limits<Key>::max());\n\n"
+            << "    /// Returns an object differing from the others only in its " << key << ".\n"
+            << "    Value make(const std::uint64_t key)\n    {\n"
+            << "        Value value{};\n"
+            << "        value." << key << " = static_cast<Key>(key);\n"
+            << "        return value;\n    }\n\n"
+            << "    /**\n     * @brief How evenly a hash function spreads the objects.\n     */\n"
+            << "    struct Quality\n    {\n"
+            << "        double lowOccupancy;  ///< Buckets filled when the low bits index the table, relative to a random function.\n"
+            << "        double highOccupancy; ///< Buckets filled when the high bits index the table, relative to a random function.\n"
+            << "        double avalanche;     ///< Average share of hash bits flipped by flipping one key bit; 0.5 is ideal.\n"
+            << "    };\n\n"
+            << "    /// Measures the quality of a hash function over COUNT objects, in a table with about one object per bucket.\n"
+            << "    template <typename Hash>\n"
+            << "    Quality measure(const Hash &hash)\n    {\n"
+            << "        const std::size_t buckets = std::bit_floor(COUNT);\n"
+            << "        const int indexBits = std::countr_zero(buckets);\n"
+            << "        std::vector<bool> low(buckets);\n"
+            << "        std::vector<bool> high(buckets);\n"
+            << "        double lowFilled = 0;\n"
+            << "        double highFilled = 0;\n"
+            << "        double flipped = 0;\n"
+            << "        for (std::uint64_t key = 0; key < COUNT; ++key)\n        {\n"
+            << "            const std::size_t h = hash(make(key));\n"
+            << "            lowFilled += !low[h & (buckets - 1)];\n"
+            << "            low[h & (buckets - 1)] = true;\n"
+            << "            highFilled += !high[h >> (HASH_BITS - indexBits)];\n"
+            << "            high[h >> (HASH_BITS - indexBits)] = true;\n"
+            << "            for (int bit = 0; bit < KEY_BITS; ++bit)\n"
+            << "                flipped += std::popcount(h ^ hash(make(key ^ (std::uint64_t{1} << bit))));\n"
+            << "        }\n"
+            << "        // A random function leaves a bucket empty with probability exp(-objects / buckets).\n"
+            << "        const double expected = static_cast<double>(buckets) * (1.0 - std::exp(-static_cast<double>(COUNT) / buckets));\n"
+            << "        return {lowFilled / expected, highFilled / expected, flipped / (static_cast<double>(COUNT) * KEY_BITS * HASH_BITS)};\n"
+            << "    }\n\n"
+            << "    /// Times a hash function, in nanoseconds per object.\n"
+            << "    template <typename Hash>\n"
+            << "    double nanosecondsPerHash(const Hash &hash, const std::vector<Value> &values)\n    {\n"
+            << "        constexpr int ROUNDS = 20;\n"
+            << "        std::size_t sum = 0;\n"
+            << "        const auto start = std::chrono::steady_clock::now();\n"
+            << "        for (int round = 0; round < ROUNDS; ++round)\n"
+            << "            for (const Value &value : values)\n"
+            << "                sum += hash(value);\n"
+            << "        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;\n"
+            << "        // Keep the hashes observable so that the loop is not optimised away.\n"
+            << "        volatile std::size_t sink = sum;\n"
+            << "        static_cast<void>(sink);\n"
+            << "        return elapsed.count() / (static_cast<double>(values.size()) * ROUNDS);\n    }\n\n"
+            << "    /// Prints the figures of one hash function.\n"
+            << "    void report(const char *name, const Quality &quality, const double nanoseconds)\n    {\n"
+            << "        std::cout << name << \":\\n\"\n"
+            << "                  << \"  bucket occupancy (low bits):  \" << quality.lowOccupancy << \" of random\\n\"\n"
+            << "                  << \"  bucket occupancy (high bits): \" << quality.highOccupancy << \" of random\\n\"\n"
+            << "                  << \"  avalanche:                    \" << quality.avalanche << \" (ideal 0.5)\\n\"\n"
+            << "                  << \"  time:                         \" << nanoseconds << \" ns/hash\\n\";\n    }\n\n"
+            << "    /// Runs the benchmark; inside the namespace, its names hide classes of the same name in the header.\n"
+            << "    int run()\n    {\n"
+            << "        std::vector<Value> values;\n"
+            << "        values.reserve(COUNT);\n"
+            << "        for (std::uint64_t key = 0; key < COUNT; ++key)\n"
+            << "            values.push_back(make(key));\n\n"
+            << "        const auto generated = [](const Value &value) { return std::hash<Value>{}(value); };\n"
+            << "        const auto keyOnly = [](const Value &value) { return std::hash<Key>{}(value." << key << "); };\n\n"
+            << "        const Quality quality = measure(generated);\n"
+            << "        report(\"std::hash<" << qualifiedName << ">\", quality, nanosecondsPerHash(generated, values));\n"
+            << "        report(\"std::hash of " << key << " alone\", measure(keyOnly), nanosecondsPerHash(keyOnly, values));\n\n"
+            << "        // A good hash fills tables indexed by any of its bits like a random function and flips half its bits.\n"
+            << "        const bool good = quality.lowOccupancy > 0.9 && quality.highOccupancy > 0.9 && std::abs(quality.avalanche - 0.5) < 0.05;\n"
+            << "        if (!good)\n"
+            << "            std::cerr << \"FAILED: the " << qualifiedName << " hash is poorly distributed\\n\";\n"
+            << "        return good ? 0 : 1;\n    }\n"
+            << "} // namespace\n\n";
+        oss << "int main()\n{\n    return run();\n}\n";
+        return oss.str();
+    }
+
+} // namespace ValueGenerator
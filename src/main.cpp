@@ -220,21 +220,58 @@ int main(int argc, char *argv[])
         std::cout << "Directory tree built successfully." << std::endl;
 
         // Create an instance of DiskFileWriter for file generation.
-        GeneratedFileWriter::DiskFileWriter diskWriter(outputFolder.string());
+        GeneratedFileWriter::DiskFileWriter diskWriter(outputFolder.string(),
+                                                       projModel.options.errors == CodeGroupModels::ErrorHandling::EXCEPTIONS);
 
         // Traverse the directory tree and generate output files using the disk writer.
         FileGeneration::traverseAndGenerate(rootNode, diskWriter);
         std::cout << "File generation completed successfully." << std::endl;
 
-        // Generate the CMake file
-        std::string cmakeFile = BuildToolGenerator::generateCmakeLists(projectMeta);
-        diskWriter.writeCmakeLists(cmakeFile);
+        const auto buildSystem = projModel.options.buildSystem;
+        const bool generateCmake = buildSystem != CodeGroupModels::BuildSystem::BAZEL;
+        const bool generateBazel = buildSystem != CodeGroupModels::BuildSystem::CMAKE;
+
+        if (generateCmake)
+        {
+            // Generate the CMake file
+            std::string cmakeFile = BuildToolGenerator::generateCmakeLists(projectMeta);
+            diskWriter.writeCmakeLists(cmakeFile);
+
+            // Generate per-library CMake subprojects (only for the subprojects layout)
+            for (const auto &[libraryPath, libraryCmake] : BuildToolGenerator::generateLibraryCmakeLists(projectMeta))
+            {
+                diskWriter.writeLibraryCmakeLists(libraryPath, libraryCmake);
+            }
+
+            // Generate the CMake presets (debug, LTO release and PGO stages)
+            diskWriter.writeCmakePresets(BuildToolGenerator::generateCmakePresets(projModel.name));
+        }
+
+        if (generateBazel)
+        {
+            // Generate the Bazel BUILD and MODULE files
+            diskWriter.writeBazelFiles(BuildToolGenerator::generateBazelFiles(projectMeta, projModel.version));
+        }
 
         // Generate main file
-        diskWriter.writeMain();
+        diskWriter.writeMain(projectMeta);
+
+        // Generate the files recorded outside the tree (support headers, tests and benchmarks)
+        diskWriter.writeSupportFiles(projectMeta.supportFiles);
+
+        // Generate the compilation database so tooling can index before any build system is configured
+        std::string projectRoot = fs::absolute(outputFolder).lexically_normal().generic_string();
+        if (projectRoot.size() > 1 && projectRoot.back() == '/')
+        {
+            projectRoot.pop_back();
+        }
+        diskWriter.writeCompileCommands(BuildToolGenerator::generateCompileCommands(projectMeta, projectRoot));
 
-        // Generate vscode Jsons
-        diskWriter.writeVsCodeJsons(BuildToolGenerator::generateVscodeJSONs(projModel.name));
+        if (generateCmake)
+        {
+            // Generate vscode Jsons (the tasks drive CMake)
+            diskWriter.writeVsCodeJsons(BuildToolGenerator::generateVscodeJSONs(projModel.name, projModel.options.profilingTools));
+        }
     }
     catch (const std::exception &ex)
     {
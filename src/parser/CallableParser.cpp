@@ -20,6 +20,12 @@ namespace CallableParser
         std::string description;
         // Default declaration specifier (no modifiers).
         PropertiesModels::DeclartionSpecifier declSpec;
+        // Not noexcept unless requested.
+        bool isNoexcept = false;
+        // Not a template unless parameters are declared.
+        PropertiesModels::TemplateSpec templateSpec;
+        // Not traced unless requested here or by an enclosing class, library or project.
+        bool instrument = false;
 
         // Process each property line until the deque is empty.
         while (!propertyLines.empty())
@@ -74,13 +80,32 @@ namespace CallableParser
                 // Parse the declaration specifier.
                 declSpec = PropertiesParser::parseDeclarationSpecifier(value);
             }
+            else if (key == "noexcept")
+            {
+                isNoexcept = ParserUtilities::parseFlag(std::string(key), value);
+            }
+            else if (key == "instrument")
+            {
+                instrument = ParserUtilities::parseFlag(std::string(key), value);
+            }
+            else if (key == "template")
+            {
+                templateSpec.parameters = PropertiesParser::parseTemplateParameters(value);
+            }
+            else if (key == "instantiate")
+            {
+                // Argument lists are checked against the parameters, so those must come first.
+                if (!templateSpec.isTemplate())
+                    throw std::runtime_error("instantiate requires template parameters to be declared first.");
+                templateSpec.instantiations = PropertiesParser::parseTemplateInstantiations(value, templateSpec.parameters.size());
+            }
             else
             {
                 throw std::runtime_error("Unrecognised property in callable block: " + std::string(key));
             }
         }
 
-        return CallableModels::CallableModel(returnType, callableName, params, declSpec, description);
+        return CallableModels::CallableModel(returnType, callableName, params, declSpec, description, isNoexcept, templateSpec, instrument);
     }
 
 } // namespace CallableParser
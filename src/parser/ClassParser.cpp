@@ -28,6 +28,8 @@ namespace ClassParser
      * @param publicMembers A reference to the vector of public data members.
      * @param privateMembers A reference to the vector of private data members.
      * @param protectedMembers A reference to the vector of protected data members.
+     * @param options A reference to the class's opt-in generation options.
+     * @param templateSpec A reference to the class's template parameters and instantiations.
      * @param currentAccess The current access specifier in effect for subsequent declarations.
      *
      * @throws std::runtime_error if an unrecognized property key is encountered.
@@ -40,6 +42,8 @@ namespace ClassParser
                                         std::vector<PropertiesModels::Parameter> &publicMembers,
                                         std::vector<PropertiesModels::Parameter> &privateMembers,
                                         std::vector<PropertiesModels::Parameter> &protectedMembers,
+                                        ClassModels::ClassOptions &options,
+                                        PropertiesModels::TemplateSpec &templateSpec,
                                         Access currentAccess)
     {
         // Remove leading '|' if present and trim.
@@ -116,6 +120,77 @@ namespace ClassParser
                 break;
             }
         }
+        else if (key == "special_members")
+        {
+            if (value == "default")
+                options.specialMembers = ClassModels::SpecialMemberPolicy::DEFAULTED;
+            else if (value == "custom")
+                options.specialMembers = ClassModels::SpecialMemberPolicy::CUSTOM;
+            else
+                throw std::runtime_error("Unknown special member policy: " + std::string(value));
+        }
+        else if (key == "trivially_copyable")
+        {
+            options.triviallyCopyable = ParserUtilities::parseFlag(std::string(key), value);
+        }
+        else if (key == "soa")
+        {
+            options.soa = ParserUtilities::parseFlag(std::string(key), value);
+        }
+        else if (key == "pooled")
+        {
+            options.pooled = ParserUtilities::parseFlag(std::string(key), value);
+        }
+        else if (key == "instrument")
+        {
+            options.instrument = ParserUtilities::parseFlag(std::string(key), value);
+        }
+        else if (key == "reflect")
+        {
+            options.reflect = ParserUtilities::parseFlag(std::string(key), value);
+        }
+        else if (key == "value")
+        {
+            options.value = ParserUtilities::parseFlag(std::string(key), value);
+        }
+        else if (key == "layout")
+        {
+            if (value == "compact")
+                options.layout = ClassModels::LayoutPolicy::COMPACT;
+            else if (value == "declared")
+                options.layout = ClassModels::LayoutPolicy::DECLARED;
+            else
+                throw std::runtime_error("Unknown member layout: " + std::string(value));
+        }
+        else if (key == "allocator")
+        {
+            if (value == "pmr")
+                options.allocator = ClassModels::AllocatorPolicy::PMR;
+            else if (value == "std")
+                options.allocator = ClassModels::AllocatorPolicy::STD;
+            else
+                throw std::runtime_error("Unknown allocator: " + std::string(value));
+        }
+        else if (key == "serialize")
+        {
+            if (value == "binary")
+                options.serialize = ClassModels::SerializationFormat::BINARY;
+            else if (value == "none")
+                options.serialize = ClassModels::SerializationFormat::NONE;
+            else
+                throw std::runtime_error("Unknown serialization format: " + std::string(value));
+        }
+        else if (key == "template")
+        {
+            templateSpec.parameters = PropertiesParser::parseTemplateParameters(value);
+        }
+        else if (key == "instantiate")
+        {
+            // Argument lists are checked against the parameters, so those must come first.
+            if (!templateSpec.isTemplate())
+                throw std::runtime_error("instantiate requires template parameters to be declared first.");
+            templateSpec.instantiations = PropertiesParser::parseTemplateInstantiations(value, templateSpec.parameters.size());
+        }
         else
         {
             throw std::runtime_error("Unknown class-level property: " + std::string(key));
@@ -136,6 +211,8 @@ namespace ClassParser
         bool hasMoveAssignment = false;
         std::vector<ClassModels::Constructor> constructors;
         std::optional<ClassModels::Destructor> destructor;
+        ClassModels::ClassOptions options;
+        PropertiesModels::TemplateSpec templateSpec;
 
         std::vector<CallableModels::MethodModel> publicMethods, privateMethods, protectedMethods;
         std::vector<PropertiesModels::Parameter> publicMembers, privateMembers, protectedMembers;
@@ -249,7 +326,7 @@ namespace ClassParser
                 // Process a top-level property.
                 processTopLevelProperty(line, description, hasCopyAssignment, hasMoveAssignment,
                                         constructors, publicMembers, privateMembers, protectedMembers,
-                                        currentAccess);
+                                        options, templateSpec, currentAccess);
             }
             else
             {
@@ -265,6 +342,81 @@ namespace ClassParser
         if (!validContentFound)
             throw std::runtime_error("Malformed DSL file: no valid DSL content found.");
 
+        // Custom copy and move bodies can never be trivial.
+        if (options.triviallyCopyable && options.specialMembers == ClassModels::SpecialMemberPolicy::CUSTOM)
+            throw std::runtime_error("Class " + className + " cannot be trivially copyable with custom special members.");
+
+        // Allocator-extended copies initialise every member from the other object's, which arrays cannot be.
+        if (options.allocator == ClassModels::AllocatorPolicy::PMR)
+        {
+            for (const auto *section : {&publicMembers, &privateMembers, &protectedMembers})
+            {
+                for (const auto &mem : *section)
+                {
+                    if (!mem.type.typeDecl.arrayDimensions.empty())
+                        throw std::runtime_error("Class " + className + " cannot use allocator = pmr with array member " + mem.name + ".");
+                }
+            }
+        }
+
+        // Each public member becomes a std::vector exposed as a std::span, which needs contiguous, assignable elements.
+        if (options.soa)
+        {
+            if (publicMembers.empty())
+                throw std::runtime_error("Class " + className + " needs public members to generate a struct-of-arrays container.");
+            for (const auto &mem : publicMembers)
+            {
+                const auto &type = mem.type;
+                if (type.type == PropertiesModels::Types::BOOL || type.typeDecl.isLValReference ||
+                    type.typeDecl.isRValReference || !type.typeDecl.arrayDimensions.empty() ||
+                    PropertiesModels::hasQualifier(type.qualifiers, PropertiesModels::TypeQualifier::CONST))
+                    throw std::runtime_error("Class " + className + " cannot store member " + mem.name +
+                                             " in a struct-of-arrays container; bool, const, reference and array members are not supported.");
+            }
+        }
+
+        // Deserialisation assigns every member in place, which const and reference members cannot take.
+        if (options.serialize == ClassModels::SerializationFormat::BINARY)
+        {
+            for (const auto *section : {&publicMembers, &privateMembers, &protectedMembers})
+            {
+                for (const auto &mem : *section)
+                {
+                    const auto &type = mem.type;
+                    if (type.typeDecl.isLValReference || type.typeDecl.isRValReference ||
+                        PropertiesModels::hasQualifier(type.qualifiers, PropertiesModels::TypeQualifier::CONST))
+                        throw std::runtime_error("Class " + className + " cannot serialize member " + mem.name +
+                                                 "; const and reference members cannot be deserialized.");
+                }
+            }
+        }
+
+        // Descriptors hold a pointer to each member, which cannot point to a reference.
+        if (options.reflect)
+        {
+            for (const auto *section : {&publicMembers, &privateMembers, &protectedMembers})
+            {
+                for (const auto &mem : *section)
+                {
+                    if (mem.type.typeDecl.isLValReference || mem.type.typeDecl.isRValReference)
+                        throw std::runtime_error("Class " + className + " cannot reflect reference member " + mem.name + ".");
+                }
+            }
+        }
+
+        // Defaulted comparisons are deleted for classes with reference members.
+        if (options.value)
+        {
+            for (const auto *section : {&publicMembers, &privateMembers, &protectedMembers})
+            {
+                for (const auto &mem : *section)
+                {
+                    if (mem.type.typeDecl.isLValReference || mem.type.typeDecl.isRValReference)
+                        throw std::runtime_error("Class " + className + " cannot compare reference member " + mem.name + ".");
+                }
+            }
+        }
+
         return ClassModels::ClassModel(
             className,
             description,
@@ -277,7 +429,9 @@ namespace ClassParser
             privateMembers,
             protectedMembers,
             hasCopyAssignment,
-            hasMoveAssignment);
+            hasMoveAssignment,
+            options,
+            templateSpec);
     }
 
 } // namespace ClassParser
@@ -0,0 +1,91 @@
+#include "EnumParser.h"
+#include "ParserUtilities.h"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+/**
+ * @brief Anonymous namespace for internal helper functions.
+ */
+namespace
+{
+    /**
+     * @brief Reports whether a name is a valid C++ identifier.
+     */
+    bool isIdentifier(std::string_view name)
+    {
+        if (name.empty() || std::isdigit(static_cast<unsigned char>(name.front())))
+            return false;
+        return std::all_of(name.begin(), name.end(), [](const unsigned char c)
+                           { return std::isalnum(c) || c == '_'; });
+    }
+
+} // end anonymous namespace
+
+namespace EnumParser
+{
+    EnumModels::EnumModel parseEnumBlock(const std::string &enumName, std::deque<std::string_view> &lines)
+    {
+        EnumModels::EnumModel model{enumName, "", {}, ""};
+
+        // Consume property lines until an end-of-scope marker ("_") is reached.
+        while (!lines.empty())
+        {
+            std::string_view line = ParserUtilities::trim(lines.front());
+            lines.pop_front(); // Consume the line
+
+            if (line == "_")
+                break; // End of the enum block.
+
+            // Process only lines that start with the '|' character.
+            if (line.empty() || line.front() != '|')
+                continue;
+
+            line.remove_prefix(1);
+            line = ParserUtilities::trim(line);
+            size_t equalPos = line.find('=');
+            if (equalPos == std::string_view::npos)
+                continue; // Skip malformed lines.
+
+            std::string_view key = ParserUtilities::trim(line.substr(0, equalPos));
+            std::string_view value = ParserUtilities::trim(line.substr(equalPos + 1));
+
+            if (key == "values")
+            {
+                for (const auto token : ParserUtilities::split(value, ','))
+                {
+                    const std::string_view enumerator = ParserUtilities::trim(token);
+                    if (!isIdentifier(enumerator))
+                        throw std::runtime_error("Enum " + enumName + " has an invalid enumerator: '" + std::string(enumerator) + "'");
+                    if (std::find(model.values.begin(), model.values.end(), enumerator) != model.values.end())
+                        throw std::runtime_error("Enum " + enumName + " declares enumerator " + std::string(enumerator) + " twice.");
+                    model.values.emplace_back(enumerator);
+                }
+            }
+            else if (key == "description")
+            {
+                // Remove quotes if present.
+                if (value.size() >= 2 && value.front() == '"' && value.back() == '"')
+                {
+                    value.remove_prefix(1);
+                    value.remove_suffix(1);
+                }
+                model.description = std::string(ParserUtilities::trim(value));
+            }
+            else if (key == "underlying")
+            {
+                model.underlyingType = std::string(value);
+            }
+            else
+            {
+                throw std::runtime_error("Unrecognized property in enum block: " + std::string(key));
+            }
+        }
+
+        if (model.values.empty())
+            throw std::runtime_error("Enum " + enumName + " needs at least one value.");
+        return model;
+    }
+
+} // namespace EnumParser
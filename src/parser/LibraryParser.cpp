@@ -21,8 +21,10 @@ namespace LibraryParser
         // Library-specific properties.
         std::string version;
         std::vector<std::string> dependencies;
+        CodeGroupModels::LibraryMode mode = CodeGroupModels::LibraryMode::COMPILED;
+        bool instrument = false;
 
-        // Process property lines (starting with '|') that define version and dependency.
+        // Process property lines (starting with '|') that define version, dependency, mode and instrumentation.
         while (!lines.empty())
         {
             std::string_view line = ParserUtilities::trim(lines.front());
@@ -55,6 +57,20 @@ namespace LibraryParser
                     dependencies.push_back(std::string(ParserUtilities::trim(dep)));
                 }
             }
+            else if (key == "mode")
+            {
+                // Select how the library is packaged into build targets.
+                if (value == "header-only")
+                    mode = CodeGroupModels::LibraryMode::HEADER_ONLY;
+                else if (value == "compiled")
+                    mode = CodeGroupModels::LibraryMode::COMPILED;
+                else
+                    throw std::runtime_error("Unknown library mode: " + value);
+            }
+            else if (key == "instrument")
+            {
+                instrument = ParserUtilities::parseFlag(key, value);
+            }
             else
             {
                 throw std::runtime_error("Unknown property in library block: " + key);
@@ -179,7 +195,9 @@ namespace LibraryParser
                                              folderModel.subFolders,
                                              folderModel.classFiles,
                                              folderModel.namespaceFiles,
-                                             folderModel.functionFile);
+                                             folderModel.functionFile,
+                                             mode,
+                                             instrument);
     }
 
 } // namespace LibraryParser
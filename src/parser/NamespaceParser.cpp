@@ -2,6 +2,7 @@
 #include "ParserUtilities.h"
 #include "ClassParser.h"
 #include "CallableParser.h"
+#include "EnumParser.h"
 #include "ClassModels.h"
 #include "CallableModels.h"
 
@@ -18,6 +19,7 @@ namespace NamespaceParser
         std::vector<ClassModels::ClassModel> classes;
         std::vector<CallableModels::FunctionModel> functions;
         std::vector<CodeGroupModels::NamespaceModel> nestedNamespaces;
+        std::vector<EnumModels::EnumModel> enums;
         bool validContentFound = false;
 
         while (!lines.empty())
@@ -77,6 +79,12 @@ namespace NamespaceParser
                     auto fn = CallableParser::parseFunctionProperties(identifier, lines);
                     functions.push_back(fn);
                 }
+                else if (keyword == "enum")
+                {
+                    if (identifier.empty())
+                        throw std::runtime_error("Enum block must have an identifier.");
+                    enums.push_back(EnumParser::parseEnumBlock(identifier, lines));
+                }
                 else if (keyword == "method")
                 {
                     // Methods cannot be declared at the namespace level.
@@ -124,7 +132,7 @@ namespace NamespaceParser
         if (!validContentFound)
             throw std::runtime_error("Malformed DSL file: no valid DSL content found in namespace block");
 
-        return CodeGroupModels::NamespaceModel{nsName.value_or(""), description, classes, functions, nestedNamespaces};
+        return CodeGroupModels::NamespaceModel{nsName.value_or(""), description, classes, functions, nestedNamespaces, enums};
     }
 
 } // namespace NamespaceParser
@@ -1,6 +1,7 @@
 #include "ParserUtilities.h"
 
 #include <cctype> // for std::isspace
+#include <stdexcept>
 
 namespace ParserUtilities
 {
@@ -41,4 +42,44 @@ namespace ParserUtilities
         return tokens;
     }
 
+    std::vector<std::string_view> splitTopLevel(std::string_view input, char delimiter)
+    {
+        std::vector<std::string_view> tokens;
+
+        // Track bracket depth so that only delimiters at depth zero split the input.
+        int depth = 0;
+        size_t start = 0;
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            char c = input[i];
+            if (c == '<' || c == '(' || c == '[')
+                ++depth;
+            else if (c == '>' || c == ')' || c == ']')
+                --depth;
+            else if (c == delimiter && depth == 0)
+            {
+                tokens.push_back(input.substr(start, i - start));
+                start = i + 1;
+            }
+
+            if (depth < 0)
+                throw std::runtime_error("Unbalanced brackets in: " + std::string(input));
+        }
+        if (depth != 0)
+            throw std::runtime_error("Unbalanced brackets in: " + std::string(input));
+
+        if (start < input.size())
+            tokens.push_back(input.substr(start));
+        return tokens;
+    }
+
+    bool parseFlag(const std::string &key, std::string_view value)
+    {
+        if (value == "true")
+            return true;
+        if (value == "false")
+            return false;
+        throw std::runtime_error("Expected true or false for " + key + ", got: " + std::string(value));
+    }
+
 } // namespace ParserUtilities
@@ -15,6 +15,35 @@
 #include <vector>
 #include <string>
 
+/**
+ * @brief Internal helpers for project block parsing.
+ */
+namespace
+{
+    /**
+     * @brief Parses a non-negative integer property value.
+     *
+     * @param key The property key, used in error messages.
+     * @param value The property value to parse.
+     * @return The parsed count.
+     * @throws std::runtime_error if the value is not a plain non-negative integer.
+     */
+    size_t parseCount(const std::string &key, const std::string &value)
+    {
+        if (value.empty() || value.find_first_not_of("0123456789") != std::string::npos)
+            throw std::runtime_error("Expected a non-negative integer for " + key + ", got: " + value);
+        try
+        {
+            return std::stoul(value);
+        }
+        catch (const std::out_of_range &)
+        {
+            throw std::runtime_error("Value out of range for " + key + ": " + value);
+        }
+    }
+
+} // end anonymous namespace
+
 namespace ProjectParser
 {
     CodeGroupModels::ProjectModel parseProjectBlock(const std::string &projectName, std::deque<std::string_view> &lines)
@@ -22,8 +51,9 @@ namespace ProjectParser
         // Project-specific properties.
         std::string version;
         std::vector<std::string> dependencies;
+        CodeGroupModels::ProjectOptions options;
 
-        // Process property lines (starting with '|') for version and dependency.
+        // Process property lines (starting with '|') for version, dependency and generation options.
         while (!lines.empty())
         {
             std::string_view line = ParserUtilities::trim(lines.front());
@@ -56,12 +86,94 @@ namespace ProjectParser
                     dependencies.push_back(std::string(ParserUtilities::trim(dep)));
                 }
             }
+            else if (key == "build")
+            {
+                // Select the build systems to generate.
+                if (value == "cmake")
+                    options.buildSystem = CodeGroupModels::BuildSystem::CMAKE;
+                else if (value == "bazel")
+                    options.buildSystem = CodeGroupModels::BuildSystem::BAZEL;
+                else if (value == "both")
+                    options.buildSystem = CodeGroupModels::BuildSystem::BOTH;
+                else
+                    throw std::runtime_error("Unknown build system: " + value);
+            }
+            else if (key == "cmake")
+            {
+                // Select how the generated CMake build is laid out.
+                if (value == "subprojects")
+                    options.cmakeLayout = CodeGroupModels::CMakeLayout::SUBPROJECTS;
+                else if (value == "monolithic")
+                    options.cmakeLayout = CodeGroupModels::CMakeLayout::MONOLITHIC;
+                else
+                    throw std::runtime_error("Unknown cmake layout: " + value);
+            }
+            else if (key == "granularity")
+            {
+                // Select how DSL elements are distributed over translation units.
+                if (value == "entity")
+                    options.granularity = CodeGroupModels::TuGranularity::PER_ENTITY;
+                else if (value == "split")
+                    options.granularity = CodeGroupModels::TuGranularity::SPLIT;
+                else if (value == "balanced")
+                    options.granularity = CodeGroupModels::TuGranularity::BALANCED;
+                else
+                    throw std::runtime_error("Unknown granularity: " + value);
+            }
+            else if (key == "max_functions_per_file")
+            {
+                options.maxFunctionsPerFile = parseCount(key, value);
+            }
+            else if (key == "tu_cost")
+            {
+                options.targetTuCost = parseCount(key, value);
+                if (options.targetTuCost == 0)
+                    throw std::runtime_error("tu_cost must be greater than zero");
+            }
+            else if (key == "profiling")
+            {
+                options.profilingTools = ParserUtilities::parseFlag(key, value);
+            }
+            else if (key == "instrument")
+            {
+                options.instrument = ParserUtilities::parseFlag(key, value);
+            }
+            else if (key == "profiler")
+            {
+                options.profiler = ParserUtilities::parseFlag(key, value);
+            }
+            else if (key == "parameter_passing")
+            {
+                // Select how read-only parameters are passed in generated signatures.
+                if (value == "declared")
+                    options.passing = CodeGroupModels::PassingConvention::DECLARED;
+                else if (value == "const_ref")
+                    options.passing = CodeGroupModels::PassingConvention::CONST_REF;
+                else if (value == "string_view")
+                    options.passing = CodeGroupModels::PassingConvention::STRING_VIEW;
+                else
+                    throw std::runtime_error("Unknown parameter passing convention: " + value);
+            }
+            else if (key == "errors")
+            {
+                // Select how generated callables report errors.
+                if (value == "exceptions")
+                    options.errors = CodeGroupModels::ErrorHandling::EXCEPTIONS;
+                else if (value == "expected")
+                    options.errors = CodeGroupModels::ErrorHandling::EXPECTED;
+                else
+                    throw std::runtime_error("Unknown error handling: " + value);
+            }
             else
             {
                 throw std::runtime_error("Unknown property in project block: " + key);
             }
         }
 
+        // The profiling library reports failures to open its trace file with exceptions.
+        if (options.profiler && options.errors == CodeGroupModels::ErrorHandling::EXPECTED)
+            throw std::runtime_error("profiler = true cannot be combined with errors = expected");
+
         // The remainder of the project block contains nested DSL elements.
         std::vector<CodeGroupModels::FolderModel> subFolders;
         std::vector<ClassModels::ClassModel> classFiles;
@@ -173,7 +285,7 @@ namespace ProjectParser
 
         // Construct and return the ProjectModel.
         return CodeGroupModels::ProjectModel(projectName, version, dependencies, libraries,
-                                             subFolders, classFiles, namespaceFiles, functionFile);
+                                             subFolders, classFiles, namespaceFiles, functionFile, options);
     }
 
 } // namespace ProjectParser
@@ -165,6 +165,43 @@ namespace PropertiesParser
         return tD;
     }
 
+    // Parse trailing annotations from the provided string view.
+    PropertiesModels::Annotation parseAnnotations(std::string_view &typeStr)
+    {
+        using PropertiesModels::Annotation;
+        Annotation annotations = Annotation::NONE;
+
+        size_t atPos = typeStr.find('@');
+        if (atPos == std::string_view::npos)
+            return annotations;
+
+        // Every whitespace-separated token after the type must be an annotation.
+        std::string_view annotationStr = typeStr.substr(atPos);
+        typeStr = ParserUtilities::trim(typeStr.substr(0, atPos));
+        for (auto token : ParserUtilities::split(annotationStr, ' '))
+        {
+            token = ParserUtilities::trim(token);
+            if (token.empty())
+                continue;
+            if (token == "@hot")
+                annotations = annotations | Annotation::HOT;
+            else if (token == "@cold")
+                annotations = annotations | Annotation::COLD;
+            else if (token == "@own_cacheline")
+                annotations = annotations | Annotation::OWN_CACHELINE;
+            else if (token == "@sink")
+                annotations = annotations | Annotation::SINK;
+            else
+                throw std::runtime_error("Unknown annotation: " + std::string(token));
+        }
+
+        if (PropertiesModels::hasAnnotation(annotations, Annotation::HOT) &&
+            PropertiesModels::hasAnnotation(annotations, Annotation::COLD))
+            throw std::runtime_error("A member cannot be both @hot and @cold.");
+
+        return annotations;
+    }
+
     // Parse a comma-separated list of parameters from the provided string view.
     std::vector<PropertiesModels::Parameter> parseParameters(std::string_view paramStr)
     {
@@ -172,26 +209,9 @@ namespace PropertiesParser
         // Trim whitespace from the entire parameter string.
         paramStr = ParserUtilities::trim(paramStr);
 
-        // Process each parameter token until the string is exhausted.
-        while (!paramStr.empty())
+        // Process each parameter token; commas inside template-ids do not separate parameters.
+        for (auto token : ParserUtilities::splitTopLevel(paramStr, ','))
         {
-            // Find the next comma that separates parameters.
-            size_t commaPos = paramStr.find(',');
-            std::string_view token;
-            if (commaPos == std::string_view::npos)
-            {
-                // If no comma, the remaining string is one token.
-                token = paramStr;
-                paramStr.remove_prefix(paramStr.size());
-            }
-            else
-            {
-                // Extract the token before the comma.
-                token = paramStr.substr(0, commaPos);
-                // Remove the token and the comma from the parameter string.
-                paramStr.remove_prefix(commaPos + 1);
-            }
-
             // Trim the token.
             token = ParserUtilities::trim(token);
             // Find the colon that separates the parameter name and its type.
@@ -207,13 +227,54 @@ namespace PropertiesParser
             // Extract and trim the parameter type.
             std::string_view paramType = ParserUtilities::trim(token.substr(colonPos + 1));
 
+            // Strip any annotations following the type.
+            auto annotations = parseAnnotations(paramType);
+
             // Create a Parameter object and add it to the list.
-            params.emplace_back(PropertiesModels::Parameter(parseDataType(paramType), std::string(paramName)));
+            params.emplace_back(PropertiesModels::Parameter(parseDataType(paramType), std::string(paramName), annotations));
         }
 
         return params;
     }
 
+    // Parse a comma-separated list of template parameter declarations from the provided string view.
+    std::vector<std::string> parseTemplateParameters(std::string_view paramStr)
+    {
+        std::vector<std::string> params;
+        for (auto token : ParserUtilities::splitTopLevel(paramStr, ','))
+        {
+            token = ParserUtilities::trim(token);
+            // Packs cannot be matched against a fixed list of instantiation arguments.
+            if (token.find("...") != std::string_view::npos)
+                throw std::runtime_error("Template parameter packs are not supported: " + std::string(token));
+            // Every parameter needs a kind or type followed by a name, e.g. "typename T".
+            size_t spacePos = token.find_last_of(' ');
+            if (spacePos == std::string_view::npos || spacePos + 1 == token.size())
+                throw std::runtime_error("Invalid template parameter; expected e.g. 'typename T': " + std::string(token));
+            params.emplace_back(token);
+        }
+        if (params.empty())
+            throw std::runtime_error("Template parameter list is empty.");
+        return params;
+    }
+
+    // Parse a semicolon-separated list of template argument lists from the provided string view.
+    std::vector<std::string> parseTemplateInstantiations(std::string_view argStr, const size_t arity)
+    {
+        std::vector<std::string> instantiations;
+        for (auto token : ParserUtilities::splitTopLevel(argStr, ';'))
+        {
+            token = ParserUtilities::trim(token);
+            if (token.empty())
+                continue;
+            if (ParserUtilities::splitTopLevel(token, ',').size() != arity)
+                throw std::runtime_error("Instantiation <" + std::string(token) + "> does not match " +
+                                         std::to_string(arity) + " template parameter(s).");
+            instantiations.emplace_back(token);
+        }
+        return instantiations;
+    }
+
     // Parse declaration specifiers from the provided string view.
     PropertiesModels::DeclartionSpecifier parseDeclarationSpecifier(std::string_view declStr)
     {
@@ -2,6 +2,7 @@
 #include "ParserUtilities.h"
 #include "PropertiesParser.h"
 
+#include <optional>
 #include <stdexcept>
 #include <string>
 
@@ -26,6 +27,7 @@ namespace SpecialMemberFunctionParser
         // Prepare containers for parsed parameters and description.
         std::vector<PropertiesModels::Parameter> parameters;
         std::string description;
+        std::optional<bool> isNoexcept;
 
         // Consume property lines until an end-of-scope marker ("_") is reached.
         while (!propertyLines.empty())
@@ -67,6 +69,10 @@ namespace SpecialMemberFunctionParser
                 }
                 description = std::string(ParserUtilities::trim(value));
             }
+            else if (key == "noexcept")
+            {
+                isNoexcept = ParserUtilities::parseFlag(std::string(key), value);
+            }
             else
             {
                 throw std::runtime_error("Unrecognized property in constructor block: " + std::string(key));
@@ -83,7 +89,7 @@ namespace SpecialMemberFunctionParser
         }
 
         // Return a fully constructed Constructor model.
-        return ClassModels::Constructor(type, parameters, description);
+        return ClassModels::Constructor(type, parameters, description, isNoexcept);
     }
 
     ClassModels::Destructor parseDestructorProperties(std::deque<std::string_view> &propertyLines)
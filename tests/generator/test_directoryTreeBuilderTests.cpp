@@ -787,3 +787,249 @@ TEST(DirectoryTreeBuilderTests, EdgeCase_DuplicateClassNamesDifferentScopes)
     ASSERT_EQ(metadata.libraries.size(), 1);
     EXPECT_EQ(metadata.libraries["proj"].name, "ScopeProject");
 }
+
+TEST(DirectoryTreeBuilderTests, RecordsTranslationUnitsPerLibrary)
+{
+    // Compiled library, header-only library and a project-level class.
+    LibraryModel core("Core", "1.0", {}, {}, {createDummyClass("Engine")}, {}, {createDummyFunction("tick")});
+    LibraryModel math("Math", "1.0", {}, {}, {createDummyClass("Vector")}, {}, {}, LibraryMode::HEADER_ONLY);
+    ProjectModel model("MyProject", "1.0", {}, {core, math}, {}, {createDummyClass("App")});
+
+    ProjMetadata metadata({});
+    auto root = buildDirectoryTree(model, metadata);
+    ASSERT_NE(root, nullptr);
+
+    EXPECT_EQ(metadata.libraries["proj"].translationUnits, std::vector<std::string>({"ROOT/App"}));
+    EXPECT_EQ(metadata.libraries["Core"].translationUnits,
+              std::vector<std::string>({"ROOT/Core/Engine", "ROOT/Core/CoreFreeFunctions"}));
+    // Header-only libraries contribute no translation units.
+    EXPECT_TRUE(metadata.libraries["Math"].translationUnits.empty());
+}
+
+// Utility to collect the generated base file paths of a node's files, in order.
+std::vector<std::string> collectFilePaths(const std::shared_ptr<DirectoryNode> &node)
+{
+    std::vector<std::string> out;
+    for (const auto &file : node->getFileNodes())
+    {
+        out.push_back(file->generateFiles().baseFilePath);
+    }
+    return out;
+}
+
+TEST(DirectoryTreeBuilderTests, Granularity_SplitNamespacePerClass)
+{
+    NamespaceModel ns = createDummyNamespace("Net");
+    ns.classes = {createDummyClass("Client"), createDummyClass("Server")};
+    ns.functions = {createDummyFunction("connect")};
+
+    ProjectOptions options;
+    options.granularity = TuGranularity::SPLIT;
+    ProjectModel model("MyProject", "1.0", {}, {}, {}, {}, {ns}, {}, options);
+
+    ProjMetadata metadata({});
+    auto root = buildDirectoryTree(model, metadata);
+
+    // Each class gets its own file wrapped in the namespace; functions stay in the namespace file.
+    EXPECT_EQ(collectFilePaths(root), std::vector<std::string>({"ROOT/NetClient", "ROOT/NetServer", "ROOT/Net"}));
+    EXPECT_EQ(metadata.libraries["proj"].translationUnits.size(), 3);
+    EXPECT_NE(root->getFileNodes()[0]->generateFiles().headerContent.find("namespace Net {"), std::string::npos);
+    // Without enumerations the class files do not depend on the namespace file.
+    EXPECT_EQ(root->getFileNodes()[0]->generateFiles().headerContent.find("#include \"Net.h\""), std::string::npos);
+}
+
+TEST(DirectoryTreeBuilderTests, Granularity_SplitClassesIncludeNamespaceEnums)
+{
+    NamespaceModel ns = createDummyNamespace("Core");
+    ClassModels::ClassModel entry = createDummyClass("StoreEntry");
+    entry.publicMembers = PropertiesParser::parseParameters("side:Side, quantity:int");
+    ns.classes = {entry};
+    ns.functions = {};
+    ns.namespaces = {};
+    ns.enums = {EnumModels::EnumModel{"Side", "", {"BUY", "SELL"}, ""}};
+
+    ProjectOptions options;
+    options.granularity = TuGranularity::SPLIT;
+    ProjectModel model("MyProject", "1.0", {}, {}, {}, {}, {ns}, {}, options);
+
+    ProjMetadata metadata({});
+    auto root = buildDirectoryTree(model, metadata);
+
+    // The enumeration stays in Core.h, which the class file includes ahead of its other headers.
+    ASSERT_EQ(collectFilePaths(root), std::vector<std::string>({"ROOT/CoreStoreEntry", "ROOT/Core"}));
+    const std::string classHeader = root->getFileNodes()[0]->generateFiles().headerContent;
+    EXPECT_EQ(classHeader.find("#include \"Core.h\"\n"), 0);
+    EXPECT_EQ(classHeader.find("enum class Side"), std::string::npos);
+    EXPECT_NE(root->getFileNodes()[1]->generateFiles().headerContent.find("enum class Side"), std::string::npos);
+}
+
+TEST(DirectoryTreeBuilderTests, Granularity_BalancedMergesTinyClasses)
+{
+    ProjectOptions options;
+    options.granularity = TuGranularity::BALANCED;
+    options.targetTuCost = 8; // Four units of content per file after the TU overhead.
+
+    // Each dummy class costs two units, so two fit per merged file.
+    ProjectModel model("MyProject", "1.0", {}, {}, {}, {createDummyClass("A"), createDummyClass("B"), createDummyClass("C")}, {}, {}, options);
+
+    ProjMetadata metadata({});
+    auto root = buildDirectoryTree(model, metadata);
+
+    auto paths = collectFilePaths(root);
+    EXPECT_EQ(paths, std::vector<std::string>({"ROOT/ROOTClasses", "ROOT/C"}));
+
+    // The merged file carries both classes in one translation unit.
+    auto merged = root->getFileNodes()[0]->generateFiles();
+    EXPECT_NE(merged.headerContent.find("class A {"), std::string::npos);
+    EXPECT_NE(merged.headerContent.find("class B {"), std::string::npos);
+    EXPECT_NE(merged.sourceContent.find("A::A(const A& other)"), std::string::npos);
+    EXPECT_NE(merged.sourceContent.find("B::B(const B& other)"), std::string::npos);
+}
+
+TEST(DirectoryTreeBuilderTests, Granularity_BalancedOnlySplitsOversizedNamespaces)
+{
+    // Namespaces holding only classes; the large one costs six units, over the target of five.
+    NamespaceModel small{"Small", "", {createDummyClass("One")}, {}, {}};
+    NamespaceModel large{"Large", "", {createDummyClass("X"), createDummyClass("Y"), createDummyClass("Z")}, {}, {}};
+
+    ProjectOptions options;
+    options.granularity = TuGranularity::BALANCED;
+    options.targetTuCost = 5;
+    ProjectModel model("MyProject", "1.0", {}, {}, {}, {}, {small, large}, {}, options);
+
+    ProjMetadata metadata({});
+    auto root = buildDirectoryTree(model, metadata);
+
+    EXPECT_EQ(collectFilePaths(root), std::vector<std::string>({"ROOT/Small", "ROOT/LargeX", "ROOT/LargeY", "ROOT/LargeZ"}));
+}
+
+TEST(DirectoryTreeBuilderTests, Granularity_FunctionCapSpreadsEvenly)
+{
+    ProjectOptions options;
+    options.maxFunctionsPerFile = 2;
+    FolderModel folder("Utils", {}, {}, {},
+                       {createDummyFunction("a"), createDummyFunction("b"), createDummyFunction("c"),
+                        createDummyFunction("d"), createDummyFunction("e")});
+    ProjectModel model("MyProject", "1.0", {}, {}, {folder}, {}, {}, {}, options);
+
+    ProjMetadata metadata({});
+    auto root = buildDirectoryTree(model, metadata);
+    ASSERT_EQ(root->getSubDirectories().size(), 1);
+    const auto &utils = root->getSubDirectories()[0];
+
+    EXPECT_EQ(collectFilePaths(utils), std::vector<std::string>({"ROOT/Utils/UtilsFreeFunctions",
+                                                                 "ROOT/Utils/UtilsFreeFunctions2",
+                                                                 "ROOT/Utils/UtilsFreeFunctions3"}));
+    auto first = utils->getFileNodes()[0]->generateFiles();
+    EXPECT_NE(first.headerContent.find("a();"), std::string::npos);
+    EXPECT_NE(first.headerContent.find("b();"), std::string::npos);
+    EXPECT_EQ(first.headerContent.find("c();"), std::string::npos);
+}
+
+TEST(DirectoryTreeBuilderTests, RegistersSerializationSupportAndTests)
+{
+    ClassModels::ClassModel point = createDummyClass("Point");
+    point.options.serialize = ClassModels::SerializationFormat::BINARY;
+    // Tests need a default-constructible class.
+    point.constructors.clear();
+    ClassModels::ClassModel sample = createDummyClass("Sample");
+    sample.options.serialize = ClassModels::SerializationFormat::BINARY;
+    sample.constructors.clear();
+    LibraryModel core("Core", "1.0", {}, {}, {sample}, {}, {});
+    ProjectModel model("MyProject", "1.0", {}, {core}, {}, {point});
+
+    ProjMetadata metadata({});
+    auto root = buildDirectoryTree(model, metadata);
+    ASSERT_NE(root, nullptr);
+
+    // The support header is written once, however many classes use it.
+    std::vector<std::string> paths;
+    for (const auto &file : metadata.supportFiles)
+    {
+        paths.push_back(file.relativePath);
+    }
+    EXPECT_EQ(std::count(paths.begin(), paths.end(), "include/BinarySerialization.h"), 1);
+    EXPECT_NE(std::find(paths.begin(), paths.end(), "tests/PointSerializationTest.cpp"), paths.end());
+    EXPECT_NE(std::find(paths.begin(), paths.end(), "benchmarks/SampleSerializationBenchmark.cpp"), paths.end());
+
+    ASSERT_EQ(metadata.tests.size(), 4);
+    EXPECT_EQ(metadata.tests[0].name, "SampleSerializationTest");
+    EXPECT_EQ(metadata.tests[0].library, "Core");
+    EXPECT_FALSE(metadata.tests[0].isProjLevel);
+    EXPECT_TRUE(metadata.tests[1].isBenchmark);
+    EXPECT_EQ(metadata.tests[2].name, "PointSerializationTest");
+    EXPECT_TRUE(metadata.tests[2].isProjLevel);
+}
+
+TEST(DirectoryTreeBuilderTests, RegistersPoolSupportAndBenchmark)
+{
+    ClassModels::ClassModel order = createDummyClass("Order");
+    order.options.pooled = true;
+    order.constructors.clear();
+    ProjectModel model("MyProject", "1.0", {}, {}, {}, {order});
+
+    ProjMetadata metadata({});
+    auto root = buildDirectoryTree(model, metadata);
+    ASSERT_NE(root, nullptr);
+
+    ASSERT_EQ(metadata.supportFiles.size(), 2);
+    EXPECT_EQ(metadata.supportFiles[0].relativePath, "include/ObjectPool.h");
+    EXPECT_EQ(metadata.supportFiles[1].relativePath, "benchmarks/OrderPoolBenchmark.cpp");
+    ASSERT_EQ(metadata.tests.size(), 1);
+    EXPECT_TRUE(metadata.tests[0].isBenchmark);
+    EXPECT_TRUE(metadata.tests[0].isProjLevel);
+}
+
+TEST(DirectoryTreeBuilderTests, RecordsOwnCachelineMembers)
+{
+    ClassModels::ClassModel counter = createDummyClass("Counter");
+    ProjectModel plain("MyProject", "1.0", {}, {}, {}, {counter});
+    ProjMetadata plainMetadata({});
+    ASSERT_NE(buildDirectoryTree(plain, plainMetadata), nullptr);
+    EXPECT_FALSE(plainMetadata.ownCacheline);
+
+    counter.privateMembers = PropertiesParser::parseParameters("hits:long @own_cacheline, misses:long");
+    ProjectModel model("MyProject", "1.0", {}, {}, {}, {counter});
+    ProjMetadata metadata({});
+    ASSERT_NE(buildDirectoryTree(model, metadata), nullptr);
+    EXPECT_TRUE(metadata.ownCacheline);
+}
+
+TEST(DirectoryTreeBuilderTests, RegistersTracingSupportForInstrumentedLibraries)
+{
+    ClassModels::ClassModel engine = createDummyClass("Engine");
+    engine.publicMethods = {CallableModels::MethodModel(PropertiesModels::DataType(PropertiesModels::Types::VOID), "update", {},
+                                                        PropertiesModels::DeclartionSpecifier())};
+    LibraryModel core("Core", "1.0", {}, {}, {engine}, {}, {}, LibraryMode::COMPILED, true);
+    ProjectModel model("MyProject", "1.0", {}, {core}, {}, {});
+
+    ProjMetadata metadata({});
+    auto root = buildDirectoryTree(model, metadata);
+    ASSERT_NE(root, nullptr);
+
+    EXPECT_TRUE(metadata.tracing);
+    ASSERT_EQ(metadata.supportFiles.size(), 1);
+    EXPECT_EQ(metadata.supportFiles[0].relativePath, "include/Tracing.h");
+    EXPECT_NE(metadata.supportFiles[0].content.find("MYPROJECT_ENABLE_TRACING"), std::string::npos);
+}
+
+TEST(DirectoryTreeBuilderTests, RegistersProfilerLibrary)
+{
+    ProjectModel model("MyProject", "1.0", {}, {}, {}, {createDummyClass("Engine")});
+    model.options.profiler = true;
+
+    ProjMetadata metadata({});
+    auto root = buildDirectoryTree(model, metadata);
+    ASSERT_NE(root, nullptr);
+
+    ASSERT_EQ(metadata.supportFiles.size(), 2);
+    EXPECT_EQ(metadata.supportFiles[0].relativePath, "include/profiling/Profiler.h");
+    EXPECT_EQ(metadata.supportFiles[1].relativePath, "src/profiling/Profiler.cpp");
+
+    // A library of the same name would share its folders.
+    LibraryModel clash("profiling", "1.0", {});
+    ProjectModel clashing("MyProject", "1.0", {}, {clash}, {}, {});
+    clashing.options.profiler = true;
+    ProjMetadata clashMetadata({});
+    EXPECT_THROW(buildDirectoryTree(clashing, clashMetadata), std::runtime_error);
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "AllocatorGenerator.h"
+#include "ClassGenerator.h"
+#include "PropertiesParser.h"
+#include "testUtility.h"
+
+using PropertiesModels::DataType;
+using PropertiesModels::Types;
+
+namespace
+{
+    // An allocator-aware class with a custom constructor initialising some of its members.
+    ClassModels::ClassModel makeRecord()
+    {
+        ClassModels::ClassOptions options;
+        options.allocator = ClassModels::AllocatorPolicy::PMR;
+        ClassModels::Constructor ctor(ClassModels::ConstructorType::CUSTOM,
+                                      PropertiesParser::parseParameters("name:string, id:int"), "");
+        return ClassModels::ClassModel("Record", "A record", {ctor}, std::nullopt,
+                                       makeEmptyMethods(), makeEmptyMethods(), makeEmptyMethods(), {},
+                                       PropertiesParser::parseParameters("name:string, id:int, tags:std::vector<std::string>, config:Config"),
+                                       makeEmptyMembers(), false, false, options);
+    }
+}
+
+TEST(AllocatorGeneratorTest, RewritesStandardTypesToPmr) {
+    using AllocatorGenerator::pmrType;
+    EXPECT_EQ(*pmrType(DataType(Types::STRING)).customType, "std::pmr::string");
+    EXPECT_EQ(*pmrType(DataType(Types::CUSTOM, std::string("std::unordered_map<std::string, std::vector<int>>"), PropertiesModels::TypeQualifier::NONE)).customType,
+              "std::pmr::unordered_map<std::pmr::string, std::pmr::vector<int>>");
+    EXPECT_EQ(*pmrType(DataType(Types::CUSTOM, std::string("std::string_view"), PropertiesModels::TypeQualifier::NONE)).customType, "std::string_view");
+    EXPECT_EQ(pmrType(DataType(Types::INT)).type, Types::INT);
+}
+
+TEST(AllocatorGeneratorTest, DeclaresAllocatorSupport) {
+    std::string decl = ClassGenerator::generateClassDeclaration(makeRecord());
+    EXPECT_NE(decl.find("public:\n    using allocator_type = std::pmr::polymorphic_allocator<>;"), std::string::npos);
+    // Without a declared default constructor the allocator-extended one stands in for it.
+    EXPECT_NE(decl.find("explicit Record(const allocator_type& alloc = {});"), std::string::npos);
+    EXPECT_NE(decl.find("Record(const Record& other, const allocator_type& alloc);"), std::string::npos);
+    EXPECT_NE(decl.find("Record(Record&& other, const allocator_type& alloc);"), std::string::npos);
+    EXPECT_NE(decl.find("Record(std::pmr::string name, int id, const allocator_type& alloc = {});"), std::string::npos);
+    EXPECT_NE(decl.find("std::pmr::vector<std::pmr::string> tags;"), std::string::npos);
+}
+
+TEST(AllocatorGeneratorTest, DefinitionsPassAllocatorToMembers) {
+    std::string defs = ClassGenerator::generateClassDefinition(makeRecord());
+    EXPECT_NE(defs.find("Record::Record(std::pmr::string name, int id, const allocator_type& alloc) : name(std::move(name), alloc), "
+                        "id(id), tags(alloc), config(std::make_obj_using_allocator<Config>(alloc))\n{\n}\n"),
+              std::string::npos);
+    EXPECT_NE(defs.find("Record::Record(const Record& other, const allocator_type& alloc) : name(other.name, alloc), id(other.id), "
+                        "tags(other.tags, alloc), config(std::make_obj_using_allocator<Config>(alloc, other.config))\n{\n}\n"),
+              std::string::npos);
+    EXPECT_NE(defs.find("tags(std::move(other.tags), alloc)"), std::string::npos);
+    EXPECT_EQ(defs.find("Not implemented"), std::string::npos);
+
+    auto headers = ClassGenerator::requiredHeaders(makeRecord());
+    for (const std::string header : {"<memory_resource>", "<memory>", "<vector>", "<utility>"})
+        EXPECT_TRUE(headers.contains(header)) << header;
+    // std::pmr::string needs <string>, which the header preamble already includes.
+    EXPECT_TRUE(AllocatorGenerator::requiredHeaders(AllocatorGenerator::applyAllocator(makeRecord())).contains("<string>"));
+    EXPECT_FALSE(headers.contains("<string>"));
+}
+
+TEST(AllocatorGeneratorTest, DefaultAllocatorLeavesClassUnchanged) {
+    auto record = makeRecord();
+    record.options.allocator = ClassModels::AllocatorPolicy::STD;
+    EXPECT_EQ(ClassGenerator::generateClassDeclaration(record).find("allocator_type"), std::string::npos);
+    EXPECT_TRUE(AllocatorGenerator::requiredHeaders(record).empty());
+}
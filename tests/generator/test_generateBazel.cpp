@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "BuildToolsGenerator.h"
+#include "ProjectMetadata.h"
+#include "testUtility.h"
+
+using namespace BuildToolGenerator;
+using namespace ProjectMetadata;
+
+// Builds metadata for a project with a root class, a compiled library and a header-only library.
+static ProjMetadata makeBazelMetadata()
+{
+    LibraryMetadata projLib("ROOT", "MyProject", true, {"Boost::boost"});
+    projLib.translationUnits = {"ROOT/App"};
+    projLib.headers = {"ROOT/App"};
+
+    LibraryMetadata coreLib("ROOT/Core", "Core", false, {"Eigen3::Eigen"});
+    coreLib.subDirectories = {"", "ROOT/Core", "ROOT/Core/Utils"};
+    coreLib.translationUnits = {"ROOT/Core/Utils/Logger"};
+    coreLib.headers = {"ROOT/Core/Utils/Logger"};
+
+    LibraryMetadata mathLib("ROOT/Math", "Math", false, {}, true);
+    mathLib.subDirectories = {"ROOT/Math"};
+    mathLib.headers = {"ROOT/Math/Vector"};
+
+    ProjMetadata meta;
+    meta.libraries["proj"] = projLib;
+    meta.libraries["Core"] = coreLib;
+    meta.libraries["Math"] = mathLib;
+    return meta;
+}
+
+TEST(BazelGeneratorTest, LibrariesListExactFiles) {
+    std::string build = generateBazelFiles(makeBazelMetadata(), "1.0.0").first;
+
+    EXPECT_TRUE(contains(build, "load(\"@rules_cc//cc:defs.bzl\", \"cc_binary\", \"cc_library\")"));
+    EXPECT_TRUE(contains(build, "cc_library(\n    name = \"Core\",\n"
+                                "    srcs = [\n        \"src/Core/Utils/Logger.cpp\",\n    ],\n"
+                                "    hdrs = [\n        \"include/Core/Utils/Logger.h\",\n    ],\n"
+                                "    includes = [\n        \"include\",\n        \"include/Core\",\n        \"include/Core/Utils\",\n    ],\n"));
+    // Header-only libraries have no srcs.
+    EXPECT_TRUE(contains(build, "cc_library(\n    name = \"Math\",\n    hdrs = [\n        \"include/Math/Vector.h\",\n    ],\n"));
+}
+
+TEST(BazelGeneratorTest, MainBinaryDependsOnProjectAndLibraries) {
+    std::string build = generateBazelFiles(makeBazelMetadata(), "1.0.0").first;
+
+    EXPECT_TRUE(contains(build, "name = \"MyProject_lib\""));
+    EXPECT_TRUE(contains(build, "    deps = [\n        \":Core\",\n        \":Math\",\n    ],\n"));
+    EXPECT_TRUE(contains(build, "cc_binary(\n    name = \"MyProject\",\n    srcs = [\"src/main.cpp\"],\n    deps = [\":MyProject_lib\"],\n"));
+    // Libraries are emitted in name order.
+    EXPECT_LT(build.find("name = \"Core\""), build.find("name = \"Math\""));
+}
+
+TEST(BazelGeneratorTest, ModuleFileDeclaresRulesAndListsExternalDeps) {
+    std::string module = generateBazelFiles(makeBazelMetadata(), "1.0.0").second;
+
+    EXPECT_TRUE(contains(module, "module(\n    name = \"myproject\",\n    version = \"1.0.0\",\n)"));
+    EXPECT_TRUE(contains(module, "bazel_dep(name = \"rules_cc\""));
+    EXPECT_TRUE(contains(module, "# - Boost::boost\n# - Eigen3::Eigen\n"));
+}
+
+TEST(BazelGeneratorTest, SupportHeadersAndTestsGetTheirOwnRules) {
+    ProjMetadata meta = makeBazelMetadata();
+    meta.supportFiles = {{"include/BinarySerialization.h", ""}, {"tests/LoggerSerializationTest.cpp", ""}};
+    meta.tests = {{"LoggerSerializationBenchmark", "benchmarks/LoggerSerializationBenchmark.cpp", "Core", false, true}};
+    std::string build = generateBazelFiles(meta, "1.0.0").first;
+
+    EXPECT_TRUE(contains(build, "load(\"@rules_cc//cc:defs.bzl\", \"cc_binary\", \"cc_library\", \"cc_test\")"));
+    EXPECT_TRUE(contains(build, "cc_library(\n    name = \"MyProject_support\",\n"
+                                "    hdrs = [\n        \"include/BinarySerialization.h\",\n    ],\n"));
+    EXPECT_TRUE(contains(build, "        \":MyProject_support\",\n"));
+    EXPECT_TRUE(contains(build, "cc_test(\n    name = \"LoggerSerializationBenchmark\",\n"
+                                "    srcs = [\n        \"benchmarks/LoggerSerializationBenchmark.cpp\",\n    ],\n"
+                                "    deps = [\n        \":Core\",\n    ],\n"));
+    EXPECT_TRUE(contains(build, "    tags = [\n        \"benchmark\",\n    ],\n"));
+}
+
+TEST(BazelGeneratorTest, ProfilerGetsItsOwnRule) {
+    ProjMetadata meta = makeBazelMetadata();
+    meta.options.profiler = true;
+    meta.supportFiles = {{"include/profiling/Profiler.h", ""}, {"src/profiling/Profiler.cpp", ""}};
+    std::string build = generateBazelFiles(meta, "1.0.0").first;
+
+    EXPECT_TRUE(contains(build, "cc_library(\n    name = \"profiling\",\n"
+                                "    srcs = [\n        \"src/profiling/Profiler.cpp\",\n    ],\n"
+                                "    hdrs = [\n        \"include/profiling/Profiler.h\",\n    ],\n"));
+    EXPECT_TRUE(contains(build, "    linkopts = [\n        \"-pthread\",\n    ],\n"));
+    // The profiling header is not a support header; every library links the profiler instead.
+    EXPECT_FALSE(contains(build, "MyProject_support"));
+    EXPECT_TRUE(contains(build, "    deps = [\n        \":profiling\",\n    ],\n"));
+}
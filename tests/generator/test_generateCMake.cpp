@@ -161,4 +161,181 @@ TEST(CMakeGeneratorTest, LibraryWithoutDependencies) {
     EXPECT_TRUE(contains(cmakeFile, "add_library(LibNoDep"));
     // Ensure that no dependency commands are generated for LibNoDep.
     EXPECT_FALSE(contains(cmakeFile, "find_package(")); // At least for LibNoDep block.
-}
\ No newline at end of file
+}
+TEST(CMakeGeneratorTest, HeaderOnlyLibraryIsInterfaceTarget) {
+    LibraryMetadata projLib("ROOT", "MyProject", true, {});
+    projLib.subDirectories = {"ROOT"};
+
+    // Header-only library with a dependency.
+    LibraryMetadata headerLib("ROOT/MathLib", "MathLib", false, {"Eigen3::Eigen"}, true);
+    headerLib.subDirectories = {"MathLib"};
+
+    ProjMetadata meta;
+    meta.libraries["proj"] = projLib;
+    meta.libraries["MathLib"] = headerLib;
+
+    std::string cmakeFile = BuildToolGenerator::generateCmakeLists(meta);
+
+    // No sources are globbed; the target propagates usage requirements only.
+    EXPECT_TRUE(contains(cmakeFile, "add_library(MathLib INTERFACE)"));
+    EXPECT_FALSE(contains(cmakeFile, "MathLib_SOURCES"));
+    EXPECT_TRUE(contains(cmakeFile, "target_include_directories(MathLib INTERFACE ${CMAKE_SOURCE_DIR}/include/MathLib/)"));
+    EXPECT_TRUE(contains(cmakeFile, "target_link_libraries(MathLib INTERFACE Eigen3::Eigen)"));
+    // The executable still links against it like any other library.
+    EXPECT_TRUE(contains(cmakeFile, "target_link_libraries(${MAIN_TARGET} PUBLIC MathLib)"));
+}
+
+TEST(CMakeGeneratorTest, SubprojectLayoutAddsLibrariesAsSubdirectories) {
+    LibraryMetadata projLib("ROOT", "MyProject", true, {});
+    projLib.subDirectories = {"ROOT"};
+
+    LibraryMetadata coreLib("ROOT/CoreLib", "CoreLib", false, {"Eigen3::Eigen"});
+    coreLib.subDirectories = {"CoreLib", "CoreLib/Utils"};
+
+    ProjMetadata meta;
+    meta.libraries["proj"] = projLib;
+    meta.libraries["CoreLib"] = coreLib;
+    meta.options.cmakeLayout = CodeGroupModels::CMakeLayout::SUBPROJECTS;
+
+    // The top-level file delegates the library target to its subproject.
+    std::string cmakeFile = BuildToolGenerator::generateCmakeLists(meta);
+    EXPECT_TRUE(contains(cmakeFile, "add_subdirectory(src/CoreLib)"));
+    EXPECT_FALSE(contains(cmakeFile, "CoreLib_SOURCES"));
+    EXPECT_TRUE(contains(cmakeFile, "target_link_libraries(${MAIN_TARGET} PUBLIC CoreLib)"));
+
+    auto subprojects = BuildToolGenerator::generateLibraryCmakeLists(meta);
+    ASSERT_EQ(subprojects.size(), 1);
+    EXPECT_EQ(subprojects[0].first, "CoreLib");
+
+    // The subproject is standalone and exports its target under the project namespace.
+    const std::string &libCmake = subprojects[0].second;
+    EXPECT_TRUE(contains(libCmake, "project(CoreLib LANGUAGES CXX)"));
+    EXPECT_TRUE(contains(libCmake, "file(GLOB_RECURSE CoreLib_SOURCES CONFIGURE_DEPENDS \"${CMAKE_CURRENT_SOURCE_DIR}/*.cpp\")"));
+    EXPECT_TRUE(contains(libCmake, "add_library(MyProject::CoreLib ALIAS CoreLib)"));
+    EXPECT_TRUE(contains(libCmake, "target_include_directories(CoreLib PUBLIC $<BUILD_INTERFACE:${CoreLib_ROOT}/include/CoreLib/Utils/> "
+                                   "$<INSTALL_INTERFACE:${CMAKE_INSTALL_INCLUDEDIR}/CoreLib/Utils>)"));
+    EXPECT_TRUE(contains(libCmake, "target_link_libraries(CoreLib PUBLIC Eigen3::Eigen)"));
+    EXPECT_TRUE(contains(libCmake, "install(EXPORT CoreLibTargets NAMESPACE MyProject::"));
+    EXPECT_TRUE(contains(libCmake, "export(EXPORT CoreLibTargets NAMESPACE MyProject::"));
+}
+
+TEST(CMakeGeneratorTest, SubprojectsInstallAConsumablePackage) {
+    LibraryMetadata projLib("ROOT", "MyProject", true, {});
+    LibraryMetadata coreLib("ROOT/CoreLib", "CoreLib", false, {"Eigen3::Eigen"}, false, false, "1.2.3");
+    coreLib.subDirectories = {"", "CoreLib"};
+
+    ProjMetadata meta;
+    meta.libraries["proj"] = projLib;
+    meta.libraries["CoreLib"] = coreLib;
+    meta.options.cmakeLayout = CodeGroupModels::CMakeLayout::SUBPROJECTS;
+    meta.supportFiles = {{"include/BinarySerialization.h", ""}, {"include/ValueHash.h", ""}, {"tests/EntryTest.cpp", ""}};
+
+    const std::string libCmake = BuildToolGenerator::generateLibraryCmakeLists(meta)[0].second;
+    // Consumers compile as C++23 and find the support headers next to the library's own.
+    EXPECT_TRUE(contains(libCmake, "target_compile_features(CoreLib PUBLIC cxx_std_23)"));
+    EXPECT_TRUE(contains(libCmake, "target_include_directories(CoreLib PUBLIC $<BUILD_INTERFACE:${CoreLib_ROOT}/include> "
+                                   "$<INSTALL_INTERFACE:${CMAKE_INSTALL_INCLUDEDIR}>)"));
+    EXPECT_FALSE(contains(libCmake, "include//"));
+    EXPECT_TRUE(contains(libCmake, "install(FILES ${CoreLib_ROOT}/include/BinarySerialization.h ${CoreLib_ROOT}/include/ValueHash.h "
+                                   "DESTINATION ${CMAKE_INSTALL_INCLUDEDIR})"));
+
+    // The package configuration finds the dependencies and is installed next to the targets file.
+    EXPECT_TRUE(contains(libCmake, "include(CMakePackageConfigHelpers)"));
+    EXPECT_TRUE(contains(libCmake, "find_dependency(Eigen3)"));
+    EXPECT_TRUE(contains(libCmake, "include(\\\"\\${CMAKE_CURRENT_LIST_DIR}/CoreLibTargets.cmake\\\")"));
+    EXPECT_TRUE(contains(libCmake, "configure_package_config_file(${CMAKE_CURRENT_BINARY_DIR}/CoreLibConfig.cmake.in"));
+    EXPECT_TRUE(contains(libCmake, "VERSION 1.2.3 COMPATIBILITY SameMajorVersion"));
+    EXPECT_TRUE(contains(libCmake, "install(FILES ${CMAKE_CURRENT_BINARY_DIR}/CoreLibConfig.cmake ${CMAKE_CURRENT_BINARY_DIR}/CoreLibConfigVersion.cmake\n"
+                                   "        DESTINATION ${CMAKE_INSTALL_LIBDIR}/cmake/CoreLib)"));
+}
+
+TEST(CMakeGeneratorTest, MonolithicLayoutHasNoSubprojects) {
+    LibraryMetadata projLib("ROOT", "MyProject", true, {});
+    LibraryMetadata coreLib("ROOT/CoreLib", "CoreLib", false, {});
+
+    ProjMetadata meta;
+    meta.libraries["proj"] = projLib;
+    meta.libraries["CoreLib"] = coreLib;
+
+    EXPECT_TRUE(BuildToolGenerator::generateLibraryCmakeLists(meta).empty());
+    EXPECT_FALSE(contains(BuildToolGenerator::generateCmakeLists(meta), "add_subdirectory("));
+}
+
+TEST(CMakeGeneratorTest, PinsInterferenceSizeForGcc) {
+    LibraryMetadata projLib("ROOT", "MyProject", true, {});
+    ProjMetadata meta;
+    meta.libraries["proj"] = projLib;
+
+    // Only projects aligning members to cache lines need the parameter.
+    EXPECT_FALSE(contains(BuildToolGenerator::generateCmakeLists(meta), "destructive-interference-size"));
+
+    meta.ownCacheline = true;
+    const std::string cmake = BuildToolGenerator::generateCmakeLists(meta);
+    EXPECT_TRUE(contains(cmake, "if(CMAKE_CXX_COMPILER_ID STREQUAL \"GNU\" AND CMAKE_CXX_COMPILER_VERSION VERSION_GREATER_EQUAL 12)\n"
+                                "    add_compile_options(--param=destructive-interference-size=64)\n"));
+}
+
+TEST(CMakeGeneratorTest, RegistersGeneratedTestsWithCTest) {
+    LibraryMetadata projLib("ROOT", "MyProject", true, {});
+    projLib.subDirectories = {"ROOT"};
+    LibraryMetadata coreLib("ROOT/CoreLib", "CoreLib", false, {});
+    ProjMetadata meta;
+    meta.libraries["proj"] = projLib;
+    meta.libraries["CoreLib"] = coreLib;
+    meta.tests = {{"EntrySerializationTest", "tests/EntrySerializationTest.cpp", "CoreLib", false, false},
+                  {"PointSerializationBenchmark", "benchmarks/PointSerializationBenchmark.cpp", "MyProject", true, true}};
+
+    std::string cmakeFile = BuildToolGenerator::generateCmakeLists(meta);
+    EXPECT_TRUE(contains(cmakeFile, "enable_testing()"));
+    EXPECT_TRUE(contains(cmakeFile, "target_link_libraries(EntrySerializationTest PRIVATE CoreLib)\n"
+                                    "add_test(NAME EntrySerializationTest COMMAND EntrySerializationTest)\n"));
+    // Project-level files are tested through an object library of everything but main.cpp.
+    EXPECT_TRUE(contains(cmakeFile, "add_library(${MAIN_TARGET}_lib OBJECT ${TESTED_SRCS})"));
+    EXPECT_TRUE(contains(cmakeFile, "target_link_libraries(${MAIN_TARGET}_lib PUBLIC CoreLib)"));
+    EXPECT_TRUE(contains(cmakeFile, "target_link_libraries(PointSerializationBenchmark PRIVATE ${MAIN_TARGET}_lib)"));
+    EXPECT_TRUE(contains(cmakeFile, "set_tests_properties(PointSerializationBenchmark PROPERTIES LABELS benchmark)"));
+
+    meta.tests.clear();
+    EXPECT_FALSE(contains(BuildToolGenerator::generateCmakeLists(meta), "enable_testing()"));
+}
+
+TEST(CMakeGeneratorTest, AddsTracingOptionWhenInstrumented) {
+    LibraryMetadata projLib("ROOT", "MyProject", true, {});
+    ProjMetadata meta;
+    meta.libraries["proj"] = projLib;
+    EXPECT_FALSE(contains(BuildToolGenerator::generateCmakeLists(meta), "ENABLE_TRACING"));
+
+    meta.tracing = true;
+    std::string cmakeFile = BuildToolGenerator::generateCmakeLists(meta);
+    EXPECT_TRUE(contains(cmakeFile, "option(MYPROJECT_ENABLE_TRACING "));
+    EXPECT_TRUE(contains(cmakeFile, "if(MYPROJECT_ENABLE_TRACING)\n    add_compile_definitions(MYPROJECT_ENABLE_TRACING)\nendif()"));
+}
+
+TEST(CMakeGeneratorTest, LinksProfilerIntoEveryTarget) {
+    LibraryMetadata projLib("ROOT", "MyProject", true, {});
+    LibraryMetadata coreLib("ROOT/CoreLib", "CoreLib", false, {});
+    ProjMetadata meta;
+    meta.libraries["proj"] = projLib;
+    meta.libraries["CoreLib"] = coreLib;
+    EXPECT_FALSE(contains(BuildToolGenerator::generateCmakeLists(meta), "profiling"));
+
+    meta.options.profiler = true;
+    std::string cmakeFile = BuildToolGenerator::generateCmakeLists(meta);
+    EXPECT_TRUE(contains(cmakeFile, "add_library(profiling ${CMAKE_SOURCE_DIR}/src/profiling/Profiler.cpp)\n"));
+    EXPECT_TRUE(contains(cmakeFile, "target_link_libraries(profiling PUBLIC Threads::Threads)"));
+    EXPECT_TRUE(contains(cmakeFile, "target_link_libraries(CoreLib PUBLIC profiling)"));
+    EXPECT_TRUE(contains(cmakeFile, "target_link_libraries(${MAIN_TARGET} PUBLIC profiling)"));
+    // The profiling sources are not globbed into the main binary.
+    EXPECT_TRUE(contains(cmakeFile, "set(LIBRARY_DIRS CoreLib profiling)"));
+}
+
+TEST(CMakeGeneratorTest, DisablesExceptionsForExpectedErrors) {
+    LibraryMetadata projLib("ROOT", "MyProject", true, {});
+    ProjMetadata meta;
+    meta.libraries["proj"] = projLib;
+    EXPECT_FALSE(contains(BuildToolGenerator::generateCmakeLists(meta), "-fno-exceptions"));
+
+    meta.options.errors = CodeGroupModels::ErrorHandling::EXPECTED;
+    EXPECT_TRUE(contains(BuildToolGenerator::generateCmakeLists(meta),
+                         "if(MSVC)\n    add_compile_options(/EHs-c- /D_HAS_EXCEPTIONS=0)\nelse()\n    add_compile_options(-fno-exceptions)\nendif()"));
+}
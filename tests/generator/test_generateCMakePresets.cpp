@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include "BuildToolsGenerator.h"
+#include "ProjectMetadata.h"
+#include "testUtility.h"
+
+using namespace BuildToolGenerator;
+using namespace ProjectMetadata;
+
+TEST(CMakePresetsGeneratorTest, ContainsReleaseAndPgoPresets) {
+    std::string presets = generateCmakePresets("MyProject");
+
+    // Configure presets for every optimisation stage.
+    EXPECT_TRUE(contains(presets, "\"name\": \"debug\""));
+    EXPECT_TRUE(contains(presets, "\"name\": \"release\""));
+    EXPECT_TRUE(contains(presets, "\"name\": \"pgo-instrument\""));
+    EXPECT_TRUE(contains(presets, "\"name\": \"pgo-use\""));
+    EXPECT_TRUE(contains(presets, "\"displayName\": \"MyProject Release (LTO)\""));
+
+    // Release enables IPO and the PGO stages are wired to a shared profile directory.
+    EXPECT_TRUE(contains(presets, "\"ENABLE_IPO\": \"ON\""));
+    EXPECT_TRUE(contains(presets, "\"PGO_MODE\": \"GENERATE\""));
+    EXPECT_TRUE(contains(presets, "\"PGO_MODE\": \"USE\""));
+    EXPECT_TRUE(contains(presets, "\"PGO_PROFILE_DIR\": \"${sourceDir}/pgo-profiles\""));
+    EXPECT_TRUE(contains(presets, "\"binaryDir\": \"${sourceDir}/build/${presetName}\""));
+    EXPECT_TRUE(contains(presets, "\"binaryDir\": \"${sourceDir}/build/pgo\""));
+}
+
+TEST(CMakePresetsGeneratorTest, ValidJsonStructure) {
+    std::string presets = generateCmakePresets("MyProject");
+
+    EXPECT_EQ(presets.front(), '{');
+    EXPECT_EQ(presets.back(), '}');
+    EXPECT_TRUE(contains(presets, "\"buildPresets\""));
+}
+
+TEST(CMakePresetsGeneratorTest, CMakeListsHonoursPresetVariables) {
+    LibraryMetadata projLib("ROOT", "MyProject", true, {});
+    projLib.subDirectories = {"ROOT"};
+
+    ProjMetadata meta;
+    meta.libraries["proj"] = projLib;
+
+    std::string cmakeFile = generateCmakeLists(meta);
+
+    // IPO is gated on toolchain support.
+    EXPECT_TRUE(contains(cmakeFile, "include(CheckIPOSupported)"));
+    EXPECT_TRUE(contains(cmakeFile, "set(CMAKE_INTERPROCEDURAL_OPTIMIZATION ON)"));
+    // PGO stages map onto compiler flags before any target is declared.
+    EXPECT_TRUE(contains(cmakeFile, "-fprofile-generate=${PGO_PROFILE_DIR}"));
+    EXPECT_TRUE(contains(cmakeFile, "-fprofile-use=${PGO_PROFILE_DIR}"));
+    EXPECT_LT(cmakeFile.find("PGO_MODE"), cmakeFile.find("add_executable"));
+}
+
+TEST(CMakePresetsGeneratorTest, DevPresetEnablesFastRelinkBuild) {
+    std::string presets = generateCmakePresets("MyProject");
+    EXPECT_TRUE(contains(presets, "\"name\": \"dev\""));
+    EXPECT_TRUE(contains(presets, "\"ENABLE_DEV_BUILD\": \"ON\""));
+
+    LibraryMetadata projLib("ROOT", "MyProject", true, {});
+    projLib.subDirectories = {"ROOT"};
+    ProjMetadata meta;
+    meta.libraries["proj"] = projLib;
+
+    std::string cmakeFile = generateCmakeLists(meta);
+
+    // Shared libraries, a fast linker with a gdb index, split DWARF and ccache when available.
+    EXPECT_TRUE(contains(cmakeFile, "set(BUILD_SHARED_LIBS ON)"));
+    EXPECT_TRUE(contains(cmakeFile, "-fuse-ld=mold -Wl,--gdb-index"));
+    EXPECT_TRUE(contains(cmakeFile, "-fuse-ld=lld -Wl,--gdb-index"));
+    EXPECT_TRUE(contains(cmakeFile, "add_compile_options(-gsplit-dwarf)"));
+    EXPECT_TRUE(contains(cmakeFile, "set(CMAKE_CXX_COMPILER_LAUNCHER ${CCACHE_PROGRAM})"));
+}
+
+TEST(CMakePresetsGeneratorTest, ProfilePresetKeepsFramePointers) {
+    std::string presets = generateCmakePresets("MyProject");
+
+    EXPECT_TRUE(contains(presets, "\"name\": \"profile\""));
+    EXPECT_TRUE(contains(presets, "\"CMAKE_BUILD_TYPE\": \"RelWithDebInfo\", \"CMAKE_CXX_FLAGS\": \"-fno-omit-frame-pointer\""));
+    EXPECT_TRUE(contains(presets, "{ \"name\": \"profile\", \"configurePreset\": \"profile\" }"));
+}
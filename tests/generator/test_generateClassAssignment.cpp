@@ -24,13 +24,13 @@ TEST(AssignmentOperatorGeneratorTest, GenerateMoveAssignmentDeclaration) {
 // Expected output (with newlines and indentation exactly as generated):
 // "MyClass& MyClass::operator=(MyClass&& other) noexcept {\n"
 // "    // TODO: Implement MyClass move assignment logic..\n"
-// "    throw std::runtime_error(\"Not implemented\");\n"
+// "    std::terminate(); // Not implemented\n"
 // "}\n"
 TEST(AssignmentOperatorGeneratorTest, GenerateMoveAssignmentDefinition) {
     std::string className = "MyClass";
     std::string expected = "MyClass& MyClass::operator=(MyClass&& other) noexcept {\n"
                            "    // TODO: Implement MyClass move assignment logic.\n"
-                           "    throw std::runtime_error(\"Not implemented\");\n"
+                           "    std::terminate(); // Not implemented\n"
                            "}\n";
     
     // Call the generator function.
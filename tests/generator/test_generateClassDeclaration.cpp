@@ -238,19 +238,9 @@ TEST(ClassGeneratorDeclarationTest, ClassWithDestructorAndAssignments)
 class DestructClass {
 public:
     ~DestructClass() = default;
-    /**
-     * @brief Custom move assignment operator.
-     * @param other The DestructClass object to move from.
-     * @return Reference to this DestructClass.
-     */
-    DestructClass& operator=(const DestructClass& other);
+    DestructClass& operator=(const DestructClass&) = default;
 
-    /**
-     * @brief Custom move assignment operator.
-     * @param other The DestructClass object to move from.
-     * @return Reference to this DestructClass.
-     */
-    DestructClass& operator=(DestructClass&& other) noexcept;
+    DestructClass& operator=(DestructClass&&) noexcept = default;
 
 
 };
@@ -325,19 +315,9 @@ public:
     FullClass(int id);
 
     ~FullClass() = default;
-    /**
-     * @brief Custom move assignment operator.
-     * @param other The FullClass object to move from.
-     * @return Reference to this FullClass.
-     */
-    FullClass& operator=(const FullClass& other);
+    FullClass& operator=(const FullClass&) = default;
 
-    /**
-     * @brief Custom move assignment operator.
-     * @param other The FullClass object to move from.
-     * @return Reference to this FullClass.
-     */
-    FullClass& operator=(FullClass&& other) noexcept;
+    FullClass& operator=(FullClass&&) noexcept = default;
 
     /**
      * @brief Public method
@@ -389,12 +369,7 @@ TEST(ClassGeneratorDeclarationTest, ClassWithOnlyCopyAssignment)
  */
 class CopyOnlyClass {
 public:
-    /**
-     * @brief Custom move assignment operator.
-     * @param other The CopyOnlyClass object to move from.
-     * @return Reference to this CopyOnlyClass.
-     */
-    CopyOnlyClass& operator=(const CopyOnlyClass& other);
+    CopyOnlyClass& operator=(const CopyOnlyClass&) = default;
 
 
 };
@@ -455,3 +430,69 @@ public:
     // Assert:
     EXPECT_EQ(output, expected);
 }
+
+// Test: Header-only declaration inlines methods and appends special member definitions.
+TEST(ClassGeneratorDeclarationTest, HeaderOnlyClassInlinesDefinitions)
+{
+    ClassModels::Destructor dtor("Default destructor");
+    ClassModels::ClassOptions options;
+    options.specialMembers = ClassModels::SpecialMemberPolicy::CUSTOM;
+    ClassModels::ClassModel cl(
+        "InlineClass",
+        "",
+        makeEmptyCtors(),
+        dtor,
+        makeEmptyMethods(),
+        makeEmptyMethods(),
+        makeEmptyMethods(),
+        makeEmptyMembers(),
+        makeEmptyMembers(),
+        makeEmptyMembers(),
+        true,                    // has copy assignment
+        false,
+        options
+    );
+
+    std::string output = ClassGenerator::generateClassDeclaration(cl, true);
+
+    // The declaration is unchanged; the definition follows as an inline function.
+    EXPECT_TRUE(contains(output, "InlineClass& operator=(const InlineClass& other);"));
+    EXPECT_TRUE(contains(output, "inline InlineClass& InlineClass::operator=(const InlineClass& other)"));
+}
+
+// Test: Pointer members keep hand-written copy and move members; trivially copyable classes are asserted.
+TEST(ClassGeneratorDeclarationTest, DefaultsCopyAndMoveOnlyWhenMemberwise)
+{
+    PropertiesModels::TypeDeclarator pointer;
+    pointer.ptrCount = 1;
+    std::vector<ClassModels::Constructor> ctors = {
+        ClassModels::Constructor(ClassModels::ConstructorType::COPY, {}, ""),
+        ClassModels::Constructor(ClassModels::ConstructorType::MOVE, {}, "")};
+    auto makeClass = [&ctors](const PropertiesModels::Parameter &member, const ClassModels::ClassOptions &options)
+    {
+        return ClassModels::ClassModel("Node", "", ctors, std::nullopt,
+                                       makeEmptyMethods(), makeEmptyMethods(), makeEmptyMethods(),
+                                       {member}, makeEmptyMembers(), makeEmptyMembers(), true, true, options);
+    };
+    PropertiesModels::Parameter value(PropertiesModels::DataType(PropertiesModels::Types::INT), "value");
+    PropertiesModels::Parameter next(PropertiesModels::DataType(PropertiesModels::Types::INT, pointer), "next");
+
+    std::string memberwise = ClassGenerator::generateClassDeclaration(makeClass(value, {}));
+    EXPECT_TRUE(contains(memberwise, "    Node(const Node&) = default;\n"));
+    EXPECT_TRUE(contains(memberwise, "    Node(Node&&) noexcept = default;\n"));
+    EXPECT_TRUE(contains(memberwise, "    Node& operator=(Node&&) noexcept = default;\n"));
+    EXPECT_FALSE(contains(memberwise, "static_assert"));
+    EXPECT_EQ(ClassGenerator::generateClassDefinition(makeClass(value, {})), "");
+
+    std::string owning = ClassGenerator::generateClassDeclaration(makeClass(next, {}));
+    EXPECT_TRUE(contains(owning, "    Node(const Node& other);\n"));
+    EXPECT_NE(ClassGenerator::generateClassDefinition(makeClass(next, {})), "");
+
+    // Marking the class trivially copyable defaults its members regardless and asserts the property.
+    ClassModels::ClassOptions trivial;
+    trivial.triviallyCopyable = true;
+    std::string asserted = ClassGenerator::generateClassDeclaration(makeClass(next, trivial));
+    EXPECT_TRUE(contains(asserted, "    Node(const Node&) = default;\n"));
+    EXPECT_TRUE(contains(asserted, "};\n\nstatic_assert(std::is_trivially_copyable_v<Node>, \"Node must be trivially copyable\");\n"));
+    EXPECT_EQ(ClassGenerator::requiredHeaders(makeClass(next, trivial)), std::set<std::string>{"<type_traits>"});
+}
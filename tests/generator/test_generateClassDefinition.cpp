@@ -100,7 +100,9 @@ void TestClass::publicMethod() {
 TEST(ClassGeneratorDefinitionTest, ClassWithDestructorAndAssignments)
 {
     ClassModels::Destructor dtor("Default destructor");
-    // When assignment flags are true, definitions for both assignments are generated.
+    // With custom special members, definitions for both assignments are generated.
+    ClassModels::ClassOptions options;
+    options.specialMembers = ClassModels::SpecialMemberPolicy::CUSTOM;
     ClassModels::ClassModel cl(
         "DestructClass",
         "Class with destructor and assignments",
@@ -113,7 +115,8 @@ TEST(ClassGeneratorDefinitionTest, ClassWithDestructorAndAssignments)
         makeEmptyMembers(),       // private members
         makeEmptyMembers(),       // protected members
         true,                     // has copy assignment
-        true                      // has move assignment
+        true,                     // has move assignment
+        options
     );
 
     std::string expected = R"expected(DestructClass& DestructClass::operator=(const DestructClass& other) {
@@ -123,7 +126,7 @@ TEST(ClassGeneratorDefinitionTest, ClassWithDestructorAndAssignments)
 
 DestructClass& DestructClass::operator=(DestructClass&& other) noexcept {
     // TODO: Implement DestructClass move assignment logic.
-    throw std::runtime_error("Not implemented");
+    std::terminate(); // Not implemented
 }
 
 )expected";
@@ -257,14 +260,7 @@ TEST(ClassGeneratorDefinitionTest, ClassWithAllSectionsAndSpacing)
     "    // TODO: Implement FullClass construtor logic.\n"
     "    throw std::runtime_error(\"Not implemented\");\n"
     "}\n\n"
-    "FullClass& FullClass::operator=(const FullClass& other) {\n"
-    "    // TODO: Implement FullClass copy assignment logic.\n"
-    "    throw std::runtime_error(\"Not implemented\");\n"
-    "}\n\n"
-    "FullClass& FullClass::operator=(FullClass&& other) noexcept {\n"
-    "    // TODO: Implement FullClass move assignment logic.\n"
-    "    throw std::runtime_error(\"Not implemented\");\n"
-    "}\n\n"
+    // Member-wise assignment is defaulted in the declaration, so it has no definition.
     "void FullClass::publicMethod() {\n"
     "    // TODO: Implement publicMethod logic.\n"
     "    throw std::runtime_error(\"Not implemented\");\n"
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "BuildToolsGenerator.h"
+#include "ProjectMetadata.h"
+#include "testUtility.h"
+
+using namespace BuildToolGenerator;
+using namespace ProjectMetadata;
+
+// Builds metadata for a project with one class at the root and one library.
+static ProjMetadata makeMetadata()
+{
+    LibraryMetadata projLib("ROOT", "MyProject", true, {});
+    projLib.translationUnits = {"ROOT/App"};
+
+    LibraryMetadata coreLib("ROOT/Core", "Core", false, {});
+    coreLib.subDirectories = {"ROOT/Core", "ROOT/Core/Utils"};
+    coreLib.translationUnits = {"ROOT/Core/Utils/Logger"};
+
+    ProjMetadata meta;
+    meta.libraries["proj"] = projLib;
+    meta.libraries["Core"] = coreLib;
+    return meta;
+}
+
+TEST(CompileCommandsGeneratorTest, ListsEveryTranslationUnit) {
+    std::string db = generateCompileCommands(makeMetadata(), "/work/out");
+
+    EXPECT_TRUE(contains(db, "\"file\": \"/work/out/src/App.cpp\""));
+    EXPECT_TRUE(contains(db, "\"file\": \"/work/out/src/Core/Utils/Logger.cpp\""));
+    EXPECT_TRUE(contains(db, "\"file\": \"/work/out/src/main.cpp\""));
+    EXPECT_TRUE(contains(db, "\"directory\": \"/work/out\""));
+    EXPECT_EQ(db.front(), '[');
+    EXPECT_EQ(db.back(), ']');
+}
+
+TEST(CompileCommandsGeneratorTest, IncludeDirectoriesMirrorCMakeTargets) {
+    std::string db = generateCompileCommands(makeMetadata(), "/work/out");
+
+    // The library sees its own folders.
+    EXPECT_TRUE(contains(db, "\"arguments\": [\"c++\", \"-std=c++23\", \"-I/work/out/include\", "
+                             "\"-I/work/out/include/Core\", \"-I/work/out/include/Core/Utils\", "
+                             "\"-c\", \"/work/out/src/Core/Utils/Logger.cpp\"]"));
+    // The main binary links every library publicly and so sees their folders too.
+    EXPECT_TRUE(contains(db, "\"arguments\": [\"c++\", \"-std=c++23\", \"-I/work/out/include\", "
+                             "\"-I/work/out/include/Core\", \"-I/work/out/include/Core/Utils\", "
+                             "\"-c\", \"/work/out/src/App.cpp\"]"));
+}
+
+TEST(CompileCommandsGeneratorTest, EscapesPaths) {
+    std::string db = generateCompileCommands(makeMetadata(), "/work/\"odd\"");
+    EXPECT_TRUE(contains(db, "\"directory\": \"/work/\\\"odd\\\"\""));
+}
+
+TEST(CompileCommandsGeneratorTest, ListsTestsWithTheFlagsOfTheirLibrary) {
+    ProjMetadata meta = makeMetadata();
+    meta.ownCacheline = true;
+    meta.options.errors = CodeGroupModels::ErrorHandling::EXPECTED;
+    meta.tests = {{"CoreLoggerTest", "tests/CoreLoggerTest.cpp", "Core", false, false},
+                  {"AppBenchmark", "benchmarks/AppBenchmark.cpp", "MyProject", true, true}};
+    std::string db = generateCompileCommands(meta, "/work/out");
+
+    EXPECT_TRUE(contains(db, "\"arguments\": [\"c++\", \"-std=c++23\", \"-fno-exceptions\", \"--param=destructive-interference-size=64\", "
+                             "\"-I/work/out/include\", \"-I/work/out/include/Core\", \"-I/work/out/include/Core/Utils\", "
+                             "\"-c\", \"/work/out/tests/CoreLoggerTest.cpp\"]"));
+    EXPECT_TRUE(contains(db, "\"file\": \"/work/out/benchmarks/AppBenchmark.cpp\""));
+    // Sources are compiled with the same project-wide flags as the tests.
+    EXPECT_TRUE(contains(db, "\"-fno-exceptions\", \"--param=destructive-interference-size=64\", \"-I/work/out/include\", "
+                             "\"-I/work/out/include/Core\", \"-I/work/out/include/Core/Utils\", \"-c\", \"/work/out/src/App.cpp\"]"));
+}
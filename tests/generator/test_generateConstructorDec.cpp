@@ -78,7 +78,7 @@ TEST(SpecialMemberGeneratorDeclarationTest, DefaultConstructorDeclaration) {
     std::string declaration = SpecialMemberGenerator::generateConstructorDeclaration(className, ctor);
 
     // Assert: The generated declaration should include default constructor.
-    std::string expected = "    MyClass() = default;\n\n";
+    std::string expected = "    MyClass() noexcept = default;\n\n";
     EXPECT_EQ(declaration, expected);
 }
 
@@ -93,3 +93,40 @@ TEST(SpecialMemberGeneratorDeclarationTest, ThrowsOnUnknownConstructorType) {
         std::runtime_error
     );
 }
+
+TEST(SpecialMemberGeneratorDeclarationTest, InfersNoexceptFromMemberTypes) {
+    // Arrange: A builtin member, a custom member by value and a custom member behind a pointer.
+    PropertiesModels::TypeDeclarator pointer;
+    pointer.ptrCount = 1;
+    std::vector<PropertiesModels::Parameter> members = {
+        PropertiesModels::Parameter(PropertiesModels::DataType(PropertiesModels::Types::INT), "count"),
+        PropertiesModels::Parameter(PropertiesModels::DataType(PropertiesModels::Types::CUSTOM, "Buffer",
+                                                               PropertiesModels::TypeQualifier::NONE), "buffer"),
+        PropertiesModels::Parameter(PropertiesModels::DataType(PropertiesModels::Types::CUSTOM, "Widget",
+                                                               PropertiesModels::TypeQualifier::NONE, pointer), "widget")};
+    ClassModels::Constructor move(ClassModels::ConstructorType::MOVE, {}, "Move constructor");
+    ClassModels::Constructor def(ClassModels::ConstructorType::DEFAULT, {}, "Default constructor");
+
+    // Act & Assert: Only the custom member held by value makes noexcept conditional.
+    EXPECT_NE(SpecialMemberGenerator::generateConstructorDeclaration("MyClass", move, members)
+                  .find("MyClass(MyClass&& other) noexcept(std::is_nothrow_move_constructible_v<Buffer>);\n"),
+              std::string::npos);
+    EXPECT_EQ(SpecialMemberGenerator::generateConstructorDeclaration("MyClass", def, members),
+              "    MyClass() noexcept(std::is_nothrow_default_constructible_v<Buffer>) = default;\n\n");
+    EXPECT_EQ(SpecialMemberGenerator::generateNoexceptSpecifier({members[0], members[2]}, "is_nothrow_move_assignable"),
+              " noexcept");
+}
+
+TEST(SpecialMemberGeneratorDeclarationTest, ExplicitNoexceptOverridesInference) {
+    // Arrange: A custom constructor marked noexcept and a move constructor marked as throwing.
+    std::vector<PropertiesModels::Parameter> params = {
+        PropertiesModels::Parameter(PropertiesModels::DataType(PropertiesModels::Types::INT), "x")};
+    ClassModels::Constructor custom(ClassModels::ConstructorType::CUSTOM, params, "Custom constructor", true);
+    ClassModels::Constructor move(ClassModels::ConstructorType::MOVE, {}, "Move constructor", false);
+
+    // Act & Assert
+    EXPECT_NE(SpecialMemberGenerator::generateConstructorDeclaration("MyClass", custom).find("MyClass(int x) noexcept;\n"),
+              std::string::npos);
+    EXPECT_NE(SpecialMemberGenerator::generateConstructorDeclaration("MyClass", move).find("MyClass(MyClass&& other);\n"),
+              std::string::npos);
+}
@@ -81,7 +81,7 @@ TEST(SpecialMemberGeneratorDefinitionTest, MoveConstructorDefinitionWithMembers)
 
     // Assert:
     // Expected signature for move constructor plus initializer list for the member "x".
-    std::string expected = "MyClass::MyClass(MyClass&& other) noexcept : x()\n{\n    // TODO: Implement MyClass construtor logic.\n    throw std::runtime_error(\"Not implemented\");\n}\n";
+    std::string expected = "MyClass::MyClass(MyClass&& other) noexcept : x()\n{\n    // TODO: Implement MyClass construtor logic.\n    std::terminate(); // Not implemented\n}\n";
     EXPECT_EQ(def, expected);
 }
 
@@ -120,3 +120,30 @@ TEST(SpecialMemberGeneratorDefinitionTest, ThrowsOnUnknownConstructorType) {
         std::runtime_error
     );
 }
+
+TEST(SpecialMemberGeneratorDefinitionTest, CustomConstructorInitialisesMembersFromParameters) {
+    // Arrange: Parameters named after members; the string is moved, the int copied.
+    std::vector<PropertiesModels::Parameter> params = {
+        PropertiesModels::Parameter(PropertiesModels::DataType(PropertiesModels::Types::STRING), "name"),
+        PropertiesModels::Parameter(PropertiesModels::DataType(PropertiesModels::Types::INT), "id")};
+    ClassModels::Constructor ctor(ClassModels::ConstructorType::CUSTOM, params, "Custom constructor");
+    std::vector<PropertiesModels::Parameter> privateMembers = {
+        PropertiesModels::Parameter(PropertiesModels::DataType(PropertiesModels::Types::INT), "id"),
+        PropertiesModels::Parameter(PropertiesModels::DataType(PropertiesModels::Types::STRING), "name"),
+        PropertiesModels::Parameter(PropertiesModels::DataType(PropertiesModels::Types::DOUBLE), "score")};
+
+    // Act
+    std::string def = SpecialMemberGenerator::generateConstructorDefinition("MyClass", ctor, {}, privateMembers, {});
+
+    // Assert: Every parameter initialises a member, so the constructor is complete.
+    EXPECT_EQ(def, "MyClass::MyClass(std::string name, int id) : id(id), name(std::move(name)), score()\n{\n}\n");
+    EXPECT_TRUE(SpecialMemberGenerator::movesParameters(ctor, privateMembers));
+
+    // A const string cannot be moved from, and an unmatched parameter leaves work to do.
+    params[0].type.qualifiers = PropertiesModels::TypeQualifier::CONST;
+    params.emplace_back(PropertiesModels::DataType(PropertiesModels::Types::BOOL), "verbose");
+    ClassModels::Constructor partial(ClassModels::ConstructorType::CUSTOM, params, "Custom constructor");
+    def = SpecialMemberGenerator::generateConstructorDefinition("MyClass", partial, {}, privateMembers, {});
+    EXPECT_NE(def.find(": id(id), name(name), score()\n{\n    // TODO"), std::string::npos);
+    EXPECT_FALSE(SpecialMemberGenerator::movesParameters(partial, privateMembers));
+}
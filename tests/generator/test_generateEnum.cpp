@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include "EnumGenerator.h"
+#include "FileNodeGenerator.h"
+#include "NamespaceGenerator.h"
+
+namespace
+{
+    EnumModels::EnumModel makeSide()
+    {
+        return EnumModels::EnumModel{"Side", "Side of an order", {"BUY", "SELL"}, "std::uint8_t"};
+    }
+}
+
+TEST(EnumGeneratorTest, DeclaresEnumAndArrayBackedToString) {
+    std::string decl = EnumGenerator::generateEnumDeclaration(makeSide());
+    EXPECT_NE(decl.find("/**\n * @brief Side of an order\n */\n"
+                        "enum class Side : std::uint8_t {\n"
+                        "    BUY,\n"
+                        "    SELL\n"
+                        "};\n"),
+              std::string::npos);
+    EXPECT_NE(decl.find("constexpr std::string_view toString(const Side value) noexcept {\n"
+                        "    constexpr std::array<std::string_view, 2> names{\"BUY\", \"SELL\"};\n"
+                        "    const auto index = static_cast<std::size_t>(value);\n"
+                        "    return index < names.size() ? names[index] : std::string_view{};\n"
+                        "}\n"),
+              std::string::npos);
+    EXPECT_EQ(EnumGenerator::requiredHeaders(makeSide()).count("\"EnumTraits.h\""), 1);
+}
+
+TEST(EnumGeneratorTest, SpecialisesTraitsAfterTheNamespace) {
+    CodeGroupModels::NamespaceModel inner;
+    inner.name = "Orders";
+    inner.enums.push_back(makeSide());
+    CodeGroupModels::NamespaceModel ns;
+    ns.name = "Core";
+    ns.namespaces.push_back(inner);
+    EXPECT_TRUE(EnumGenerator::hasEnums(ns));
+    EXPECT_EQ(NamespaceGenerator::requiredHeaders(ns).count("\"EnumTraits.h\""), 1);
+
+    FileNodeGenerator::FileNode<CodeGroupModels::NamespaceModel> node("Proj", "Core", ns);
+    std::string header = node.generateFiles().headerContent;
+    const size_t declaration = header.find("        enum class Side : std::uint8_t {\n");
+    const size_t close = header.find("} // namespace Core\n");
+    const size_t traits = header.find("template <>\nstruct enums::EnumTraits<Core::Orders::Side> {\n"
+                                      "    static constexpr std::size_t count = 2;\n"
+                                      "    static constexpr std::array<Core::Orders::Side, 2> values{Core::Orders::Side::BUY, Core::Orders::Side::SELL};\n"
+                                      "    static constexpr std::array<std::string_view, 2> names{\"BUY\", \"SELL\"};\n"
+                                      "    static constexpr enums::PerfectHash<2> lookup{names};\n"
+                                      "};\n"
+                                      "static_assert(enums::roundTrips<Core::Orders::Side>()");
+    ASSERT_NE(declaration, std::string::npos);
+    ASSERT_NE(close, std::string::npos);
+    ASSERT_NE(traits, std::string::npos);
+    EXPECT_LT(declaration, close);
+    EXPECT_LT(close, traits);
+}
+
+TEST(EnumGeneratorTest, SupportHeaderBuildsThePerfectHashAtCompileTime) {
+    std::string header = EnumGenerator::generateSupportHeader();
+    EXPECT_NE(header.find("namespace enums\n"), std::string::npos);
+    EXPECT_NE(header.find("consteval explicit PerfectHash(const std::array<std::string_view, N>& names)"), std::string::npos);
+    EXPECT_NE(header.find("constexpr std::optional<E> fromString(const std::string_view name) noexcept"), std::string::npos);
+    EXPECT_NE(header.find("consteval bool roundTrips()"), std::string::npos);
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "ErrorGenerator.h"
+#include "CallableGenerator.h"
+#include "ClassGenerator.h"
+#include "PropertiesParser.h"
+#include "testUtility.h"
+
+using namespace CallableModels;
+using namespace PropertiesModels;
+
+namespace
+{
+    constexpr auto EXPECTED = CodeGroupModels::ErrorHandling::EXPECTED;
+
+    ClassModels::ClassModel makeOrder()
+    {
+        std::vector<ClassModels::Constructor> ctors = {
+            ClassModels::Constructor(ClassModels::ConstructorType::CUSTOM, PropertiesParser::parseParameters("id:int, name:string"), "")};
+        std::vector<MethodModel> methods = {MethodModel(DataType(Types::BOOL), "submit", {}, DeclartionSpecifier(), "Submits the order")};
+        return ClassModels::ClassModel("Order", "An order", ctors, std::nullopt, methods, makeEmptyMethods(), makeEmptyMethods(),
+                                       PropertiesParser::parseParameters("id:int, buffer:char*"), makeEmptyMembers(), makeEmptyMembers(),
+                                       true, false);
+    }
+}
+
+TEST(ErrorGeneratorTest, ReturnsExpectedFromStubsWithoutThrowing) {
+    FunctionModel parse(DataType(Types::INT), "parse", {}, DeclartionSpecifier(), "Parses");
+    const FunctionModel resolved = ErrorGenerator::applyErrorHandling(std::vector<FunctionModel>{parse}, EXPECTED).front();
+    EXPECT_EQ(CallableGenerator::generateCallableDefinition(resolved),
+              "std::expected<int, errors::Error> parse() {\n"
+              "    // TODO: Implement parse logic.\n"
+              "    return std::unexpected(errors::Error::NOT_IMPLEMENTED);\n"
+              "}\n");
+    EXPECT_EQ(CallableGenerator::requiredHeaders(resolved).count("\"Errors.h\""), 1);
+
+    // std::expected cannot hold a reference, so such callables keep their type and terminate.
+    FunctionModel at = parse;
+    at.returnType.typeDecl.isLValReference = true;
+    at.expected = true;
+    EXPECT_FALSE(ErrorGenerator::returnsExpected(at));
+    EXPECT_NE(CallableGenerator::generateCallableDefinition(at).find("    std::terminate(); // Not implemented\n"), std::string::npos);
+
+    // Without the option, stubs still throw.
+    EXPECT_NE(CallableGenerator::generateCallableDefinition(parse).find("throw std::runtime_error"), std::string::npos);
+}
+
+TEST(ErrorGeneratorTest, ConstructsThroughExpectedFactories) {
+    const ClassModels::ClassModel cl = ErrorGenerator::applyErrorHandling(makeOrder(), EXPECTED);
+    ASSERT_TRUE(cl.options.expected);
+
+    std::string decl = ClassGenerator::generateClassDeclaration(cl);
+    EXPECT_NE(decl.find("    static std::expected<Order, errors::Error> create(int id, std::string name);\n"), std::string::npos);
+    EXPECT_NE(decl.find("    std::expected<bool, errors::Error> submit();\n"), std::string::npos);
+
+    std::string def = ClassGenerator::generateClassDefinition(cl);
+    EXPECT_NE(def.find("std::expected<Order, errors::Error> Order::create(int id, std::string name) {\n"
+                       "    // TODO: Validate the arguments, returning std::unexpected for those Order rejects.\n"
+                       "    return std::expected<Order, errors::Error>(std::in_place, id, std::move(name));\n"
+                       "}\n"),
+              std::string::npos);
+    // The copy assignment stub cannot report an error, so it terminates.
+    EXPECT_EQ(def.find("throw"), std::string::npos);
+    EXPECT_NE(def.find("std::terminate(); // Not implemented"), std::string::npos);
+
+    ClassModels::ClassModel serialisable = makeOrder();
+    serialisable.options.serialize = ClassModels::SerializationFormat::BINARY;
+    EXPECT_THROW(ErrorGenerator::applyErrorHandling(serialisable, EXPECTED), std::runtime_error);
+}
+
+TEST(ErrorGeneratorTest, SupportHeaderDeclaresTheErrorEnum) {
+    std::string header = ErrorGenerator::generateSupportHeader();
+    EXPECT_NE(header.find("namespace errors\n{\n"), std::string::npos);
+    EXPECT_NE(header.find("    enum class Error {\n        NOT_IMPLEMENTED,\n"), std::string::npos);
+    EXPECT_NE(header.find("struct enums::EnumTraits<errors::Error> {\n"), std::string::npos);
+}
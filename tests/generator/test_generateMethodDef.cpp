@@ -377,3 +377,20 @@ TEST(GenerateMethodDefinitionTest, InlineWithEmptyDef) {
     
     EXPECT_EQ(generated, expected);
 }
+
+// Test: noexcept methods keep the specifier in the definition and terminate instead of throwing.
+TEST(GenerateMethodDefinitionTest, NoexceptMethod) {
+    DeclartionSpecifier ds;
+    MethodModel method(DataType(Types::INT), "size", {}, ds, "Returns the size", true);
+
+    std::string expected =
+        "int Worker::size() noexcept {\n"
+        "    // TODO: Implement size logic.\n"
+        "    std::terminate(); // Not implemented\n"
+        "}\n";
+
+    EXPECT_EQ(CallableGenerator::generateMethodDefinition("Worker", method), expected);
+    EXPECT_EQ(CallableGenerator::generateMethodDeclaration(method),
+              "    /**\n     * @brief Returns the size\n     */\n    int size() noexcept;\n");
+    EXPECT_EQ(CallableGenerator::requiredHeaders(method), std::set<std::string>{"<exception>"});
+}
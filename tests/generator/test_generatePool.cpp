@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include "PoolGenerator.h"
+#include "ClassGenerator.h"
+#include "PropertiesParser.h"
+#include "testUtility.h"
+
+namespace
+{
+    ClassModels::ClassModel makeOrder(const bool pooled = true)
+    {
+        ClassModels::ClassOptions options;
+        options.pooled = pooled;
+        return makeClassWithOptions("Order", PropertiesParser::parseParameters("id:int, price:double"), makeEmptyMembers(), options,
+                                    "An order");
+    }
+}
+
+TEST(PoolGeneratorTest, DefinesPooledOperatorsInClass) {
+    std::string decl = ClassGenerator::generateClassDeclaration(makeOrder());
+    EXPECT_NE(decl.find("    static void* operator new(const std::size_t size) {\n"
+                        "        if (size != sizeof(Order)) [[unlikely]]\n"
+                        "            return ::operator new(size, std::align_val_t{alignof(Order)});\n"
+                        "        return ObjectPool<sizeof(Order), alignof(Order)>::allocate();\n    }\n"),
+              std::string::npos);
+    EXPECT_NE(decl.find("    static void operator delete(void* ptr, const std::size_t size) noexcept {\n"),
+              std::string::npos);
+    EXPECT_NE(decl.find("        ObjectPool<sizeof(Order), alignof(Order)>::deallocate(ptr);\n"), std::string::npos);
+    // The operators are complete, so nothing is left for the source file.
+    EXPECT_EQ(ClassGenerator::generateClassDefinition(makeOrder()).find("operator new"), std::string::npos);
+    EXPECT_EQ(ClassGenerator::requiredHeaders(makeOrder()), (std::set<std::string>{"\"ObjectPool.h\"", "<cstddef>", "<new>"}));
+
+    EXPECT_EQ(ClassGenerator::generateClassDeclaration(makeOrder(false)).find("operator new"), std::string::npos);
+    EXPECT_TRUE(PoolGenerator::requiredHeaders(makeOrder(false)).empty());
+}
+
+TEST(PoolGeneratorTest, BenchmarksAgainstTheGlobalAllocator) {
+    EXPECT_TRUE(PoolGenerator::hasBenchmark(makeOrder()));
+    ClassModels::ClassModel buffer = makeOrder();
+    buffer.templateSpec.parameters = {"typename T"};
+    EXPECT_FALSE(PoolGenerator::hasBenchmark(buffer));
+
+    std::string bench = PoolGenerator::generateBenchmark("Core::Order", "Order.h");
+    EXPECT_NE(bench.find("@file CoreOrderPoolBenchmark.cpp"), std::string::npos);
+    EXPECT_NE(bench.find("#include \"Order.h\""), std::string::npos);
+    EXPECT_NE(bench.find("const auto pooledNew = [] { return new Core::Order(); };"), std::string::npos);
+    EXPECT_NE(bench.find("const auto globalDelete = [](Core::Order* object) { ::delete object; };"), std::string::npos);
+}
+
+TEST(PoolGeneratorTest, SupportHeaderKeepsAFreeListPerThread) {
+    std::string header = PoolGenerator::generateSupportHeader();
+    EXPECT_NE(header.find("template <std::size_t Size, std::size_t Align>\nclass ObjectPool {"), std::string::npos);
+    EXPECT_NE(header.find("inline static thread_local constinit Block* freeList = nullptr;"), std::string::npos);
+    EXPECT_NE(header.find("::operator new(BLOCK_SIZE * BLOCKS_PER_SLAB, std::align_val_t{BLOCK_ALIGN})"), std::string::npos);
+}
@@ -0,0 +1,30 @@
+#include <gtest/gtest.h>
+#include "ProfilerGenerator.h"
+
+TEST(ProfilerGeneratorTest, GeneratesRingBuffersAndChromeTraceWriter) {
+    std::string header = ProfilerGenerator::generateHeader();
+    EXPECT_NE(header.find("void recordScope(const char* name, std::int64_t startNs, std::int64_t durationNs) noexcept;"),
+              std::string::npos);
+    EXPECT_NE(header.find("Counter& counter(const std::string& name);"), std::string::npos);
+    EXPECT_NE(header.find("Histogram& histogram(const std::string& name);"), std::string::npos);
+    EXPECT_NE(header.find("class Session {"), std::string::npos);
+
+    std::string source = ProfilerGenerator::generateSource();
+    EXPECT_EQ(source.find("#include \"profiling/Profiler.h\""), 0);
+    EXPECT_NE(source.find("class RingBuffer {"), std::string::npos);
+    EXPECT_NE(source.find("\\\"ph\\\":\\\"X\\\""), std::string::npos);
+    EXPECT_NE(source.find("\\\"ph\\\":\\\"C\\\""), std::string::npos);
+}
+
+TEST(ProfilerGeneratorTest, InstallsSessionAndTraceHandlerInMain) {
+    EXPECT_EQ(ProfilerGenerator::traceFileName("MyProject"), "MyProject.trace.json");
+
+    std::string setup = ProfilerGenerator::generateMainSetup("MyProject", false);
+    EXPECT_NE(setup.find("    const profiling::Session profilingSession(\"MyProject.trace.json\");\n"), std::string::npos);
+    EXPECT_EQ(setup.find("setTraceHandler"), std::string::npos);
+
+    // Instrumented projects route their trace scopes to the profiler when tracing is compiled in.
+    EXPECT_NE(ProfilerGenerator::generateMainSetup("MyProject", true)
+                  .find("#if defined(MYPROJECT_ENABLE_TRACING)\n    tracing::setTraceHandler(&profiling::recordScope);\n#endif\n"),
+              std::string::npos);
+}
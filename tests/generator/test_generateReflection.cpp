@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+#include "ReflectionGenerator.h"
+#include "ClassGenerator.h"
+#include "PropertiesParser.h"
+#include "testUtility.h"
+
+namespace
+{
+    ClassModels::ClassModel makeOrder(const bool reflect = true)
+    {
+        ClassModels::ClassOptions options;
+        options.reflect = reflect;
+        return makeClassWithOptions("Order", PropertiesParser::parseParameters("id:int, price:double"),
+                                    PropertiesParser::parseParameters("notes:string"), options, "An order");
+    }
+}
+
+TEST(ReflectionGeneratorTest, DescribesMembersInDeclarationOrder) {
+    std::string decl = ClassGenerator::generateClassDeclaration(makeOrder());
+    EXPECT_NE(decl.find("    static constexpr auto fields() {\n"
+                        "        return std::make_tuple(\n"
+                        "            reflection::FieldDescriptor{\"id\", \"int\", &Order::id, reflection::Access::PUBLIC},\n"
+                        "            reflection::FieldDescriptor{\"price\", \"double\", &Order::price, reflection::Access::PUBLIC},\n"
+                        "            reflection::FieldDescriptor{\"notes\", \"std::string\", &Order::notes, reflection::Access::PRIVATE});\n"
+                        "    }\n"),
+              std::string::npos);
+    EXPECT_EQ(ClassGenerator::requiredHeaders(makeOrder()).count("\"Reflection.h\""), 1);
+
+    EXPECT_EQ(decl.find("fields()"), decl.rfind("fields()"));
+    EXPECT_EQ(ClassGenerator::generateClassDeclaration(makeOrder(false)).find("fields()"), std::string::npos);
+    EXPECT_TRUE(ReflectionGenerator::requiredHeaders(makeOrder(false)).empty());
+}
+
+TEST(ReflectionGeneratorTest, SupportHeaderIteratesFieldsAtCompileTime) {
+    std::string header = ReflectionGenerator::generateSupportHeader();
+    EXPECT_NE(header.find("struct FieldDescriptor {"), std::string::npos);
+    EXPECT_NE(header.find("constexpr void forEachField(Object& object, Visitor&& visit) {"), std::string::npos);
+    EXPECT_NE(header.find("constexpr std::size_t fieldIndex(const std::string_view name) {"), std::string::npos);
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "SerializationGenerator.h"
+#include "ClassGenerator.h"
+#include "PropertiesParser.h"
+#include "testUtility.h"
+
+namespace
+{
+    ClassModels::ClassModel makeRecord(const std::string &members = "id:int, value:double, name:string, flag:bool, parent:Record*",
+                                       const bool serialize = true)
+    {
+        ClassModels::ClassOptions options;
+        options.serialize = serialize ? ClassModels::SerializationFormat::BINARY : ClassModels::SerializationFormat::NONE;
+        return makeClassWithOptions("Record", PropertiesParser::parseParameters(members), makeEmptyMembers(), options, "A record");
+    }
+}
+
+TEST(SerializationGeneratorTest, CopiesArithmeticRunsInOneCall) {
+    std::string defs = SerializationGenerator::generateSerializationDefinitions(makeRecord(), "Record");
+    EXPECT_NE(defs.find("void Record::serialize(BinaryWriter& writer) const\n{\n"
+                        "    writer.write(serializationVersion);\n"
+                        "    writer.writeFields(id, value);\n"
+                        "    writer.write(name);\n"
+                        "    writer.writeFields(flag);\n"
+                        "    // parent is a pointer and is not serialized.\n}\n"),
+              std::string::npos);
+    EXPECT_NE(defs.find("void Record::deserialize(BinaryReader& reader)\n{\n"
+                        "    reader.readVersion(serializationVersion, \"Record\");\n"
+                        "    reader.readFields(id, value);\n"
+                        "    reader.read(name);\n"
+                        "    reader.readFields(flag);\n}\n"),
+              std::string::npos);
+}
+
+TEST(SerializationGeneratorTest, VersionTracksSerializedLayout) {
+    const auto version = SerializationGenerator::layoutVersion(makeRecord());
+    EXPECT_EQ(version, SerializationGenerator::layoutVersion(makeRecord()));
+    // Pointers are not part of the stream.
+    EXPECT_EQ(version, SerializationGenerator::layoutVersion(makeRecord("id:int, value:double, name:string, flag:bool")));
+    EXPECT_NE(version, SerializationGenerator::layoutVersion(makeRecord("value:double, id:int, name:string, flag:bool")));
+    EXPECT_NE(version, SerializationGenerator::layoutVersion(makeRecord("id:long, value:double, name:string, flag:bool")));
+}
+
+TEST(SerializationGeneratorTest, DeclaresMembersInClass) {
+    std::string decl = ClassGenerator::generateClassDeclaration(makeRecord());
+    EXPECT_NE(decl.find("    static constexpr std::uint32_t serializationVersion = 0x"), std::string::npos);
+    EXPECT_NE(decl.find("    void serialize(BinaryWriter& writer) const;\n"), std::string::npos);
+    EXPECT_NE(decl.find("    void deserialize(BinaryReader& reader);\n"), std::string::npos);
+    EXPECT_EQ(ClassGenerator::requiredHeaders(makeRecord()), (std::set<std::string>{"\"BinarySerialization.h\"", "<cstdint>"}));
+    EXPECT_NE(ClassGenerator::generateClassDefinition(makeRecord()).find("void Record::serialize("), std::string::npos);
+
+    // Header-only classes define the members inline after the class.
+    std::string headerOnly = ClassGenerator::generateClassDeclaration(makeRecord(), true);
+    EXPECT_NE(headerOnly.find("inline void Record::serialize(BinaryWriter& writer) const"), std::string::npos);
+
+    EXPECT_EQ(ClassGenerator::generateClassDeclaration(makeRecord("id:int", false)).find("serialize"), std::string::npos);
+    EXPECT_TRUE(SerializationGenerator::requiredHeaders(makeRecord("id:int", false)).empty());
+}
+
+TEST(SerializationGeneratorTest, RoundTripTestWritesEveryMemberSeparately) {
+    std::string test = SerializationGenerator::generateRoundTripTest(makeRecord(), "Core::Record", "Record.h");
+    EXPECT_NE(test.find("@file CoreRecordSerializationTest.cpp"), std::string::npos);
+    EXPECT_NE(test.find("#include \"Record.h\""), std::string::npos);
+    EXPECT_NE(test.find("        writer.write(Core::Record::serializationVersion);\n"
+                        "        writer.write(std::type_identity_t<int>{static_cast<int>(1)}); // id\n"
+                        "        writer.write(std::type_identity_t<double>{static_cast<double>(2)}); // value\n"
+                        "        writer.write(std::type_identity_t<std::string>{\"name\"}); // name\n"
+                        "        writer.write(std::type_identity_t<bool>{static_cast<bool>(4)}); // flag\n"
+                        "        const auto bytes"),
+              std::string::npos);
+    EXPECT_NE(test.find("check(Core::rejects(otherVersion), \"another layout version is rejected\");"), std::string::npos);
+
+    std::string bench = SerializationGenerator::generateBenchmark("Core::Record", "Record.h");
+    EXPECT_NE(bench.find("@file CoreRecordSerializationBenchmark.cpp"), std::string::npos);
+    EXPECT_NE(bench.find("        object.deserialize(reader);\n"), std::string::npos);
+}
+
+TEST(SerializationGeneratorTest, RoundTripTestResolvesMemberTypesInTheClassNamespace) {
+    // Point and Side are declared next to Shape, so they are only named unqualified inside Geo.
+    std::string test = SerializationGenerator::generateRoundTripTest(makeRecord("origin:Point, side:Side"), "Geo::Shape", "Geo.h");
+    EXPECT_NE(test.find("namespace Geo\n{\nnamespace\n{\n"), std::string::npos);
+    EXPECT_NE(test.find("        writer.write(std::type_identity_t<Point>{}); // origin\n"
+                        "        writer.write(std::type_identity_t<Side>{}); // side\n"),
+              std::string::npos);
+    EXPECT_NE(test.find("} // namespace\n} // namespace Geo\n\nint main()"), std::string::npos);
+    EXPECT_NE(test.find("const std::vector<std::byte> expected = Geo::expectedStream();"), std::string::npos);
+
+    // Classes at global scope keep their helpers in the anonymous namespace alone.
+    std::string global = SerializationGenerator::generateRoundTripTest(makeRecord("id:int"), "Record", "Record.h");
+    EXPECT_NE(global.find("#include <vector>\n\nnamespace\n{\n"), std::string::npos);
+    EXPECT_NE(global.find("check(rejects(otherVersion)"), std::string::npos);
+}
+
+TEST(SerializationGeneratorTest, TestsNeedADefaultConstructibleNonTemplate) {
+    EXPECT_TRUE(SerializationGenerator::hasRoundTripTest(makeRecord()));
+
+    ClassModels::ClassModel custom = makeRecord();
+    custom.constructors = {ClassModels::Constructor(ClassModels::ConstructorType::CUSTOM,
+                                                    PropertiesParser::parseParameters("id:int"), "")};
+    EXPECT_FALSE(SerializationGenerator::hasRoundTripTest(custom));
+
+    ClassModels::ClassModel buffer = makeRecord("value:T");
+    buffer.templateSpec.parameters = {"typename T"};
+    EXPECT_FALSE(SerializationGenerator::hasRoundTripTest(buffer));
+    EXPECT_NE(ClassGenerator::generateClassDefinition(buffer, true).find("template <typename T>\nvoid Record<T>::serialize("),
+              std::string::npos);
+}
+
+TEST(SerializationGeneratorTest, SupportHeaderBoundsEveryRead) {
+    std::string header = SerializationGenerator::generateSupportHeader();
+    EXPECT_NE(header.find("class BinaryWriter {"), std::string::npos);
+    EXPECT_NE(header.find("class BinaryReader {"), std::string::npos);
+    EXPECT_NE(header.find("throw std::runtime_error(\"BinaryReader: unexpected end of input\");"), std::string::npos);
+    EXPECT_NE(header.find("throw std::runtime_error(\"BinaryReader: element count exceeds the input\");"), std::string::npos);
+}
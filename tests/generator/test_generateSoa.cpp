@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include "SoaGenerator.h"
+#include "ClassGenerator.h"
+#include "PropertiesParser.h"
+#include "testUtility.h"
+
+namespace
+{
+    ClassModels::ClassModel makeParticle(const bool soa = true)
+    {
+        ClassModels::ClassOptions options;
+        options.soa = soa;
+        return makeClassWithOptions("Particle", PropertiesParser::parseParameters("x:float, mass:double, owner:Particle*"),
+                                    PropertiesParser::parseParameters("cache:int"), options, "A particle");
+    }
+}
+
+TEST(SoaGeneratorTest, StoresEachPublicMemberInItsOwnColumn) {
+    std::string soa = SoaGenerator::generateSoaDeclaration(makeParticle());
+    EXPECT_NE(soa.find("class ParticleSoA {"), std::string::npos);
+    EXPECT_NE(soa.find("    std::vector<float> x_; ///< \n    std::vector<double> mass_; ///< \n    std::vector<Particle*> owner_;"),
+              std::string::npos);
+    // Private members are not part of the container.
+    EXPECT_EQ(soa.find("cache"), std::string::npos);
+}
+
+TEST(SoaGeneratorTest, GeneratesOperationsAndAccessors) {
+    std::string soa = SoaGenerator::generateSoaDeclaration(makeParticle());
+    EXPECT_NE(soa.find("std::size_t size() const noexcept { return x_.size(); }"), std::string::npos);
+    EXPECT_NE(soa.find("void push_back(const Particle& value) {\n        x_.push_back(value.x);\n"), std::string::npos);
+    EXPECT_NE(soa.find("mass_.erase(mass_.begin() + static_cast<std::ptrdiff_t>(index));"), std::string::npos);
+    EXPECT_NE(soa.find("Reference operator[](const std::size_t index) noexcept { return {x_[index], mass_[index], owner_[index]}; }"),
+              std::string::npos);
+    EXPECT_NE(soa.find("std::span<float> x() noexcept { return x_; }"), std::string::npos);
+    EXPECT_NE(soa.find("std::span<const double> mass() const noexcept { return mass_; }"), std::string::npos);
+    // Pointers stay mutable targets; only the stored pointer is const.
+    EXPECT_NE(soa.find("std::span<Particle* const> owner() const noexcept"), std::string::npos);
+    EXPECT_NE(soa.find("Particle* const& owner;"), std::string::npos);
+}
+
+TEST(SoaGeneratorTest, FollowsClassDeclarationOnlyWhenRequested) {
+    std::string decl = ClassGenerator::generateClassDeclaration(makeParticle());
+    EXPECT_LT(decl.find("class Particle {"), decl.find("class ParticleSoA {"));
+    EXPECT_EQ(ClassGenerator::requiredHeaders(makeParticle()), (std::set<std::string>{"<cstddef>", "<span>", "<vector>"}));
+
+    EXPECT_EQ(ClassGenerator::generateClassDeclaration(makeParticle(false)).find("ParticleSoA"), std::string::npos);
+    EXPECT_TRUE(SoaGenerator::requiredHeaders(makeParticle(false)).empty());
+}
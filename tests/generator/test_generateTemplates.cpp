@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "CallableGenerator.h"
+#include "ClassGenerator.h"
+#include "FileNodeGenerator.h"
+#include "GeneratorUtilities.h"
+#include "ClassParser.h"
+#include "CallableParser.h"
+#include <deque>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    // A class template with one instantiation and a member function template.
+    ClassModels::ClassModel makeBuffer()
+    {
+        std::deque<std::string_view> lines = {
+            "| template = typename T, std::size_t N",
+            "| instantiate = int, 4",
+            "- public:",
+            "- constructor custom:",
+            "| parameters = count:std::size_t",
+            "_",
+            "- method push:",
+            "| return = void",
+            "| parameters = value:const T&",
+            "_",
+            "- method map:",
+            "| template = typename F",
+            "| instantiate = int(*)(T)",
+            "| return = void",
+            "| parameters = f:F",
+            "_",
+            "_",
+            "- private:",
+            "| members = data:std::array<T, N>, count:std::size_t",
+            "_",
+            "_"
+        };
+        return ClassParser::parseClassBlock("Buffer", lines);
+    }
+
+    CallableModels::FunctionModel makeClamp()
+    {
+        std::deque<std::string_view> lines = {
+            " | template = typename T",
+            " | instantiate = int; double",
+            " | return = T",
+            " | parameters = value:T, low:T, high:T"
+        };
+        return CallableParser::parseFunctionProperties("clamp", lines);
+    }
+}
+
+TEST(TemplateGeneratorTest, ClassDeclarationHasTemplateHead)
+{
+    std::string decl = ClassGenerator::generateClassDeclaration(makeBuffer());
+    EXPECT_NE(decl.find(" * @tparam T"), std::string::npos);
+    EXPECT_NE(decl.find("template <typename T, std::size_t N>\nclass Buffer"), std::string::npos);
+    EXPECT_NE(decl.find("template <typename F>\n"), std::string::npos);
+}
+
+TEST(TemplateGeneratorTest, IncludesHeadersOfNonTypeParameters)
+{
+    // std::size_t N needs <cstddef>; type parameters need nothing.
+    EXPECT_EQ(ClassGenerator::requiredHeaders(makeBuffer()).count("<cstddef>"), 1);
+    EXPECT_TRUE(CallableGenerator::requiredHeaders(makeClamp()).empty());
+
+    PropertiesModels::TemplateSpec spec{{"std::uint8_t Bits", "typename T"}, {}};
+    EXPECT_EQ(GeneratorUtilities::templateParameterHeaders(spec), (std::set<std::string>{"<cstdint>"}));
+    // Only whole identifiers match, so std::size_tag adds nothing.
+    PropertiesModels::TemplateSpec custom{{"Size std::size_tag"}, {}};
+    EXPECT_TRUE(GeneratorUtilities::templateParameterHeaders(custom).empty());
+}
+
+TEST(TemplateGeneratorTest, ClassDefinitionsGoToTemplateFile)
+{
+    auto buffer = makeBuffer();
+    EXPECT_TRUE(ClassGenerator::hasTemplates(buffer));
+    EXPECT_EQ(ClassGenerator::generateClassDefinition(buffer), "");
+
+    std::string defs = ClassGenerator::generateClassDefinition(buffer, true);
+    EXPECT_NE(defs.find("template <typename T, std::size_t N>\nBuffer<T, N>::Buffer("), std::string::npos);
+    EXPECT_NE(defs.find("void Buffer<T, N>::push(const T& value)"), std::string::npos);
+    EXPECT_NE(defs.find("template <typename T, std::size_t N>\ntemplate <typename F>\nvoid Buffer<T, N>::map("),
+              std::string::npos);
+}
+
+TEST(TemplateGeneratorTest, ClassExplicitInstantiations)
+{
+    auto buffer = makeBuffer();
+    std::string externs = ClassGenerator::generateExplicitInstantiations(buffer, true);
+    EXPECT_NE(externs.find("extern template class Buffer<int, 4>;"), std::string::npos);
+
+    std::string definitions = ClassGenerator::generateExplicitInstantiations(buffer, false);
+    EXPECT_NE(definitions.find("template class Buffer<int, 4>;"), std::string::npos);
+    EXPECT_EQ(definitions.find("extern"), std::string::npos);
+    EXPECT_NE(definitions.find("template void Buffer<int, 4>::map<int(*)(int)>(int(*)(int) f);"), std::string::npos);
+}
+
+TEST(TemplateGeneratorTest, FunctionInstantiationsSubstituteArguments)
+{
+    auto clamp = makeClamp();
+    EXPECT_EQ(CallableGenerator::generateExplicitInstantiations(clamp, false),
+              "template int clamp<int>(int value, int low, int high);\n"
+              "template double clamp<double>(double value, double low, double high);\n");
+    EXPECT_EQ(CallableGenerator::generateExplicitInstantiations(clamp, true, "Math::").rfind("extern template int Math::clamp<int>(", 0),
+              0u);
+}
+
+TEST(TemplateGeneratorTest, FileNodeSplitsTemplateFile)
+{
+    FileNodeGenerator::FileNode<ClassModels::ClassModel> fileNode("Proj/core", "Buffer", makeBuffer());
+    EXPECT_TRUE(fileNode.hasTemplateFile());
+
+    FileNodeGenerator::GeneratedFiles files = fileNode.generateFiles();
+    EXPECT_NE(files.headerContent.find("#include \"Buffer.tpp\""), std::string::npos);
+    EXPECT_NE(files.headerContent.find("extern template class Buffer<int, 4>;"), std::string::npos);
+    EXPECT_NE(files.templateContent.find("Buffer<T, N>::push"), std::string::npos);
+    EXPECT_NE(files.sourceContent.find("// Explicit instantiations.\ntemplate class Buffer<int, 4>;"), std::string::npos);
+
+    FileNodeGenerator::FileNode<ClassModels::ClassModel> headerOnly("Proj/core", "Buffer", makeBuffer(), true);
+    EXPECT_FALSE(headerOnly.hasTemplateFile());
+}
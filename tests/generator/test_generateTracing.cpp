@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "TracingGenerator.h"
+#include "CallableGenerator.h"
+#include "ClassGenerator.h"
+#include "NamespaceGenerator.h"
+#include "testUtility.h"
+
+using namespace CallableModels;
+using namespace PropertiesModels;
+
+namespace
+{
+    MethodModel makeSubmit(const bool instrument = true, const bool isConstexpr = false)
+    {
+        DeclartionSpecifier declSpec;
+        declSpec.isConstexpr = isConstexpr;
+        return MethodModel(DataType(Types::VOID), "submit", {}, declSpec, "Submits the order", false, TemplateSpec(), instrument);
+    }
+}
+
+TEST(TracingGeneratorTest, OpensInstrumentedBodiesWithATraceScope) {
+    EXPECT_NE(CallableGenerator::generateMethodDefinition("Order", makeSubmit()).find("{\n    TRACE_SCOPE(\"Order::submit\");\n    // TODO"),
+              std::string::npos);
+    EXPECT_EQ(CallableGenerator::generateMethodDefinition("Order", makeSubmit(false)).find("TRACE_SCOPE"), std::string::npos);
+    EXPECT_EQ(CallableGenerator::requiredHeaders(makeSubmit()).count("\"Tracing.h\""), 1);
+
+    // constexpr bodies may run at compile time, so they are never traced.
+    EXPECT_FALSE(TracingGenerator::isInstrumented(makeSubmit(true, true)));
+    EXPECT_EQ(TracingGenerator::traceStatement(makeSubmit(true, true), "Order::submit"), "");
+
+    FunctionModel clamp(DataType(Types::INT), "clamp", {}, DeclartionSpecifier(), "", false, TemplateSpec(), true);
+    EXPECT_NE(CallableGenerator::generateCallableDefinition(clamp).find("TRACE_SCOPE(\"clamp\");"), std::string::npos);
+}
+
+TEST(TracingGeneratorTest, QualifiesNamespacedFunctionsWithTheirScope) {
+    FunctionModel flip(DataType(Types::INT), "flip", {}, DeclartionSpecifier(), "", false, TemplateSpec(), true);
+    CodeGroupModels::NamespaceModel inner{"Inner", "", {}, {flip}, {}};
+    CodeGroupModels::NamespaceModel kinds{"Kinds", "", {}, {flip}, {inner}};
+
+    // Same-named functions in different namespaces keep distinct trace names.
+    const std::string def = NamespaceGenerator::generateNamespaceDefinition(kinds);
+    EXPECT_NE(def.find("TRACE_SCOPE(\"Kinds::flip\");"), std::string::npos);
+    EXPECT_NE(def.find("TRACE_SCOPE(\"Kinds::Inner::flip\");"), std::string::npos);
+    EXPECT_EQ(def.find("TRACE_SCOPE(\"flip\")"), std::string::npos);
+
+    // Header-only namespaces trace their inline bodies the same way.
+    EXPECT_NE(NamespaceGenerator::generateNamespaceDeclaration(kinds, true).find("TRACE_SCOPE(\"Kinds::Inner::flip\");"),
+              std::string::npos);
+}
+
+TEST(TracingGeneratorTest, InheritsInstrumentationFromEnclosingScopes) {
+    ClassModels::ClassModel order = createDummyClass("Order");
+    order.publicMethods = {makeSubmit(false)};
+    EXPECT_FALSE(TracingGenerator::hasTraceScopes(TracingGenerator::applyInstrumentation(order, false)));
+    EXPECT_TRUE(TracingGenerator::hasTraceScopes(TracingGenerator::applyInstrumentation(order, true)));
+
+    order.options.instrument = true;
+    const ClassModels::ClassModel traced = TracingGenerator::applyInstrumentation(order, false);
+    EXPECT_TRUE(traced.publicMethods[0].instrument);
+    EXPECT_NE(ClassGenerator::generateClassDefinition(traced).find("TRACE_SCOPE(\"Order::submit\");"), std::string::npos);
+}
+
+TEST(TracingGeneratorTest, CompilesScopesOutUnlessEnabled) {
+    EXPECT_EQ(TracingGenerator::optionName("Pool-Proj"), "POOL_PROJ_ENABLE_TRACING");
+
+    std::string header = TracingGenerator::generateSupportHeader("MyProject");
+    EXPECT_NE(header.find("#if defined(MYPROJECT_ENABLE_TRACING)"), std::string::npos);
+    EXPECT_NE(header.find("#define TRACE_SCOPE(name) static_cast<void>(0)"), std::string::npos);
+    EXPECT_EQ(header.find("PROJECT_ENABLE_TRACING)\n"), header.find("MYPROJECT_ENABLE_TRACING)\n") + 2);
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include "ValueGenerator.h"
+#include "ClassGenerator.h"
+#include "FileNodeGenerator.h"
+#include "PropertiesParser.h"
+#include "testUtility.h"
+
+namespace
+{
+    ClassModels::ClassModel makeOrder(const bool value = true)
+    {
+        ClassModels::ClassOptions options;
+        options.value = value;
+        return makeClassWithOptions("Order", PropertiesParser::parseParameters("id:int, name:string"),
+                                    PropertiesParser::parseParameters("price:double"), options, "An order");
+    }
+}
+
+TEST(ValueGeneratorTest, DefaultsComparisonsAndHashesEveryMember) {
+    std::string decl = ClassGenerator::generateClassDeclaration(makeOrder());
+    EXPECT_NE(decl.find("    auto operator<=>(const Order&) const = default;\n"), std::string::npos);
+    EXPECT_NE(decl.find("    bool operator==(const Order&) const = default;\n"), std::string::npos);
+    EXPECT_NE(decl.find("    std::size_t hash() const noexcept {\n"
+                        "        std::uint64_t seed = hashing::SEED;\n"
+                        "        seed = hashing::combine(seed, hashing::hashValue(id));\n"
+                        "        seed = hashing::combine(seed, hashing::hashValue(name));\n"
+                        "        seed = hashing::combine(seed, hashing::hashValue(price));\n"
+                        "        return static_cast<std::size_t>(seed);\n"
+                        "    }\n"),
+              std::string::npos);
+    EXPECT_EQ(ClassGenerator::requiredHeaders(makeOrder()).count("\"ValueHash.h\""), 1);
+
+    EXPECT_EQ(ClassGenerator::generateClassDeclaration(makeOrder(false)).find("operator<=>"), std::string::npos);
+    EXPECT_TRUE(ValueGenerator::generateHashSpecialization(makeOrder(false)).empty());
+    EXPECT_TRUE(ValueGenerator::requiredHeaders(makeOrder(false)).empty());
+}
+
+TEST(ValueGeneratorTest, SpecialisesStdHashAfterTheNamespace) {
+    CodeGroupModels::NamespaceModel ns;
+    ns.name = "Core";
+    ns.classes.push_back(makeOrder());
+    ClassModels::ClassModel buffer = makeOrder();
+    buffer.name = "Buffer";
+    buffer.templateSpec.parameters = {"typename T"};
+    ns.classes.push_back(buffer);
+
+    FileNodeGenerator::FileNode<CodeGroupModels::NamespaceModel> node("Proj", "Core", ns);
+    std::string header = node.generateFiles().headerContent;
+    const size_t close = header.find("} // namespace Core\n");
+    const size_t order = header.find("template <>\nstruct std::hash<Core::Order> {\n"
+                                     "    std::size_t operator()(const Core::Order& value) const noexcept { return value.hash(); }\n"
+                                     "};\n");
+    ASSERT_NE(close, std::string::npos);
+    ASSERT_NE(order, std::string::npos);
+    EXPECT_LT(close, order);
+    EXPECT_NE(header.find("template <typename T>\nstruct std::hash<Core::Buffer<T>> {\n"), std::string::npos);
+}
+
+TEST(ValueGeneratorTest, TestsAndBenchmarksDefaultConstructibleClasses) {
+    EXPECT_TRUE(ValueGenerator::hasTest(makeOrder()));
+    EXPECT_TRUE(ValueGenerator::hasBenchmark(makeOrder()));
+    EXPECT_EQ(ValueGenerator::testName("Core::Order"), "CoreOrderValueTest");
+    EXPECT_EQ(ValueGenerator::benchmarkName("Core::Order"), "CoreOrderHashBenchmark");
+
+    std::string test = ValueGenerator::generateTest(makeOrder(), "Core::Order", "Core.h");
+    EXPECT_NE(test.find("        changed.id = static_cast<decltype(changed.id)>(1);\n"), std::string::npos);
+    EXPECT_NE(test.find("        changed.name = \"name\";\n"), std::string::npos);
+    EXPECT_EQ(test.find("changed.price"), std::string::npos);
+
+    std::string benchmark = ValueGenerator::generateBenchmark(makeOrder(), "Core::Order", "Core.h");
+    EXPECT_NE(benchmark.find("    using Key = decltype(Value::id);\n"), std::string::npos);
+
+    // Without a public integral member there is nothing to vary.
+    ClassModels::ClassModel named = makeOrder();
+    named.publicMembers = PropertiesParser::parseParameters("name:string");
+    EXPECT_TRUE(ValueGenerator::hasTest(named));
+    EXPECT_FALSE(ValueGenerator::hasBenchmark(named));
+
+    ClassModels::ClassModel buffer = makeOrder();
+    buffer.templateSpec.parameters = {"typename T"};
+    EXPECT_FALSE(ValueGenerator::hasTest(buffer));
+}
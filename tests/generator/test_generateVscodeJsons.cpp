@@ -41,3 +41,45 @@ TEST(VsCodeJsonGeneratorTest, ValidJsonStructure) {
     EXPECT_EQ(tasksJson.back(), '}');
 }
 
+
+TEST(VsCodeJsonGeneratorTest, TasksJsonContainsPgoLoop) {
+    auto jsonPair = generateVscodeJSONs("MyProject");
+    std::string tasksJson = jsonPair.second;
+
+    // The loop builds instrumented, trains by running the binary, then rebuilds with profiles.
+    EXPECT_TRUE(contains(tasksJson, "\"label\": \"PGO Train and Rebuild MyProject\""));
+    EXPECT_TRUE(contains(tasksJson, "cmake --build --preset pgo-instrument && ./build/pgo/MyProject"));
+    EXPECT_TRUE(contains(tasksJson, "cmake --preset pgo-use && cmake --build --preset pgo-use"));
+}
+
+TEST(VsCodeJsonGeneratorTest, DevBuildTaskAndLaunch) {
+    auto jsonPair = generateVscodeJSONs("MyProject");
+
+    EXPECT_TRUE(contains(jsonPair.second, "\"label\": \"Dev Build MyProject\""));
+    EXPECT_TRUE(contains(jsonPair.second, "cmake --preset dev && cmake --build --preset dev"));
+    EXPECT_TRUE(contains(jsonPair.first, "${workspaceFolder}/build/dev/MyProject"));
+    EXPECT_TRUE(contains(jsonPair.first, "\"preLaunchTask\": \"Dev Build MyProject\""));
+}
+
+TEST(VsCodeJsonGeneratorTest, ProfilingToolsAreOptIn) {
+    auto defaults = generateVscodeJSONs("MyProject");
+    EXPECT_FALSE(contains(defaults.first, "build/profile"));
+    EXPECT_FALSE(contains(defaults.second, "perf record"));
+
+    auto jsonPair = generateVscodeJSONs("MyProject", true);
+    std::string launchJson = jsonPair.first;
+    std::string tasksJson = jsonPair.second;
+
+    EXPECT_TRUE(contains(launchJson, "${workspaceFolder}/build/profile/MyProject"));
+    EXPECT_TRUE(contains(launchJson, "\"preLaunchTask\": \"Profile Build MyProject\""));
+
+    // Every tool runs after the profile build against the same binary.
+    EXPECT_TRUE(contains(tasksJson, "cmake --preset profile && cmake --build --preset profile"));
+    EXPECT_TRUE(contains(tasksJson, "perf record -g -o build/profile/perf.data ./build/profile/MyProject"));
+    EXPECT_TRUE(contains(tasksJson, "perf report -i build/profile/perf.data"));
+    EXPECT_TRUE(contains(tasksJson, "heaptrack -o build/profile/heaptrack.MyProject ./build/profile/MyProject"));
+    EXPECT_TRUE(contains(tasksJson, "valgrind --tool=massif"));
+    EXPECT_TRUE(contains(tasksJson, "ctest --test-dir build/profile -L benchmark"));
+    EXPECT_TRUE(contains(tasksJson, "\"dependsOn\": \"Profile Build MyProject\""));
+    EXPECT_EQ(tasksJson.back(), '}');
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "LayoutGenerator.h"
+#include "ClassGenerator.h"
+#include "FileNodeGenerator.h"
+#include "testUtility.h"
+
+using namespace LayoutGenerator;
+using PropertiesModels::DataType;
+using PropertiesModels::Parameter;
+using PropertiesModels::Types;
+
+namespace
+{
+    ClassModels::ClassModel makeLayoutClass(const std::vector<Parameter> &pubMembers,
+                                            const std::vector<Parameter> &privMembers,
+                                            ClassModels::LayoutPolicy layout = ClassModels::LayoutPolicy::COMPACT)
+    {
+        ClassModels::ClassOptions options;
+        options.layout = layout;
+        return makeClassWithOptions("Packet", pubMembers, privMembers, options, "A packet");
+    }
+}
+
+TEST(LayoutGeneratorTest, BuiltinTypeLayouts) {
+    EXPECT_EQ(typeLayout(DataType(Types::CHAR))->size, 1u);
+    EXPECT_EQ(typeLayout(DataType(Types::INT))->alignment, 4u);
+    EXPECT_EQ(typeLayout(DataType(Types::STRING))->size, 32u);
+
+    PropertiesModels::TypeDeclarator ptr;
+    ptr.ptrCount = 1;
+    EXPECT_EQ(typeLayout(DataType(Types::CHAR, ptr))->size, 8u);
+
+    PropertiesModels::TypeDeclarator arr;
+    arr.arrayDimensions = {"3", "2"};
+    EXPECT_EQ(typeLayout(DataType(Types::INT, arr))->size, 24u);
+    arr.arrayDimensions = {"N"};
+    EXPECT_FALSE(typeLayout(DataType(Types::INT, arr)).has_value());
+
+    EXPECT_FALSE(typeLayout(DataType(Types::CUSTOM, std::string("Foo"), PropertiesModels::TypeQualifier::NONE)).has_value());
+}
+
+TEST(LayoutGeneratorTest, CompactOrdersByAlignmentAndReportsSavings) {
+    auto cl = makeLayoutClass({}, {Parameter(DataType(Types::BOOL), "a"), Parameter(DataType(Types::DOUBLE), "b"),
+                                   Parameter(DataType(Types::BOOL), "c"), Parameter(DataType(Types::INT), "d")});
+
+    auto ordered = orderMembers(cl);
+    ASSERT_EQ(ordered.privateMembers.size(), 4u);
+    EXPECT_EQ(ordered.privateMembers[0].name, "b");
+    EXPECT_EQ(ordered.privateMembers[1].name, "d");
+    EXPECT_EQ(ordered.privateMembers[2].name, "a");
+    EXPECT_EQ(ordered.privateMembers[3].name, "c");
+
+    LayoutReport report = estimateLayout(cl);
+    EXPECT_EQ(report.declaredSize, 24u);
+    EXPECT_EQ(report.optimisedSize, 16u);
+    EXPECT_EQ(report.bytesSaved(), 8u);
+    EXPECT_TRUE(report.isComplete);
+}
+
+TEST(LayoutGeneratorTest, CompactNeverGrowsAcrossSections) {
+    // Sorting the private section by decreasing alignment would leave a hole after the public char.
+    auto cl = makeLayoutClass({Parameter(DataType(Types::CHAR), "tag")},
+                              {Parameter(DataType(Types::CHAR), "flag"), Parameter(DataType(Types::DOUBLE), "value")});
+
+    LayoutReport report = estimateLayout(cl);
+    EXPECT_EQ(report.optimisedSize, 16u);
+    EXPECT_EQ(report.bytesSaved(), 0u);
+    EXPECT_EQ(orderMembers(cl).privateMembers[0].name, "flag");
+}
+
+TEST(LayoutGeneratorTest, DeclaredLayoutIsUntouchedAndUnreported) {
+    auto cl = makeLayoutClass({}, {Parameter(DataType(Types::BOOL), "a"), Parameter(DataType(Types::DOUBLE), "b")},
+                              ClassModels::LayoutPolicy::DECLARED);
+
+    EXPECT_EQ(orderMembers(cl).privateMembers[0].name, "a");
+    EXPECT_FALSE(contains(ClassGenerator::generateClassDeclaration(cl), "@note"));
+}
+
+TEST(LayoutGeneratorTest, ClassDeclarationEmitsCompactOrderAndNote) {
+    auto cl = makeLayoutClass({}, {Parameter(DataType(Types::BOOL), "a"), Parameter(DataType(Types::DOUBLE), "b"),
+                                   Parameter(DataType(Types::CUSTOM, std::string("Foo"), PropertiesModels::TypeQualifier::NONE), "c")});
+
+    std::string output = ClassGenerator::generateClassDeclaration(cl);
+    EXPECT_TRUE(contains(output, " * @note Compact layout: estimated 16 bytes, 0 bytes saved over declared order."
+                                 " Members of unknown size are not counted.\n"));
+    EXPECT_TRUE(contains(output, "    Foo c; ///< \n    double b; ///< \n    bool a; ///< \n"));
+}
+
+TEST(LayoutGeneratorTest, GroupsHotMembersFirstAndColdLast) {
+    using PropertiesModels::Annotation;
+    auto cl = makeLayoutClass({}, {Parameter(DataType(Types::STRING), "name", Annotation::COLD),
+                                   Parameter(DataType(Types::INT), "id"),
+                                   Parameter(DataType(Types::LONG), "hits", Annotation::HOT)},
+                              ClassModels::LayoutPolicy::DECLARED);
+
+    auto ordered = orderMembers(cl);
+    EXPECT_EQ(ordered.privateMembers[0].name, "hits");
+    EXPECT_EQ(ordered.privateMembers[1].name, "id");
+    EXPECT_EQ(ordered.privateMembers[2].name, "name");
+}
+
+TEST(LayoutGeneratorTest, OwnCachelineMembersAreIsolated) {
+    using PropertiesModels::Annotation;
+    auto cl = makeLayoutClass({}, {Parameter(DataType(Types::LONG), "counter", Annotation::OWN_CACHELINE),
+                                   Parameter(DataType(Types::INT), "id")},
+                              ClassModels::LayoutPolicy::DECLARED);
+
+    // Both the contended member and the one after it start a new line.
+    std::string output = ClassGenerator::generateClassDeclaration(cl);
+    EXPECT_TRUE(contains(output, "    alignas(std::hardware_destructive_interference_size) long counter; ///< \n"
+                                 "    alignas(std::hardware_destructive_interference_size) int id; ///< \n"));
+    EXPECT_EQ(estimateLayout(cl).declaredSize, 128u);
+    EXPECT_EQ(ClassGenerator::requiredHeaders(cl), std::set<std::string>{"<new>"});
+
+    FileNodeGenerator::FileNode<ClassModels::ClassModel> node("ROOT", "Packet", cl);
+    EXPECT_EQ(node.generateFiles().headerContent.rfind("#include <new>\n\n", 0), 0u);
+}
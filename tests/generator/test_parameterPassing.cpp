@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "ParameterPassingGenerator.h"
+#include "CallableGenerator.h"
+#include "ClassGenerator.h"
+#include "PropertiesGenerator.h"
+#include "PropertiesParser.h"
+#include <string>
+#include <vector>
+
+using CodeGroupModels::PassingConvention;
+
+namespace
+{
+    // Parameters covering every rule: builtin, read-only string, custom type, explicit reference and sink.
+    std::vector<PropertiesModels::Parameter> makeParams()
+    {
+        return PropertiesParser::parseParameters(
+            "count:int, name:string, config:Config, out:Config&, label:const string @sink, id:const string");
+    }
+}
+
+TEST(ParameterPassingTest, DeclaredConventionKeepsSignatures)
+{
+    auto params = makeParams();
+    EXPECT_EQ(PropertiesGenerator::generateParameterList(ParameterPassingGenerator::applyConvention(params, PassingConvention::DECLARED)),
+              PropertiesGenerator::generateParameterList(params));
+}
+
+TEST(ParameterPassingTest, ConstRefPassesStringsAndCustomTypesByReference)
+{
+    auto params = ParameterPassingGenerator::applyConvention(makeParams(), PassingConvention::CONST_REF);
+    EXPECT_EQ(PropertiesGenerator::generateParameterList(params),
+              "int count, const std::string& name, const Config& config, Config& out, std::string label, const std::string& id");
+    EXPECT_TRUE(PropertiesGenerator::requiredHeaders(params).empty());
+}
+
+TEST(ParameterPassingTest, StringViewConventionAppliesToDeclarationsAndDefinitions)
+{
+    PropertiesModels::DeclartionSpecifier ds;
+    CallableModels::MethodModel method(PropertiesModels::DataType(PropertiesModels::Types::VOID), "log",
+                                       PropertiesParser::parseParameters("message:string, tag:string @sink"), ds, "Logs");
+    ClassModels::ClassModel cl("Logger", "", {}, std::nullopt, {method}, {}, {}, {}, {}, {}, false, false);
+
+    auto passed = ParameterPassingGenerator::applyConvention(cl, PassingConvention::STRING_VIEW);
+    EXPECT_NE(ClassGenerator::generateClassDeclaration(passed).find("void log(std::string_view message, std::string tag);"),
+              std::string::npos);
+    EXPECT_NE(ClassGenerator::generateClassDefinition(passed).find("void Logger::log(std::string_view message, std::string tag) {"),
+              std::string::npos);
+    EXPECT_EQ(ClassGenerator::requiredHeaders(passed), std::set<std::string>{"<string_view>"});
+}
+
+TEST(ParameterPassingTest, ConstructorParametersInitialisingMembersAreSinks)
+{
+    ClassModels::Constructor ctor(ClassModels::ConstructorType::CUSTOM,
+                                  PropertiesParser::parseParameters("name:string, prefix:string"), "");
+    ClassModels::ClassModel cl("Logger", "", {ctor}, std::nullopt, {}, {}, {},
+                               {}, PropertiesParser::parseParameters("name:string"), {}, false, false);
+
+    auto passed = ParameterPassingGenerator::applyConvention(cl, PassingConvention::CONST_REF);
+    EXPECT_EQ(PropertiesGenerator::generateParameterList(passed.constructors[0].parameters),
+              "std::string name, const std::string& prefix");
+    EXPECT_NE(ClassGenerator::generateClassDefinition(passed).find(": name(std::move(name))"), std::string::npos);
+    EXPECT_EQ(ClassGenerator::requiredHeaders(passed), std::set<std::string>{"<utility>"});
+}
+
+TEST(ParameterPassingTest, SmallCustomTypesAndEnumsStayByValue)
+{
+    auto params = ParameterPassingGenerator::applyConvention(
+        PropertiesParser::parseParameters("index:std::size_t, byte:std::byte, view:std::string_view, side:Side, other:Book::Side, config:Config"),
+        PassingConvention::CONST_REF, {"Side"});
+    EXPECT_EQ(PropertiesGenerator::generateParameterList(params),
+              "std::size_t index, std::byte byte, std::string_view view, Side side, Book::Side other, const Config& config");
+}
+
+TEST(ParameterPassingTest, NamespaceEnumsStayByValue)
+{
+    PropertiesModels::DeclartionSpecifier ds;
+    CallableModels::FunctionModel flip(PropertiesModels::DataType(PropertiesModels::Types::VOID), "flip",
+                                       PropertiesParser::parseParameters("side:Side, count:std::size_t, book:Book"), ds, "");
+    CodeGroupModels::NamespaceModel ns;
+    ns.name = "Core";
+    ns.enums = {EnumModels::EnumModel{"Side", "", {"BUY", "SELL"}, ""}};
+    CodeGroupModels::NamespaceModel inner;
+    inner.name = "Inner";
+    inner.functions = {flip};
+    ns.namespaces = {inner};
+
+    auto passed = ParameterPassingGenerator::applyConvention(ns, PassingConvention::CONST_REF);
+    EXPECT_EQ(PropertiesGenerator::generateParameterList(passed.namespaces[0].functions[0].parameters),
+              "Side side, std::size_t count, const Book& book");
+}
@@ -489,4 +489,27 @@ TEST(TraverseAndGenerateEdgeCases, ProjectWithOnlyDependencies) {
 
     // Expect no file write calls.
     EXPECT_EQ(testWriter.calls.size(), 0);
-}
\ No newline at end of file
+}
+// Header-only libraries emit headers with inline definitions and no source files.
+TEST(TraverseAndGenerateTests, HeaderOnlyLibraryWritesNoSources)
+{
+    LibraryModel lib("MathLib", "1.0", {}, {}, {createDummyClass("Vector")}, {},
+                     {createDummyFunction("dot")}, LibraryMode::HEADER_ONLY);
+    ProjectModel model("MyGame", "1.0", {}, {lib});
+    ProjMetadata metadata({});
+    auto root = buildDirectoryTree(model, metadata);
+    ASSERT_NE(root, nullptr);
+
+    EXPECT_TRUE(metadata.libraries["MathLib"].isHeaderOnly);
+
+    TestFileWriter testWriter;
+    traverseAndGenerate(root, testWriter);
+
+    // One header for the class and one for the free functions.
+    ASSERT_EQ(testWriter.calls.size(), 2);
+    for (const auto &call : testWriter.calls)
+    {
+        EXPECT_EQ(call.type, "header");
+        EXPECT_NE(call.content.find("inline"), std::string::npos);
+    }
+}
@@ -232,3 +232,38 @@ TEST(LibraryParserTest, ThrowsErrorOnNestedLibrary) {
         LibraryModel lib = parseLibraryBlock("LibWithNestedLib", lines);
     }, std::runtime_error);
 }
+
+TEST(LibraryParserTest, ParsesHeaderOnlyMode) {
+    // The mode property switches the library to header-only packaging.
+    std::deque<std::string_view> lines = {
+        "| version = 1.0.0",
+        "| mode = header-only",
+        "_"
+    };
+
+    LibraryModel lib = parseLibraryBlock("HeaderLib", lines);
+
+    EXPECT_EQ(lib.mode, LibraryMode::HEADER_ONLY);
+}
+
+TEST(LibraryParserTest, ThrowsOnUnknownMode) {
+    std::deque<std::string_view> lines = {
+        "| mode = static",
+        "_"
+    };
+
+    EXPECT_THROW({
+        LibraryModel lib = parseLibraryBlock("BadModeLib", lines);
+    }, std::runtime_error);
+}
+
+TEST(LibraryParserTest, ParsesInstrumentOption) {
+    std::deque<std::string_view> none = {"_"};
+    EXPECT_FALSE(parseLibraryBlock("TracedLib", none).instrument);
+
+    std::deque<std::string_view> lines = {"| instrument = true", "_"};
+    EXPECT_TRUE(parseLibraryBlock("TracedLib", lines).instrument);
+
+    std::deque<std::string_view> bad = {"| instrument = maybe", "_"};
+    EXPECT_THROW(parseLibraryBlock("TracedLib", bad), std::runtime_error);
+}
@@ -181,3 +181,35 @@ TEST(NamespaceParserTest, ParsesEmptyNamespaceBlock) {
     EXPECT_TRUE(ns.functions.empty());
     EXPECT_TRUE(ns.namespaces.empty());
 }
+
+TEST(NamespaceParserTest, ParsesEnumBlock) {
+    std::deque<std::string_view> lines = {
+        "- enum Side:",
+        "| description = \"Side of an order\"",
+        "| values = BUY, SELL",
+        "| underlying = std::uint8_t",
+        "_",
+        "_"
+    };
+
+    NamespaceModel ns = parseNamespaceBlock(std::make_optional("Core"), lines);
+
+    ASSERT_EQ(ns.enums.size(), 1);
+    EXPECT_EQ(ns.enums[0].name, "Side");
+    EXPECT_EQ(ns.enums[0].description, "Side of an order");
+    EXPECT_EQ(ns.enums[0].values, (std::vector<std::string>{"BUY", "SELL"}));
+    EXPECT_EQ(ns.enums[0].underlyingType, "std::uint8_t");
+}
+
+TEST(NamespaceParserTest, ThrowsOnInvalidEnumBlocks) {
+    const std::vector<std::vector<std::string_view>> blocks = {
+        {"- enum Side:", "| values = BUY, SELL, BUY", "_", "_"},
+        {"- enum Side:", "| values = BUY, 2SELL", "_", "_"},
+        {"- enum Side:", "| description = \"No values\"", "_", "_"},
+        {"- enum Side:", "| values = BUY", "| unknown = x", "_", "_"},
+    };
+    for (const auto &block : blocks) {
+        std::deque<std::string_view> lines(block.begin(), block.end());
+        EXPECT_THROW(parseNamespaceBlock(std::make_optional("Core"), lines), std::runtime_error);
+    }
+}
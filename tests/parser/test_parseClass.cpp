@@ -310,3 +310,135 @@ TEST(ClassParserTest, ThrowsOnCompletelyMalformedFile) {
 
     EXPECT_THROW(parseClassBlock("MalformedClass", lines), std::runtime_error);
 }
+
+TEST(ClassParserTest, ParsesLayoutOption) {
+    std::deque<std::string_view> lines = {
+        "| layout = compact",
+        "| members = flag:bool, total:double",
+        "_"
+    };
+
+    ClassModel cls = parseClassBlock("TestClass", lines);
+    EXPECT_EQ(cls.options.layout, LayoutPolicy::COMPACT);
+    // Members are kept in DSL order; reordering happens at generation time.
+    ASSERT_EQ(cls.privateMembers.size(), 2);
+    EXPECT_EQ(cls.privateMembers[0].name, "flag");
+
+    std::deque<std::string_view> bad = {"| layout = packed", "_"};
+    EXPECT_THROW(parseClassBlock("TestClass", bad), std::runtime_error);
+}
+
+TEST(ClassParserTest, ParsesSpecialMemberOptions) {
+    std::deque<std::string_view> lines = {
+        "| special_members = custom",
+        "| members = id:int",
+        "_"
+    };
+    ClassModel cls = parseClassBlock("TestClass", lines);
+    EXPECT_EQ(cls.options.specialMembers, SpecialMemberPolicy::CUSTOM);
+    EXPECT_FALSE(cls.options.triviallyCopyable);
+
+    std::deque<std::string_view> trivial = {"| trivially_copyable = true", "| members = id:int", "_"};
+    EXPECT_TRUE(parseClassBlock("TestClass", trivial).options.triviallyCopyable);
+
+    // Custom copy and move bodies contradict trivial copyability.
+    std::deque<std::string_view> conflicting = {
+        "| special_members = custom", "| trivially_copyable = true", "| members = id:int", "_"};
+    EXPECT_THROW(parseClassBlock("TestClass", conflicting), std::runtime_error);
+
+    std::deque<std::string_view> bad = {"| special_members = manual", "_"};
+    EXPECT_THROW(parseClassBlock("TestClass", bad), std::runtime_error);
+}
+
+TEST(ClassParserTest, ParsesClassTemplate) {
+    std::deque<std::string_view> lines = {
+        "| template = typename T, std::size_t N",
+        "| instantiate = int, 4; double, 8",
+        "- private:",
+        "| members = data:std::array<T, N>, count:std::size_t",
+        "_",
+        "_"
+    };
+
+    ClassModel cls = parseClassBlock("Buffer", lines);
+    EXPECT_EQ(cls.templateSpec.parameters, (std::vector<std::string>{"typename T", "std::size_t N"}));
+    EXPECT_EQ(cls.templateSpec.instantiations, (std::vector<std::string>{"int, 4", "double, 8"}));
+    ASSERT_EQ(cls.privateMembers.size(), 2);
+    EXPECT_EQ(cls.privateMembers[0].type.customType, "std::array<T, N>");
+
+    std::deque<std::string_view> mismatched = {"| template = typename T", "| instantiate = int, 4", "_"};
+    EXPECT_THROW(parseClassBlock("Buffer", mismatched), std::runtime_error);
+}
+
+TEST(ClassParserTest, ParsesAllocatorOption) {
+    std::deque<std::string_view> lines = {"| allocator = pmr", "| members = name:string", "_"};
+    EXPECT_EQ(parseClassBlock("TestClass", lines).options.allocator, AllocatorPolicy::PMR);
+
+    // Arrays cannot be initialised from another object's in a member-initialiser list.
+    std::deque<std::string_view> arrays = {"| allocator = pmr", "| members = ids:int[4]", "_"};
+    EXPECT_THROW(parseClassBlock("TestClass", arrays), std::runtime_error);
+
+    std::deque<std::string_view> bad = {"| allocator = arena", "_"};
+    EXPECT_THROW(parseClassBlock("TestClass", bad), std::runtime_error);
+}
+
+TEST(ClassParserTest, ParsesSoaOption) {
+    std::deque<std::string_view> lines = {"| soa = true", "- public:", "| members = x:float, y:float", "_", "_"};
+    EXPECT_TRUE(parseClassBlock("TestClass", lines).options.soa);
+
+    // std::vector<bool> is not contiguous, so it cannot be exposed as a std::span.
+    std::deque<std::string_view> flags = {"| soa = true", "- public:", "| members = alive:bool", "_", "_"};
+    EXPECT_THROW(parseClassBlock("TestClass", flags), std::runtime_error);
+
+    std::deque<std::string_view> privateOnly = {"| soa = true", "| members = x:float", "_"};
+    EXPECT_THROW(parseClassBlock("TestClass", privateOnly), std::runtime_error);
+}
+
+TEST(ClassParserTest, ParsesSerializeOption) {
+    std::deque<std::string_view> lines = {"| serialize = binary", "- public:", "| members = id:int, name:string", "_", "_"};
+    EXPECT_EQ(parseClassBlock("TestClass", lines).options.serialize, ClassModels::SerializationFormat::BINARY);
+
+    std::deque<std::string_view> unknown = {"| serialize = json", "_"};
+    EXPECT_THROW(parseClassBlock("TestClass", unknown), std::runtime_error);
+
+    // Deserialising assigns every member in place.
+    std::deque<std::string_view> constMember = {"| serialize = binary", "| members = id:const int", "_"};
+    EXPECT_THROW(parseClassBlock("TestClass", constMember), std::runtime_error);
+}
+
+TEST(ClassParserTest, ParsesPooledOption) {
+    std::deque<std::string_view> lines = {"| pooled = true", "| members = id:int", "_"};
+    EXPECT_TRUE(parseClassBlock("TestClass", lines).options.pooled);
+
+    std::deque<std::string_view> invalid = {"| pooled = sometimes", "_"};
+    EXPECT_THROW(parseClassBlock("TestClass", invalid), std::runtime_error);
+}
+
+TEST(ClassParserTest, ParsesInstrumentOption) {
+    std::deque<std::string_view> lines = {"| instrument = true", "_"};
+    EXPECT_TRUE(parseClassBlock("TestClass", lines).options.instrument);
+
+    std::deque<std::string_view> invalid = {"| instrument = on", "_"};
+    EXPECT_THROW(parseClassBlock("TestClass", invalid), std::runtime_error);
+}
+
+TEST(ClassParserTest, ParsesReflectOption) {
+    std::deque<std::string_view> lines = {"| reflect = true", "| members = id:int", "_"};
+    EXPECT_TRUE(parseClassBlock("TestClass", lines).options.reflect);
+
+    // A pointer to member cannot point to a reference.
+    std::deque<std::string_view> reference = {"| reflect = true", "| members = owner:Account&", "_"};
+    EXPECT_THROW(parseClassBlock("TestClass", reference), std::runtime_error);
+}
+
+TEST(ClassParserTest, ParsesValueOption) {
+    std::deque<std::string_view> lines = {"| value = true", "| members = id:int", "_"};
+    EXPECT_TRUE(parseClassBlock("TestClass", lines).options.value);
+
+    // Defaulted comparisons are deleted for reference members.
+    std::deque<std::string_view> reference = {"| value = true", "| members = owner:Account&", "_"};
+    EXPECT_THROW(parseClassBlock("TestClass", reference), std::runtime_error);
+
+    std::deque<std::string_view> invalid = {"| value = maybe", "_"};
+    EXPECT_THROW(parseClassBlock("TestClass", invalid), std::runtime_error);
+}
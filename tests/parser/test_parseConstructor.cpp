@@ -87,3 +87,21 @@ TEST(ConstructorParserTest, ThrowsOnUnknownProperty) {
         parseConstructorProperties("custom", lines);
     }, std::runtime_error);
 }
+
+TEST(ConstructorParserTest, ParsesNoexceptProperty) {
+    std::deque<std::string_view> lines = {
+        "| parameters = x:int",
+        "| noexcept = true",
+        "_"  // end of block marker
+    };
+    auto ctor = parseConstructorProperties("custom", lines);
+    ASSERT_TRUE(ctor.isNoexcept.has_value());
+    EXPECT_TRUE(*ctor.isNoexcept);
+
+    // Left unset, noexcept is inferred by the generator.
+    std::deque<std::string_view> none;
+    EXPECT_FALSE(parseConstructorProperties("move", none).isNoexcept.has_value());
+
+    std::deque<std::string_view> invalid = {"| noexcept = maybe", "_"};
+    EXPECT_THROW(parseConstructorProperties("move", invalid), std::runtime_error);
+}
@@ -242,3 +242,24 @@ TEST(CallableParserFunctionTest, DeclarationSpecifiersParsed) {
     EXPECT_TRUE(functionModel.declSpec.isInline);
     EXPECT_TRUE(functionModel.declSpec.isConstexpr);
 }
+
+// Test: Function templates carry their parameters and instantiations.
+TEST(CallableParserFunctionTest, TemplateAndInstantiationsParsed) {
+    std::deque<std::string_view> propertyLines = {
+        " | template = typename T",
+        " | instantiate = int; double",
+        " | return = T",
+        " | parameters = value:T"
+    };
+
+    auto functionModel = parseFunctionProperties("clamp", propertyLines);
+
+    EXPECT_TRUE(functionModel.templateSpec.isTemplate());
+    EXPECT_EQ(functionModel.templateSpec.parameters, std::vector<std::string>{"typename T"});
+    EXPECT_EQ(functionModel.templateSpec.instantiations, (std::vector<std::string>{"int", "double"}));
+    EXPECT_EQ(functionModel.returnType.customType, "T");
+
+    // Instantiations are checked against parameters declared before them.
+    std::deque<std::string_view> unordered = {" | instantiate = int", " | template = typename T"};
+    EXPECT_THROW(parseFunctionProperties("clamp", unordered), std::runtime_error);
+}
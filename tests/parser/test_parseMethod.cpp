@@ -238,3 +238,29 @@ TEST(CallableParserMethodTest, DeclarationSpecifiersParsed) {
     EXPECT_TRUE(methodModel.declSpec.isInline);
     EXPECT_TRUE(methodModel.declSpec.isConstexpr);
 }
+
+// Test: Method block marked noexcept.
+TEST(CallableParserMethodTest, ParsesNoexceptProperty) {
+    std::deque<std::string_view> propertyLines = {
+        " | return = int",
+        " | noexcept = true"
+    };
+
+    auto methodModel = parseMethodProperties("size", propertyLines);
+    EXPECT_TRUE(methodModel.isNoexcept);
+
+    std::deque<std::string_view> defaultLines = {" | return = int"};
+    EXPECT_FALSE(parseMethodProperties("size", defaultLines).isNoexcept);
+}
+
+// Test: Method block asking for a trace scope.
+TEST(CallableParserMethodTest, ParsesInstrumentProperty) {
+    std::deque<std::string_view> propertyLines = {" | return = void", " | instrument = true"};
+    EXPECT_TRUE(parseMethodProperties("submit", propertyLines).instrument);
+
+    std::deque<std::string_view> defaultLines = {" | return = void"};
+    EXPECT_FALSE(parseMethodProperties("submit", defaultLines).instrument);
+
+    std::deque<std::string_view> invalid = {" | instrument = 1"};
+    EXPECT_THROW(parseMethodProperties("submit", invalid), std::runtime_error);
+}
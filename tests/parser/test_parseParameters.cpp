@@ -193,3 +193,54 @@ TEST(ParseParametersTest, RecognizesPointerAndArrayParameter) {
     ASSERT_EQ(params[0].type.typeDecl.arrayDimensions.size(), 1);
     EXPECT_EQ(params[0].type.typeDecl.arrayDimensions[0], "5");
 }
+
+// Test: Annotations after the type are parsed into the parameter's bitmask.
+TEST(ParseParametersTest, ParsesMemberAnnotations) {
+    using PropertiesModels::Annotation;
+    auto params = parseParameters("counter:long @hot @own_cacheline, log:string @cold, id:int");
+    ASSERT_EQ(params.size(), 3);
+
+    EXPECT_EQ(params[0].type.type, PropertiesModels::Types::LONG);
+    EXPECT_TRUE(PropertiesModels::hasAnnotation(params[0].annotations, Annotation::HOT));
+    EXPECT_TRUE(PropertiesModels::hasAnnotation(params[0].annotations, Annotation::OWN_CACHELINE));
+    EXPECT_EQ(params[1].type.type, PropertiesModels::Types::STRING);
+    EXPECT_EQ(params[1].annotations, Annotation::COLD);
+    EXPECT_EQ(params[2].annotations, Annotation::NONE);
+}
+
+// Test: Unknown or contradictory annotations throw.
+TEST(ParseParametersTest, ThrowsOnInvalidAnnotations) {
+    EXPECT_THROW(parseParameters("x:int @warm"), std::runtime_error);
+    EXPECT_THROW(parseParameters("x:int @hot @cold"), std::runtime_error);
+}
+
+// Test: Parameters can be marked as sinks to be passed by value and moved from.
+TEST(ParseParametersTest, ParsesSinkAnnotation) {
+    auto params = parseParameters("name:string @sink, id:int");
+    ASSERT_EQ(params.size(), 2);
+    EXPECT_EQ(params[0].annotations, PropertiesModels::Annotation::SINK);
+    EXPECT_EQ(params[1].annotations, PropertiesModels::Annotation::NONE);
+}
+
+// Test: Commas inside template-ids do not split parameters.
+TEST(ParseParametersTest, ParsesTemplateIdTypes) {
+    auto params = parseParameters("index:std::map<int, std::string>, values:const std::array<T, N>&");
+    ASSERT_EQ(params.size(), 2);
+    EXPECT_EQ(params[0].name, "index");
+    EXPECT_EQ(params[0].type.customType, "std::map<int, std::string>");
+    EXPECT_EQ(params[1].type.customType, "std::array<T, N>");
+    EXPECT_TRUE(params[1].type.typeDecl.isLValReference);
+    EXPECT_THROW(parseParameters("bad:std::map<int, char"), std::runtime_error);
+}
+
+// Test: Template parameters and instantiations keep their declarations and argument lists.
+TEST(ParseParametersTest, ParsesTemplateParametersAndInstantiations) {
+    auto params = PropertiesParser::parseTemplateParameters("typename T, std::size_t N");
+    EXPECT_EQ(params, (std::vector<std::string>{"typename T", "std::size_t N"}));
+    auto instantiations = PropertiesParser::parseTemplateInstantiations("int, 4; std::pair<int, char>, 8", 2);
+    EXPECT_EQ(instantiations, (std::vector<std::string>{"int, 4", "std::pair<int, char>, 8"}));
+
+    EXPECT_THROW(PropertiesParser::parseTemplateParameters("T"), std::runtime_error);
+    EXPECT_THROW(PropertiesParser::parseTemplateParameters("typename... Ts"), std::runtime_error);
+    EXPECT_THROW(PropertiesParser::parseTemplateInstantiations("int", 2), std::runtime_error);
+}
@@ -177,4 +177,118 @@ TEST(ProjectParserTest, ThrowsErrorOnNestedProjectKeyword) {
     EXPECT_THROW({
         ProjectModel proj = parseProjectBlock("MainProject", lines);
     }, std::runtime_error);
-}
\ No newline at end of file
+}
+TEST(ProjectParserTest, ParsesCMakeLayoutOption) {
+    std::deque<std::string_view> lines = {
+        "| version = 1.0.0",
+        "| cmake = subprojects",
+        "_"
+    };
+
+    ProjectModel proj = parseProjectBlock("MyProject", lines);
+
+    EXPECT_EQ(proj.options.cmakeLayout, CMakeLayout::SUBPROJECTS);
+}
+
+TEST(ProjectParserTest, ThrowsOnUnknownCMakeLayout) {
+    std::deque<std::string_view> lines = {
+        "| cmake = distributed",
+        "_"
+    };
+
+    EXPECT_THROW({
+        ProjectModel proj = parseProjectBlock("MyProject", lines);
+    }, std::runtime_error);
+}
+
+TEST(ProjectParserTest, ParsesGranularityOptions) {
+    std::deque<std::string_view> lines = {
+        "| granularity = balanced",
+        "| max_functions_per_file = 16",
+        "| tu_cost = 40",
+        "_"
+    };
+
+    ProjectModel proj = parseProjectBlock("MyProject", lines);
+
+    EXPECT_EQ(proj.options.granularity, TuGranularity::BALANCED);
+    EXPECT_EQ(proj.options.maxFunctionsPerFile, 16);
+    EXPECT_EQ(proj.options.targetTuCost, 40);
+}
+
+TEST(ProjectParserTest, ThrowsOnInvalidGranularityOptions) {
+    std::deque<std::string_view> badPolicy = {"| granularity = coarse", "_"};
+    std::deque<std::string_view> badCount = {"| max_functions_per_file = -3", "_"};
+    std::deque<std::string_view> zeroCost = {"| tu_cost = 0", "_"};
+
+    EXPECT_THROW(parseProjectBlock("MyProject", badPolicy), std::runtime_error);
+    EXPECT_THROW(parseProjectBlock("MyProject", badCount), std::runtime_error);
+    EXPECT_THROW(parseProjectBlock("MyProject", zeroCost), std::runtime_error);
+}
+
+TEST(ProjectParserTest, ParsesBuildSystemOption) {
+    std::deque<std::string_view> lines = {"| build = both", "_"};
+    EXPECT_EQ(parseProjectBlock("MyProject", lines).options.buildSystem, BuildSystem::BOTH);
+
+    std::deque<std::string_view> bad = {"| build = make", "_"};
+    EXPECT_THROW(parseProjectBlock("MyProject", bad), std::runtime_error);
+}
+
+TEST(ProjectParserTest, ParsesProfilingOption) {
+    std::deque<std::string_view> none = {"_"};
+    EXPECT_FALSE(parseProjectBlock("MyProject", none).options.profilingTools);
+
+    std::deque<std::string_view> lines = {"| profiling = true", "_"};
+    EXPECT_TRUE(parseProjectBlock("MyProject", lines).options.profilingTools);
+
+    std::deque<std::string_view> bad = {"| profiling = yes", "_"};
+    EXPECT_THROW(parseProjectBlock("MyProject", bad), std::runtime_error);
+}
+
+TEST(ProjectParserTest, ParsesInstrumentOption) {
+    std::deque<std::string_view> none = {"_"};
+    EXPECT_FALSE(parseProjectBlock("MyProject", none).options.instrument);
+
+    std::deque<std::string_view> lines = {"| instrument = true", "_"};
+    EXPECT_TRUE(parseProjectBlock("MyProject", lines).options.instrument);
+
+    std::deque<std::string_view> bad = {"| instrument = yes", "_"};
+    EXPECT_THROW(parseProjectBlock("MyProject", bad), std::runtime_error);
+}
+
+TEST(ProjectParserTest, ParsesProfilerOption) {
+    std::deque<std::string_view> none = {"_"};
+    EXPECT_FALSE(parseProjectBlock("MyProject", none).options.profiler);
+
+    std::deque<std::string_view> lines = {"| profiler = true", "_"};
+    EXPECT_TRUE(parseProjectBlock("MyProject", lines).options.profiler);
+
+    std::deque<std::string_view> bad = {"| profiler = on", "_"};
+    EXPECT_THROW(parseProjectBlock("MyProject", bad), std::runtime_error);
+}
+
+TEST(ProjectParserTest, ParsesParameterPassingOption) {
+    std::deque<std::string_view> none = {"_"};
+    EXPECT_EQ(parseProjectBlock("MyProject", none).options.passing, CodeGroupModels::PassingConvention::DECLARED);
+
+    std::deque<std::string_view> lines = {"| parameter_passing = string_view", "_"};
+    EXPECT_EQ(parseProjectBlock("MyProject", lines).options.passing, CodeGroupModels::PassingConvention::STRING_VIEW);
+
+    std::deque<std::string_view> bad = {"| parameter_passing = by_value", "_"};
+    EXPECT_THROW(parseProjectBlock("MyProject", bad), std::runtime_error);
+}
+
+TEST(ProjectParserTest, ParsesErrorHandlingOption) {
+    std::deque<std::string_view> none = {"_"};
+    EXPECT_EQ(parseProjectBlock("MyProject", none).options.errors, CodeGroupModels::ErrorHandling::EXCEPTIONS);
+
+    std::deque<std::string_view> lines = {"| errors = expected", "_"};
+    EXPECT_EQ(parseProjectBlock("MyProject", lines).options.errors, CodeGroupModels::ErrorHandling::EXPECTED);
+
+    std::deque<std::string_view> bad = {"| errors = codes", "_"};
+    EXPECT_THROW(parseProjectBlock("MyProject", bad), std::runtime_error);
+
+    // The profiling library needs exceptions.
+    std::deque<std::string_view> profiled = {"| errors = expected", "| profiler = true", "_"};
+    EXPECT_THROW(parseProjectBlock("MyProject", profiled), std::runtime_error);
+}
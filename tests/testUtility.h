@@ -36,6 +36,10 @@ static inline ClassModels::ClassModel createDummyClass(const std::string &name,
         emptyParams,
         "Copy constructor");
 
+    // Keep the copy constructor out of line so the class has a source file to write.
+    ClassModels::ClassOptions options;
+    options.specialMembers = ClassModels::SpecialMemberPolicy::CUSTOM;
+
     // Construct a class with a single default constructor.
     return ClassModels::ClassModel(
         name,
@@ -49,8 +53,20 @@ static inline ClassModels::ClassModel createDummyClass(const std::string &name,
         {},            // private members
         {},            // protected members
         false,         // hasCopyAssignment
-        false          // hasMoveAssignment
-    );
+        false,         // hasMoveAssignment
+        options);
+}
+
+// Helper: Create a ClassModel holding only data members, generated with the given options.
+static inline ClassModels::ClassModel makeClassWithOptions(const std::string &name,
+                                                           const std::vector<PropertiesModels::Parameter> &publicMembers,
+                                                           const std::vector<PropertiesModels::Parameter> &privateMembers,
+                                                           const ClassModels::ClassOptions &options,
+                                                           const std::string &desc = "Dummy class")
+{
+    return ClassModels::ClassModel(name, desc, makeEmptyCtors(), std::nullopt,
+                                   makeEmptyMethods(), makeEmptyMethods(), makeEmptyMethods(),
+                                   publicMembers, privateMembers, makeEmptyMembers(), false, false, options);
 }
 
 // Helper: Create a dummy FunctionModel.
@@ -96,7 +112,7 @@ class TestFileWriter : public IFileWriter
 public:
     struct FileWrite
     {
-        std::string type;     ///< The type of file written ("header" or "source").
+        std::string type;     ///< The type of file written ("header", "source" or "template").
         std::string filePath; ///< The file path that was written.
         std::string content;  ///< The content that was written.
     };
@@ -112,6 +128,11 @@ public:
     {
         calls.push_back({"source", filePath, content});
     }
+
+    void writeTemplateFile(const std::string &filePath, const std::string &content) override
+    {
+        calls.push_back({"template", filePath, content});
+    }
 };
 
 // Helper function to check if a substring exists in the given string.